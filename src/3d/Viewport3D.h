@@ -60,6 +60,7 @@ public:
     PyObjectsEnum derived_type() override final;
     UIDrawable* click_at(sf::Vector2f point) override final;
     sf::FloatRect get_bounds() const override;
+    bool retainable() const override { return false; }  // Redraws its 3D scene every frame
     void move(float dx, float dy) override;
     void resize(float w, float h) override;
 
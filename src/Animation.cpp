@@ -18,6 +18,9 @@
 #include <cmath>
 #include <algorithm>
 #include <unordered_map>
+#include <array>
+#include <iterator>
+#include <utility>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -37,6 +40,7 @@ Animation::Animation(const std::string& targetProperty,
                      bool loop,
                      PyObject* callback)
     : targetProperty(targetProperty)
+    , propertyId(AnimationProperty::intern(targetProperty))
     , targetValue(targetValue)
     , duration(duration)
     , easingFunc(easingFunc)
@@ -76,8 +80,10 @@ Animation::~Animation() {
 
 void Animation::start(std::shared_ptr<UIDrawable> target) {
     if (!target) return;
+    AnimationManager::getInstance().unbatch(*this);  // restarting: own our state again
 
     targetWeak = target;
+    drawableSetter = target->floatSetter(propertyId);
     elapsed = 0.0f;
     callbackTriggered = false; // Reset callback state
 
@@ -143,8 +149,10 @@ void Animation::start(std::shared_ptr<UIDrawable> target) {
 
 void Animation::startEntity(std::shared_ptr<UIEntity> target) {
     if (!target) return;
+    AnimationManager::getInstance().unbatch(*this);  // restarting: own our state again
 
     entityTargetWeak = target;
+    entitySetter = UIEntity::floatSetter(propertyId);
     elapsed = 0.0f;
     callbackTriggered = false; // Reset callback state
 
@@ -186,6 +194,7 @@ void Animation::startEntity(std::shared_ptr<UIEntity> target) {
 
 void Animation::startEntity3D(std::shared_ptr<mcrf::Entity3D> target) {
     if (!target) return;
+    AnimationManager::getInstance().unbatch(*this);  // restarting: own our state again
 
     entity3dTargetWeak = target;
     elapsed = 0.0f;
@@ -240,6 +249,10 @@ void Animation::clearCallback() {
 }
 
 void Animation::complete() {
+    // A batched animation finishes on the per-object path, which fires the
+    // callback on the next update
+    auto batched = AnimationManager::getInstance().unbatch(*this);
+
     // Jump to end of animation
     elapsed = duration;
 
@@ -259,10 +272,13 @@ void Animation::complete() {
         AnimationValue finalValue = interpolate(finalT);
         applyValue(entity3d.get(), finalValue);
     }
+
+    if (batched) AnimationManager::getInstance().resume(std::move(batched));
 }
 
 void Animation::stop() {
     // Mark as stopped - no final value applied, no callback triggered
+    AnimationManager::getInstance().unbatch(*this);
     stopped = true;
     // AnimationManager will remove this on next update() call
 }
@@ -273,6 +289,12 @@ bool Animation::update(float deltaTime) {
         return false;  // Signal removal from AnimationManager
     }
 
+    // Stepped by hand (Animation.update()) while batched: continue per-object
+    if (trackId >= 0) {
+        auto& manager = AnimationManager::getInstance();
+        manager.resume(manager.unbatch(*this));
+    }
+
     // Try to lock weak_ptr to get shared_ptr
     std::shared_ptr<UIDrawable> target = targetWeak.lock();
     std::shared_ptr<UIEntity> entity = entityTargetWeak.lock();
@@ -323,9 +345,11 @@ bool Animation::update(float deltaTime) {
         // two per-frame std::variant visits (interpolate() and applyValue()).
         float v = interpolateFloat(easedT);
         if (target) {
-            target->setProperty(targetProperty, v);
+            if (drawableSetter) drawableSetter(*target, v);
+            else target->setProperty(targetProperty, v);
         } else if (entity) {
-            entity->setProperty(targetProperty, v);
+            if (entitySetter) entitySetter(*entity, v);
+            else entity->setProperty(targetProperty, v);
         } else if (entity3d) {
             entity3d->setProperty(targetProperty, v);
         }
@@ -349,7 +373,13 @@ bool Animation::update(float deltaTime) {
     return !isComplete();
 }
 
+float Animation::currentElapsed() const {
+    if (trackId < 0) return elapsed;
+    return AnimationManager::getInstance().batchedElapsed(trackId, trackSlot);
+}
+
 AnimationValue Animation::getCurrentValue() const {
+    float elapsed = currentElapsed();
     float t = duration > 0 ? elapsed / duration : 1.0f;
     float easedT = easingFunc(t);
     return interpolate(easedT);
@@ -469,11 +499,14 @@ void Animation::applyValue(UIDrawable* target, const AnimationValue& value) {
         using T = std::decay_t<decltype(val)>;
 
         if constexpr (std::is_same_v<T, float>) {
-            target->setProperty(targetProperty, val);
+            if (drawableSetter) drawableSetter(*target, val);
+            else target->setProperty(targetProperty, val);
         }
         else if constexpr (std::is_same_v<T, int>) {
             // Most UI properties use float setProperty, so try float first
-            if (!target->setProperty(targetProperty, static_cast<float>(val))) {
+            if (drawableSetter) {
+                drawableSetter(*target, static_cast<float>(val));
+            } else if (!target->setProperty(targetProperty, static_cast<float>(val))) {
                 // Fall back to int if float didn't work
                 target->setProperty(targetProperty, val);
             }
@@ -497,7 +530,8 @@ void Animation::applyValue(UIEntity* entity, const AnimationValue& value) {
         using T = std::decay_t<decltype(val)>;
 
         if constexpr (std::is_same_v<T, float>) {
-            entity->setProperty(targetProperty, val);
+            if (entitySetter) entitySetter(*entity, val);
+            else entity->setProperty(targetProperty, val);
         }
         else if constexpr (std::is_same_v<T, int>) {
             entity->setProperty(targetProperty, val);
@@ -1062,8 +1096,64 @@ EasingFunction getByName(const std::string& name) {
     return linear;  // Default to linear
 }
 
+namespace {
+using EaseFn = float (*)(float);
+
+// The batchable easings; an index here is the easing's id and its track
+constexpr EaseFn builtinEasings[] = {
+    linear, easeIn, easeOut, easeInOut,
+    easeInQuad, easeOutQuad, easeInOutQuad,
+    easeInCubic, easeOutCubic, easeInOutCubic,
+    easeInQuart, easeOutQuart, easeInOutQuart,
+    easeInSine, easeOutSine, easeInOutSine,
+    easeInExpo, easeOutExpo, easeInOutExpo,
+    easeInCirc, easeOutCirc, easeInOutCirc,
+    easeInElastic, easeOutElastic, easeInOutElastic,
+    easeInBack, easeOutBack, easeInOutBack,
+    easeInBounce, easeOutBounce, easeInOutBounce,
+    pingPong, pingPongSmooth, pingPongEaseIn, pingPongEaseOut, pingPongEaseInOut,
+};
+} // namespace
+
+int idOf(const EasingFunction& func) {
+    const EaseFn* fn = func.target<EaseFn>();
+    if (!fn) return -1;
+    for (size_t i = 0; i < std::size(builtinEasings); ++i) {
+        if (*fn == builtinEasings[i]) return static_cast<int>(i);
+    }
+    return -1;
+}
+
 } // namespace EasingFunctions
 
+namespace {
+// Advance one track: the easing is a compile-time constant, so it inlines and
+// the loop is a straight run over contiguous floats that the compiler can
+// vectorize (fully for the polynomial easings).
+template <size_t Easing>
+void advanceScalars(float* __restrict elapsed, const float* __restrict duration,
+                    const float* __restrict from, const float* __restrict span,
+                    float* __restrict value, size_t n, float dt)
+{
+    constexpr EasingFunctions::EaseFn ease = EasingFunctions::builtinEasings[Easing];
+    for (size_t i = 0; i < n; ++i) {
+        float e = std::min(elapsed[i] + dt, duration[i]);
+        elapsed[i] = e;
+        value[i] = from[i] + span[i] * ease(e / duration[i]);
+    }
+}
+
+using AdvanceKernel = void (*)(float*, const float*, const float*, const float*, float*, size_t, float);
+
+template <size_t... I>
+constexpr std::array<AdvanceKernel, sizeof...(I)> makeKernels(std::index_sequence<I...>) {
+    return {{ &advanceScalars<I>... }};
+}
+
+constexpr auto advanceKernels =
+    makeKernels(std::make_index_sequence<std::size(EasingFunctions::builtinEasings)>());
+} // namespace
+
 // AnimationManager implementation
 AnimationManager& AnimationManager::getInstance() {
     static AnimationManager instance;
@@ -1076,7 +1166,9 @@ void* AnimationManager::getAnimationTarget(const std::shared_ptr<Animation>& ani
 
 bool AnimationManager::isPropertyAnimating(void* target, const std::string& property) const {
     if (!target) return false;
-    PropertyKey key{target, property};
+    AnimationProperty::Id id = AnimationProperty::lookup(property);
+    if (id == AnimationProperty::NONE) return false;
+    PropertyKey key{target, id};
     auto it = propertyLocks.find(key);
     if (it == propertyLocks.end()) return false;
     // Check if the animation is still valid
@@ -1107,7 +1199,7 @@ void AnimationManager::processQueue() {
         if (propertyFree && anim && anim->hasValidTarget()) {
             // Property is free, start the animation
             propertyLocks[key] = anim;
-            activeAnimations.push_back(anim);
+            activate(anim);
             it = animationQueue.erase(it);
         } else if (!anim || !anim->hasValidTarget()) {
             // Animation target was destroyed, remove from queue
@@ -1125,8 +1217,7 @@ void AnimationManager::addAnimation(std::shared_ptr<Animation> animation,
     }
 
     void* target = getAnimationTarget(animation);
-    std::string property = animation->getTargetProperty();
-    PropertyKey key{target, property};
+    PropertyKey key{target, animation->getPropertyId()};
 
     // Check for existing animation on this property (#120)
     auto existingIt = propertyLocks.find(key);
@@ -1172,7 +1263,7 @@ void AnimationManager::addAnimation(std::shared_ptr<Animation> animation,
                 PyErr_Format(PyExc_RuntimeError,
                     "Animation conflict: property '%s' is already being animated on this target. "
                     "Use conflict_mode='replace' to override or 'queue' to wait.",
-                    property.c_str());
+                    animation->getTargetProperty().c_str());
                 PyGILState_Release(gstate);
                 return;
         }
@@ -1185,13 +1276,14 @@ void AnimationManager::addAnimation(std::shared_ptr<Animation> animation,
         // Defer adding during update to avoid iterator invalidation
         pendingAnimations.push_back(animation);
     } else {
-        activeAnimations.push_back(animation);
+        activate(animation);
     }
 }
 
 void AnimationManager::update(float deltaTime) {
     // Set flag to defer new animations
     isUpdating = true;
+    size_t perObject = activeAnimations.size();
 
     // Remove completed or invalid animations
     activeAnimations.erase(
@@ -1202,9 +1294,23 @@ void AnimationManager::update(float deltaTime) {
         activeAnimations.end()
     );
 
+    // Batched scalar tweens, one easing function at a time
+    size_t batched = batchedCount();
+    for (size_t id = 0; id < tracks.size(); ++id) {
+        if (tracks[id].size()) updateTrack(id, deltaTime);
+    }
+
     // Clear update flag
     isUpdating = false;
 
+    for (auto& track : tracks) compact(track);
+
+    if (McRFPy_API::game) {
+        auto& metrics = McRFPy_API::game->metrics;
+        metrics.animationsUpdated += static_cast<int>(perObject + batched);
+        metrics.animationsBatched += static_cast<int>(batched);
+    }
+
     // Clean up expired property locks (#120)
     cleanupPropertyLocks();
 
@@ -1216,8 +1322,7 @@ void AnimationManager::update(float deltaTime) {
         for (auto& anim : pendingAnimations) {
             if (anim && anim->hasValidTarget()) {
                 void* target = getAnimationTarget(anim);
-                std::string property = anim->getTargetProperty();
-                PropertyKey key{target, property};
+                PropertyKey key{target, anim->getPropertyId()};
 
                 // Check if this animation is already the property lock holder
                 // (this happens when addAnimation was called during update)
@@ -1230,7 +1335,7 @@ void AnimationManager::update(float deltaTime) {
                 if (isLockHolder || propertyFree) {
                     // This animation owns the lock or property is free - add it
                     propertyLocks[key] = anim;
-                    activeAnimations.push_back(anim);
+                    activate(anim);
                 } else {
                     // Property still locked by another animation, re-queue
                     animationQueue.emplace_back(key, anim);
@@ -1243,6 +1348,17 @@ void AnimationManager::update(float deltaTime) {
 
 
 void AnimationManager::clear(bool completeAnimations) {
+    // Batched animations get their state back before anything completes them
+    std::vector<std::shared_ptr<Animation>> batched;
+    for (auto& track : tracks) {
+        for (size_t i = 0; i < track.size(); ++i) {
+            if (track.dead[i]) continue;
+            batched.push_back(track.owner[i]);
+            release(track, i);
+        }
+    }
+    tracks.clear();
+
     if (completeAnimations) {
         // Complete all animations before clearing
         for (auto& anim : activeAnimations) {
@@ -1250,9 +1366,178 @@ void AnimationManager::clear(bool completeAnimations) {
                 anim->complete();
             }
         }
+        for (auto& anim : batched) {
+            anim->complete();
+        }
     }
     activeAnimations.clear();
     pendingAnimations.clear();
     animationQueue.clear();
     propertyLocks.clear();
-}
\ No newline at end of file
+}
+std::vector<std::shared_ptr<Animation>> AnimationManager::getActiveAnimations() const {
+    std::vector<std::shared_ptr<Animation>> all = activeAnimations;
+    for (const auto& track : tracks) {
+        for (size_t i = 0; i < track.size(); ++i) {
+            if (!track.dead[i]) all.push_back(track.owner[i]);
+        }
+    }
+    return all;
+}
+
+size_t AnimationManager::batchedCount() const {
+    size_t n = 0;
+    for (const auto& track : tracks) {
+        for (size_t i = 0; i < track.size(); ++i) {
+            if (!track.dead[i]) ++n;
+        }
+    }
+    return n;
+}
+
+void AnimationManager::activate(std::shared_ptr<Animation> animation) {
+    if (!batch(animation)) activeAnimations.push_back(std::move(animation));
+}
+
+bool AnimationManager::batch(const std::shared_ptr<Animation>& animation) {
+    Animation& a = *animation;
+    if (!a.isSimpleFloatAnim || a.loop || a.stopped || a.trackId >= 0 ||
+        a.duration <= 0.0f || a.elapsed >= a.duration) {
+        return false;
+    }
+    int id = EasingFunctions::idOf(a.easingFunc);
+    const float* from = std::get_if<float>(&a.startValue);
+    const float* to = std::get_if<float>(&a.targetValue);
+    if (id < 0 || !from || !to) return false;
+
+    // Same target precedence as Animation::update()
+    void* target = nullptr;
+    std::weak_ptr<void> alive;
+    AnimationProperty::FloatSetter<UIDrawable> drawableSetter = nullptr;
+    AnimationProperty::FloatSetter<UIEntity> entitySetter = nullptr;
+    if (auto drawable = a.targetWeak.lock()) {
+        if (!a.drawableSetter) return false;
+        target = drawable.get();
+        alive = drawable;
+        drawableSetter = a.drawableSetter;
+    } else if (auto entity = a.entityTargetWeak.lock()) {
+        if (!a.entitySetter) return false;
+        target = entity.get();
+        alive = entity;
+        entitySetter = a.entitySetter;
+    } else {
+        return false;
+    }
+
+    if (tracks.size() <= static_cast<size_t>(id)) tracks.resize(id + 1);
+    ScalarTrack& track = tracks[id];
+    a.trackId = id;
+    a.trackSlot = track.size();
+    track.from.push_back(*from);
+    track.span.push_back(a.delta ? *to : *to - *from);
+    track.elapsed.push_back(a.elapsed);
+    track.duration.push_back(a.duration);
+    track.value.push_back(*from);
+    track.target.push_back(target);
+    track.alive.push_back(std::move(alive));
+    track.drawableSetter.push_back(drawableSetter);
+    track.entitySetter.push_back(entitySetter);
+    track.owner.push_back(animation);
+    track.dead.push_back(0);
+    return true;
+}
+
+void AnimationManager::updateTrack(size_t id, float deltaTime) {
+    ScalarTrack& track = tracks[id];
+    const size_t n = track.size();
+    advanceKernels[id](track.elapsed.data(), track.duration.data(), track.from.data(),
+                       track.span.data(), track.value.data(), n, deltaTime);
+
+    std::vector<size_t> finished;
+    for (size_t i = 0; i < n; ++i) {
+        if (track.dead[i]) continue;
+        if (track.alive[i].expired()) {
+            release(track, i);  // target destroyed: drop without callback
+            continue;
+        }
+        if (track.drawableSetter[i]) {
+            track.drawableSetter[i](*static_cast<UIDrawable*>(track.target[i]), track.value[i]);
+        } else {
+            track.entitySetter[i](*static_cast<UIEntity*>(track.target[i]), track.value[i]);
+        }
+        if (track.elapsed[i] >= track.duration[i]) finished.push_back(i);
+    }
+
+    // Callbacks run last: they may stop or complete other batched animations,
+    // which only marks slots dead, or add animations, which are deferred
+    for (size_t i : finished) {
+        if (id >= tracks.size() || i >= tracks[id].size()) break;  // cleared by a callback
+        ScalarTrack& t = tracks[id];
+        if (t.dead[i]) continue;
+        auto anim = t.owner[i];
+        release(t, i);
+        if (anim->pythonCallback && !anim->callbackTriggered) {
+            anim->triggerCallback();
+        }
+    }
+}
+
+std::shared_ptr<Animation> AnimationManager::unbatch(Animation& animation) {
+    if (animation.trackId < 0) return nullptr;
+    ScalarTrack& track = tracks[animation.trackId];
+    size_t i = animation.trackSlot;
+    auto owner = track.owner[i];
+    release(track, i);
+    return owner;
+}
+
+void AnimationManager::resume(std::shared_ptr<Animation> animation) {
+    if (isUpdating) {
+        pendingAnimations.push_back(std::move(animation));
+    } else {
+        activeAnimations.push_back(std::move(animation));
+    }
+}
+
+void AnimationManager::release(ScalarTrack& track, size_t i) {
+    Animation& a = *track.owner[i];
+    a.elapsed = track.elapsed[i];
+    a.trackId = -1;
+    track.dead[i] = 1;
+}
+
+void AnimationManager::compact(ScalarTrack& track) {
+    size_t i = 0;
+    while (i < track.size()) {
+        if (!track.dead[i]) {
+            ++i;
+            continue;
+        }
+        size_t last = track.size() - 1;
+        if (i != last) {
+            track.from[i] = track.from[last];
+            track.span[i] = track.span[last];
+            track.elapsed[i] = track.elapsed[last];
+            track.duration[i] = track.duration[last];
+            track.value[i] = track.value[last];
+            track.target[i] = track.target[last];
+            track.alive[i] = std::move(track.alive[last]);
+            track.drawableSetter[i] = track.drawableSetter[last];
+            track.entitySetter[i] = track.entitySetter[last];
+            track.owner[i] = std::move(track.owner[last]);
+            track.dead[i] = track.dead[last];
+            if (!track.dead[i]) track.owner[i]->trackSlot = i;
+        }
+        track.from.pop_back();
+        track.span.pop_back();
+        track.elapsed.pop_back();
+        track.duration.pop_back();
+        track.value.pop_back();
+        track.target.pop_back();
+        track.alive.pop_back();
+        track.drawableSetter.pop_back();
+        track.entitySetter.pop_back();
+        track.owner.pop_back();
+        track.dead.pop_back();
+    }
+}
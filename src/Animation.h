@@ -7,6 +7,7 @@
 #include <vector>
 #include "Common.h"
 #include "Python.h"
+#include "AnimationProperty.h"
 
 // Forward declarations
 class UIDrawable;
@@ -85,9 +86,10 @@ public:
     
     // Animation properties
     std::string getTargetProperty() const { return targetProperty; }
+    AnimationProperty::Id getPropertyId() const { return propertyId; }
     float getDuration() const { return duration; }
-    float getElapsed() const { return elapsed; }
-    bool isComplete() const { return (!loop && elapsed >= duration) || stopped; }
+    float getElapsed() const { return currentElapsed(); }
+    bool isComplete() const { return (!loop && currentElapsed() >= duration) || stopped; }
     bool isStopped() const { return stopped; }
     bool isDelta() const { return delta; }
     bool isLooping() const { return loop; }
@@ -101,7 +103,10 @@ public:
     }
     
 private:
+    friend class AnimationManager;  // batches scalar tweens (see ScalarTrack)
+
     std::string targetProperty;    // Property name to animate (e.g., "x", "color.r", "sprite_index")
+    AnimationProperty::Id propertyId;  // targetProperty interned at construction
     AnimationValue startValue;     // Starting value (captured when animation starts)
     AnimationValue targetValue;    // Target value to animate to
     float duration;                // Animation duration in seconds
@@ -121,6 +126,17 @@ private:
     // std::visit dispatches (interpolate() + applyValue()), which profiling
     // showed to be ~13% of the animation hot path. Set once at construction.
     bool isSimpleFloatAnim = false;
+
+    // Typed setter for propertyId on the target, resolved in start(); when
+    // null the value goes through setProperty() by name
+    AnimationProperty::FloatSetter<UIDrawable> drawableSetter = nullptr;
+    AnimationProperty::FloatSetter<UIEntity> entitySetter = nullptr;
+
+    // While AnimationManager batches this animation, its elapsed time lives in
+    // slot trackSlot of track trackId (the easing id) and `elapsed` is stale
+    int trackId = -1;
+    size_t trackSlot = 0;
+    float currentElapsed() const;
     
     // Callback support
     PyObject* pythonCallback = nullptr;  // Python callback function (we own a reference)
@@ -200,6 +216,9 @@ namespace EasingFunctions {
 
     // Get easing function by name
     EasingFunction getByName(const std::string& name);
+
+    // Index of a built-in easing function (batchable), or -1 for any other
+    int idOf(const EasingFunction& func);
 }
 
 // Animation manager to handle active animations
@@ -226,23 +245,66 @@ public:
     bool isPropertyAnimating(void* target, const std::string& property) const;
 
     // Get active animation count (for debugging/testing)
-    size_t getActiveAnimationCount() const { return activeAnimations.size(); }
+    size_t getActiveAnimationCount() const { return activeAnimations.size() + batchedCount(); }
 
     // Get all active animations (for mcrfpy.animations)
-    const std::vector<std::shared_ptr<Animation>>& getActiveAnimations() const { return activeAnimations; }
+    std::vector<std::shared_ptr<Animation>> getActiveAnimations() const;
+
+    // Scalar tweens currently updated in batches
+    size_t batchedCount() const;
+
+    // Take an animation off the batched path, writing its elapsed time back so
+    // the Animation is authoritative again. Returns the owning reference it
+    // held, or nullptr if the animation was not batched.
+    std::shared_ptr<Animation> unbatch(Animation& animation);
+
+    // Put an animation back on the per-object update path
+    void resume(std::shared_ptr<Animation> animation);
+
+    // Elapsed time of a batched animation
+    float batchedElapsed(int track, size_t slot) const { return tracks[track].elapsed[slot]; }
 
 private:
     AnimationManager() = default;
     std::vector<std::shared_ptr<Animation>> activeAnimations;
     std::vector<std::shared_ptr<Animation>> pendingAnimations; // Animations to add after update
+
+    // Scalar float tweens (the common case: x, y, opacity, color channels...)
+    // are kept out of activeAnimations in structure-of-arrays tracks, one per
+    // built-in easing function, so a frame advances each track with one tight
+    // loop the compiler can vectorize, then applies the values through the
+    // typed setters. Compound values, loops and custom easings stay on the
+    // per-object path. Slots are only marked dead while a track is being
+    // walked and are compacted away at the end of update().
+    struct ScalarTrack {
+        std::vector<float> from, span, elapsed, duration, value;
+        std::vector<void*> target;
+        std::vector<std::weak_ptr<void>> alive;
+        std::vector<AnimationProperty::FloatSetter<UIDrawable>> drawableSetter;
+        std::vector<AnimationProperty::FloatSetter<UIEntity>> entitySetter;
+        std::vector<std::shared_ptr<Animation>> owner;
+        std::vector<uint8_t> dead;
+
+        size_t size() const { return from.size(); }
+    };
+    std::vector<ScalarTrack> tracks;  // indexed by EasingFunctions::idOf()
+
+    // Add to a track if eligible, else to activeAnimations
+    void activate(std::shared_ptr<Animation> animation);
+    bool batch(const std::shared_ptr<Animation>& animation);
+    void updateTrack(size_t id, float deltaTime);
+    // Hand slot i's state back to its Animation and mark the slot dead
+    void release(ScalarTrack& track, size_t i);
+    // Swap-remove dead slots
+    void compact(ScalarTrack& track);
     bool isUpdating = false; // Flag to track if we're in update loop
     AnimationConflictMode defaultConflictMode = AnimationConflictMode::REPLACE;
 
     // Property lock tracking for conflict detection (#120)
-    // Key: (target_ptr, property_name) -> weak reference to active animation
+    // Key: (target_ptr, property id) -> weak reference to active animation
     struct PropertyKey {
         void* target;
-        std::string property;
+        AnimationProperty::Id property;
 
         bool operator==(const PropertyKey& other) const {
             return target == other.target && property == other.property;
@@ -252,7 +314,7 @@ private:
     struct PropertyKeyHash {
         size_t operator()(const PropertyKey& key) const {
             return std::hash<void*>()(key.target) ^
-                   (std::hash<std::string>()(key.property) << 1);
+                   (static_cast<size_t>(key.property) * 0x9E3779B97F4A7C15ull);
         }
     };
 
@@ -0,0 +1,67 @@
+#include "AnimationProperty.h"
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+struct Registry {
+    std::unordered_map<std::string, AnimationProperty::Id> ids;
+    std::vector<std::string> names;
+
+    Registry() {
+        // Must list the enum in order
+        static const char* known[] = {
+            "x", "y", "w", "h",
+            "draw_x", "draw_y",
+            "opacity", "rotation", "origin_x", "origin_y", "z_index",
+            "outline", "font_size", "size",
+            "scale", "scale_x", "scale_y",
+            "sprite_scale", "sprite_offset_x", "sprite_offset_y",
+            "fill_color.r", "fill_color.g", "fill_color.b", "fill_color.a",
+            "outline_color.r", "outline_color.g", "outline_color.b", "outline_color.a",
+        };
+        static_assert(sizeof(known) / sizeof(known[0]) == AnimationProperty::COUNT,
+                      "AnimationProperty names out of step with the enum");
+        for (const char* n : known) {
+            ids.emplace(n, static_cast<AnimationProperty::Id>(names.size()));
+            names.emplace_back(n);
+        }
+    }
+};
+
+Registry& registry() {
+    static Registry r;
+    return r;
+}
+
+} // namespace
+
+namespace AnimationProperty {
+
+Id intern(const std::string& name)
+{
+    auto& r = registry();
+    auto it = r.ids.find(name);
+    if (it != r.ids.end()) return it->second;
+    if (r.names.size() >= NONE) return NONE;
+    Id id = static_cast<Id>(r.names.size());
+    r.ids.emplace(name, id);
+    r.names.push_back(name);
+    return id;
+}
+
+Id lookup(const std::string& name)
+{
+    auto& r = registry();
+    auto it = r.ids.find(name);
+    return it != r.ids.end() ? it->second : NONE;
+}
+
+const std::string& name(Id id)
+{
+    static const std::string none;
+    auto& r = registry();
+    return id < r.names.size() ? r.names[id] : none;
+}
+
+} // namespace AnimationProperty
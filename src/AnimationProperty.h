@@ -0,0 +1,56 @@
+#pragma once
+// AnimationProperty.h - Interned animatable property names.
+//
+// An animation resolves its property name to a small integer id once, when it
+// is created, and to a typed setter once, when it starts; each frame then
+// applies its value with one indexed call instead of a chain of string
+// compares. Property locks are keyed by (target, id).
+//
+// The properties the drawables animate most are ids known at compile time,
+// so each class can keep a fixed SetterTable indexed by them. Any other name
+// (shader uniforms, properties of less common types) is interned on demand
+// and falls back to the string setProperty() path.
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace AnimationProperty {
+
+using Id = uint16_t;
+
+enum : Id {
+    X, Y, W, H,
+    DRAW_X, DRAW_Y,
+    OPACITY, ROTATION, ORIGIN_X, ORIGIN_Y, Z_INDEX,
+    OUTLINE, FONT_SIZE, SIZE,
+    SCALE, SCALE_X, SCALE_Y,
+    SPRITE_SCALE, SPRITE_OFFSET_X, SPRITE_OFFSET_Y,
+    FILL_COLOR_R, FILL_COLOR_G, FILL_COLOR_B, FILL_COLOR_A,
+    OUTLINE_COLOR_R, OUTLINE_COLOR_G, OUTLINE_COLOR_B, OUTLINE_COLOR_A,
+    COUNT  // first id handed out to names interned at runtime
+};
+
+constexpr Id NONE = 0xFFFF;
+
+// Id for name, registering it if it has not been seen
+Id intern(const std::string& name);
+
+// Id for name, or NONE if it was never interned (does not register)
+Id lookup(const std::string& name);
+
+const std::string& name(Id id);
+
+template <typename T>
+using FloatSetter = void (*)(T&, float);
+
+// Per-class float setters indexed by the compile-time ids
+template <typename T>
+struct SetterTable {
+    std::array<FloatSetter<T>, COUNT> setters{};
+
+    FloatSetter<T>& operator[](Id id) { return setters[id]; }
+    FloatSetter<T> get(Id id) const { return id < COUNT ? setters[id] : nullptr; }
+};
+
+} // namespace AnimationProperty
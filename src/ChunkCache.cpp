@@ -0,0 +1,53 @@
+#include "ChunkCache.h"
+#include "GridLayers.h"
+
+ChunkCache& ChunkCache::get()
+{
+    // Never destroyed: layers owned by Python objects can outlive static
+    // destruction at interpreter shutdown and still call forget().
+    static ChunkCache* instance = new ChunkCache();
+    return *instance;
+}
+
+void ChunkCache::setBudget(size_t bytes)
+{
+    budget_bytes = bytes;
+    evictToBudget(0);
+}
+
+void ChunkCache::touch(GridLayer* layer, int chunk_idx, size_t bytes)
+{
+    if (layer->chunk_cached[chunk_idx]) {
+        Slot slot = layer->chunk_cache_slots[chunk_idx];
+        resident_bytes -= slot->bytes;
+        slot->bytes = bytes;
+        lru.splice(lru.begin(), lru, slot);
+    } else {
+        lru.push_front({layer, chunk_idx, bytes});
+        layer->chunk_cache_slots[chunk_idx] = lru.begin();
+        layer->chunk_cached[chunk_idx] = true;
+    }
+    resident_bytes += bytes;
+    evictToBudget(1);
+}
+
+void ChunkCache::forget(GridLayer* layer, int chunk_idx)
+{
+    if (!layer->chunk_cached[chunk_idx]) return;
+    Slot slot = layer->chunk_cache_slots[chunk_idx];
+    resident_bytes -= slot->bytes;
+    lru.erase(slot);
+    layer->chunk_cached[chunk_idx] = false;
+}
+
+void ChunkCache::evictToBudget(size_t keep)
+{
+    while (resident_bytes > budget_bytes && lru.size() > keep) {
+        Entry victim = lru.back();
+        lru.pop_back();
+        resident_bytes -= victim.bytes;
+        victim.layer->chunk_cached[victim.chunk_idx] = false;
+        victim.layer->evictChunk(victim.chunk_idx);
+        ++evictions;
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+// ChunkCache.h - Process-wide memory budget for GridLayer chunk textures.
+//
+// Every layer's full-size chunk texture and its mip levels count against one
+// budget. Chunks are kept in least-recently-drawn order; when drawing a chunk
+// pushes the total over budget, the oldest chunks of any layer are evicted
+// (textures and geometry freed, chunk marked dirty) and re-rasterize the next
+// time they come into view. The one-pixel-per-cell overview is not counted:
+// it is bounded by 4 bytes per cell per layer.
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+
+class GridLayer;
+
+class ChunkCache {
+public:
+    struct Entry {
+        GridLayer* layer;
+        int chunk_idx;
+        size_t bytes;
+    };
+    using Slot = std::list<Entry>::iterator;
+
+    static constexpr size_t DEFAULT_BUDGET = size_t(256) << 20;  // 256 MiB
+
+    static ChunkCache& get();
+
+    size_t budget() const { return budget_bytes; }
+    // Evicts down to the new budget immediately
+    void setBudget(size_t bytes);
+
+    // Chunk chunk_idx of layer now holds `bytes` of textures and was just
+    // drawn: make it the most recent entry, then evict the least recent ones
+    // (never this one) until the total fits the budget.
+    void touch(GridLayer* layer, int chunk_idx, size_t bytes);
+
+    // The layer freed or is discarding this chunk; drop it without evicting
+    void forget(GridLayer* layer, int chunk_idx);
+
+    size_t residentBytes() const { return resident_bytes; }
+    size_t residentChunks() const { return lru.size(); }
+
+    // Running totals; renderers report the per-frame difference
+    uint64_t hits = 0;       // visible chunk drawn from a resident, unchanged texture
+    uint64_t misses = 0;     // visible chunk rasterized (new, evicted or edited)
+    uint64_t evictions = 0;
+
+private:
+    ChunkCache() = default;
+    // Evict from the back until within budget, sparing the `keep` most recent
+    void evictToBudget(size_t keep);
+
+    std::list<Entry> lru;  // front = most recently drawn
+    size_t budget_bytes = DEFAULT_BUDGET;
+    size_t resident_bytes = 0;
+};
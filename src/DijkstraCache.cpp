@@ -0,0 +1,79 @@
+// DijkstraCache.cpp - Byte-budgeted LRU cache for Dijkstra maps (see DijkstraCache.h)
+#include "DijkstraCache.h"
+#include "UIGridPathfinding.h"
+#include <cmath>
+
+size_t DijkstraCache::footprint(const DijkstraMap& map) {
+    return sizeof(DijkstraMap)
+         + map.distances().capacity() * sizeof(uint32_t)
+         + map.getRoots().capacity() * sizeof(sf::Vector2i);
+}
+
+std::shared_ptr<DijkstraMap> DijkstraCache::find(const Key& key, float diagonal_cost) {
+    auto it = entries.find(key);
+    if (it == entries.end()) {
+        counters.misses++;
+        return nullptr;
+    }
+    if (std::abs(it->second.map->getDiagonalCost() - diagonal_cost) >= 0.001f) {
+        // Same root, different movement model: the caller recomputes and replaces it.
+        counters.misses++;
+        erase(it);
+        return nullptr;
+    }
+    switch (it->second.map->refresh()) {
+        case DijkstraMap::Refresh::REPAIRED: counters.repairs++; break;
+        case DijkstraMap::Refresh::RECOMPUTED: counters.invalidations++; break;
+        case DijkstraMap::Refresh::DETACHED:
+            // The grid is gone (or the map was never attached): nothing to follow.
+            counters.misses++;
+            erase(it);
+            return nullptr;
+        case DijkstraMap::Refresh::CURRENT: break;
+    }
+    counters.hits++;
+    lru.splice(lru.begin(), lru, it->second.lru_pos);
+    return it->second.map;
+}
+
+void DijkstraCache::insert(const Key& key, std::shared_ptr<DijkstraMap> map) {
+    auto existing = entries.find(key);
+    if (existing != entries.end()) erase(existing);
+    if (!map) return;
+
+    size_t bytes = footprint(*map);
+    if (bytes > budget_bytes) return;
+
+    lru.push_front(key);
+    Entry entry;
+    entry.map = std::move(map);
+    entry.bytes = bytes;
+    entry.lru_pos = lru.begin();
+    entries.emplace(key, std::move(entry));
+    used_bytes += bytes;
+    evictToBudget();
+}
+
+void DijkstraCache::clear() {
+    entries.clear();
+    lru.clear();
+    used_bytes = 0;
+}
+
+void DijkstraCache::setBudget(size_t bytes) {
+    budget_bytes = bytes;
+    evictToBudget();
+}
+
+void DijkstraCache::erase(std::map<Key, Entry>::iterator it) {
+    used_bytes -= it->second.bytes;
+    lru.erase(it->second.lru_pos);
+    entries.erase(it);
+}
+
+void DijkstraCache::evictToBudget() {
+    while (used_bytes > budget_bytes && !lru.empty()) {
+        erase(entries.find(lru.back()));
+        counters.evictions++;
+    }
+}
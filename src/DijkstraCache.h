@@ -0,0 +1,69 @@
+#pragma once
+// DijkstraCache.h - Byte-budgeted LRU cache for single-root Dijkstra maps.
+//
+// Replaces GridData's unbounded root/label -> DijkstraMap std::map. A hit is
+// refreshed against the grid before it is returned (DijkstraMap::refresh), so
+// a stale field is never served and a few walkability edits cost a local
+// repair rather than a recompute; the LRU tail is evicted whenever the summed
+// field size exceeds the budget.
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+
+class DijkstraMap;
+
+class DijkstraCache {
+public:
+    // Key: (root_x, root_y, collide_label); collide_label="" means no collision filtering
+    using Key = std::tuple<int, int, std::string>;
+
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;      // dropped to stay within the budget
+        uint64_t invalidations = 0;  // recomputed in full because the grid changed
+        uint64_t repairs = 0;        // brought up to date by a local repair
+    };
+
+    static constexpr size_t DEFAULT_BUDGET_BYTES = size_t(64) << 20;
+
+    // The cached map for key, refreshed against its grid, or nullptr (counted
+    // as a miss). An entry computed with a different diagonal cost is erased.
+    std::shared_ptr<DijkstraMap> find(const Key& key, float diagonal_cost);
+
+    // Insert (or replace) key as most-recently-used, then evict down to budget.
+    // A map larger than the whole budget is not cached.
+    void insert(const Key& key, std::shared_ptr<DijkstraMap> map);
+
+    void clear();
+
+    void setBudget(size_t bytes);
+    size_t budget() const { return budget_bytes; }
+    size_t bytes() const { return used_bytes; }
+    size_t size() const { return entries.size(); }
+    const Stats& stats() const { return counters; }
+
+    // Approximate heap footprint of one cached map.
+    static size_t footprint(const DijkstraMap& map);
+
+private:
+    struct Entry {
+        std::shared_ptr<DijkstraMap> map;
+        size_t bytes = 0;
+        std::list<Key>::iterator lru_pos;
+    };
+
+    void erase(std::map<Key, Entry>::iterator it);
+    void evictToBudget();
+
+    std::map<Key, Entry> entries;
+    std::list<Key> lru;  // front = most recently used
+    size_t budget_bytes = DEFAULT_BUDGET_BYTES;
+    size_t used_bytes = 0;
+    Stats counters;
+};
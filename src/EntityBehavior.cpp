@@ -16,269 +16,296 @@ void EntityBehavior::reset() {
     path_step_index = 0;
     sleep_turns_remaining = 0;
     path_provider.reset();
+    generation++;  // outstanding BehaviorPlans are now stale
+}
+
+// Occupancy the entity's plan depends on: the spatial hash generation when its
+// path provider follows entity moves, else 0.
+static uint32_t providerOccupancy(const UIEntity& entity, const GridData& grid) {
+    const auto& provider = entity.behavior.path_provider;
+    return provider && provider->tracksOccupancy() ? grid.spatial_hash.generation() : 0;
+}
+
+bool BehaviorPlan::isCurrent(const UIEntity& entity, const GridData& grid) const {
+    return planned &&
+           entity.cell_position == origin &&
+           entity.behavior.type == type &&
+           entity.behavior.generation == behavior_generation &&
+           grid.transparency_generation == grid_generation &&
+           grid.walkability_generation == walkability_generation &&
+           providerOccupancy(entity, grid) == occupancy_generation;
 }
 
 // Thread-local random engine for behavior randomness
 static thread_local std::mt19937 rng{std::random_device{}()};
 
 // =============================================================================
-// Per-behavior execution functions
+// Per-behavior planning functions
+//
+// Each reads the entity's cursor from `plan` (seeded from the entity by
+// planBehavior) and writes the post-step cursor back into it. Nothing here may
+// mutate the entity or grid -- see BehaviorPlan in EntityBehavior.h.
 // =============================================================================
 
-static BehaviorOutput executeIdle(UIEntity& entity, GridData& grid) {
-    return {BehaviorResult::NO_ACTION, {}};
-}
-
-static BehaviorOutput executeCustom(UIEntity& entity, GridData& grid) {
-    // CUSTOM does nothing built-in — step callback handles everything
-    return {BehaviorResult::NO_ACTION, {}};
-}
-
-static bool isCellWalkable(GridData& grid, int x, int y) {
+static bool isCellWalkable(const GridData& grid, int x, int y) {
     if (x < 0 || x >= grid.grid_w || y < 0 || y >= grid.grid_h) return false;
     return grid.isWalkable(x, y);  // #332
 }
 
-static BehaviorOutput executeNoise(UIEntity& entity, GridData& grid, bool include_diagonals) {
+// The path the step will follow: the entity's own, until the plan replaces it.
+static const std::vector<sf::Vector2i>& plannedPath(const UIEntity& entity, const BehaviorPlan& plan) {
+    return plan.replace_path ? plan.new_path : entity.behavior.current_path;
+}
+
+static void planNoise(const UIEntity& entity, const GridData& grid, bool include_diagonals,
+                      BehaviorPlan& plan) {
     int cx = entity.cell_position.x;
     int cy = entity.cell_position.y;
 
-    // Build candidate moves
-    std::vector<sf::Vector2i> candidates;
-    // Cardinal directions
-    sf::Vector2i dirs4[] = {{0, -1}, {0, 1}, {-1, 0}, {1, 0}};
-    sf::Vector2i dirs8[] = {{0, -1}, {0, 1}, {-1, 0}, {1, 0},
-                            {-1, -1}, {1, -1}, {-1, 1}, {1, 1}};
-
-    auto* dirs = include_diagonals ? dirs8 : dirs4;
+    // Cardinal directions first, then diagonals
+    static const sf::Vector2i dirs[] = {{0, -1}, {0, 1}, {-1, 0}, {1, 0},
+                                        {-1, -1}, {1, -1}, {-1, 1}, {1, 1}};
     int count = include_diagonals ? 8 : 4;
 
+    plan.noise = true;
+    plan.noise_count = 0;
     for (int i = 0; i < count; i++) {
         int nx = cx + dirs[i].x;
         int ny = cy + dirs[i].y;
         if (isCellWalkable(grid, nx, ny)) {
-            candidates.push_back({nx, ny});
+            plan.noise_candidates[plan.noise_count++] = {nx, ny};
         }
     }
+    // Output is resolved in commitBehavior(), which owns the RNG draw.
+}
 
-    if (candidates.empty()) {
-        return {BehaviorResult::NO_ACTION, {}};
+static void planPath(const UIEntity& entity, const GridData& grid, BehaviorPlan& plan) {
+    const auto& path = entity.behavior.current_path;
+
+    if (plan.path_step_index >= static_cast<int>(path.size())) {
+        plan.output = {BehaviorResult::DONE, {}};
+        return;
     }
 
-    std::uniform_int_distribution<int> dist(0, candidates.size() - 1);
-    auto target = candidates[dist(rng)];
-    return {BehaviorResult::MOVED, target};
+    auto target = path[plan.path_step_index];
+    plan.path_step_index++;
+
+    if (!isCellWalkable(grid, target.x, target.y)) {
+        plan.output = {BehaviorResult::BLOCKED, target};
+        return;
+    }
+
+    plan.output = {BehaviorResult::MOVED, target};
 }
 
-static BehaviorOutput executePath(UIEntity& entity, GridData& grid) {
-    auto& behavior = entity.behavior;
+// Drop the cached leg so planFollowWaypoints() computes a fresh one.
+static void planClearPath(BehaviorPlan& plan) {
+    plan.replace_path = true;
+    plan.new_path.clear();
+    plan.path_step_index = 0;
+}
 
-    if (behavior.path_step_index >= static_cast<int>(behavior.current_path.size())) {
-        return {BehaviorResult::DONE, {}};
+// Shared tail of WAYPOINT/PATROL/LOOP: compute the A* leg toward the current
+// waypoint if the cached one is used up, then take one step along it.
+static void planFollowWaypoints(const UIEntity& entity, const GridData& grid, BehaviorPlan& plan) {
+    const auto& behavior = entity.behavior;
+    const auto* path = &plannedPath(entity, plan);
+
+    if (path->empty() || plan.path_step_index >= static_cast<int>(path->size())) {
+        auto& target_wp = behavior.waypoints[plan.current_waypoint_index];
+        // Use grid pathfinding (A*). PathEngine only reads the walkable plane.
+        planClearPath(plan);
+        PathEngine::findPath(PathEngine::Terrain::fromGrid(grid), PathEngine::StepCosts::fromDiagonal(1.41f),
+                             entity.cell_position, target_wp,
+                             PathEngine::Heuristic::EUCLIDEAN, 1.0f, plan.new_path);
+        path = &plan.new_path;
+
+        if (path->empty()) {
+            plan.output = {BehaviorResult::BLOCKED, target_wp};
+            return;
+        }
     }
 
-    auto target = behavior.current_path[behavior.path_step_index];
-    behavior.path_step_index++;
+    // Follow the path
+    auto target = (*path)[plan.path_step_index];
+    plan.path_step_index++;
 
     if (!isCellWalkable(grid, target.x, target.y)) {
-        return {BehaviorResult::BLOCKED, target};
+        plan.output = {BehaviorResult::BLOCKED, target};
+        return;
     }
 
-    return {BehaviorResult::MOVED, target};
+    plan.output = {BehaviorResult::MOVED, target};
 }
 
-static BehaviorOutput executeWaypoint(UIEntity& entity, GridData& grid) {
-    auto& behavior = entity.behavior;
+static void planWaypoint(const UIEntity& entity, const GridData& grid, BehaviorPlan& plan) {
+    const auto& behavior = entity.behavior;
 
     if (behavior.waypoints.empty()) {
-        return {BehaviorResult::DONE, {}};
+        plan.output = {BehaviorResult::DONE, {}};
+        return;
     }
 
     // If we've reached the current waypoint, advance to next
-    auto& wp = behavior.waypoints[behavior.current_waypoint_index];
+    auto& wp = behavior.waypoints[plan.current_waypoint_index];
     if (entity.cell_position.x == wp.x && entity.cell_position.y == wp.y) {
-        behavior.current_waypoint_index++;
-        if (behavior.current_waypoint_index >= static_cast<int>(behavior.waypoints.size())) {
-            return {BehaviorResult::DONE, {}};
+        plan.current_waypoint_index++;
+        if (plan.current_waypoint_index >= static_cast<int>(behavior.waypoints.size())) {
+            plan.output = {BehaviorResult::DONE, {}};
+            return;
         }
         // Clear path to recompute for new waypoint
-        behavior.current_path.clear();
-        behavior.path_step_index = 0;
-    }
-
-    // Compute path to current waypoint if needed
-    if (behavior.current_path.empty() || behavior.path_step_index >= static_cast<int>(behavior.current_path.size())) {
-        auto& target_wp = behavior.waypoints[behavior.current_waypoint_index];
-        // Use grid pathfinding (A*)
-        TCODPath path(grid.getTCODMap());
-        path.compute(entity.cell_position.x, entity.cell_position.y, target_wp.x, target_wp.y);
-
-        behavior.current_path.clear();
-        behavior.path_step_index = 0;
-        int px, py;
-        while (path.walk(&px, &py, true)) {
-            behavior.current_path.push_back({px, py});
-        }
-
-        if (behavior.current_path.empty()) {
-            return {BehaviorResult::BLOCKED, target_wp};
-        }
+        planClearPath(plan);
     }
 
-    // Follow the path
-    auto target = behavior.current_path[behavior.path_step_index];
-    behavior.path_step_index++;
-
-    if (!isCellWalkable(grid, target.x, target.y)) {
-        return {BehaviorResult::BLOCKED, target};
-    }
-
-    return {BehaviorResult::MOVED, target};
+    planFollowWaypoints(entity, grid, plan);
 }
 
-static BehaviorOutput executePatrol(UIEntity& entity, GridData& grid) {
-    auto& behavior = entity.behavior;
+static void planPatrol(const UIEntity& entity, const GridData& grid, BehaviorPlan& plan) {
+    const auto& behavior = entity.behavior;
 
     if (behavior.waypoints.empty()) {
-        return {BehaviorResult::NO_ACTION, {}};
+        plan.output = {BehaviorResult::NO_ACTION, {}};
+        return;
     }
 
     // Check if at current waypoint
-    auto& wp = behavior.waypoints[behavior.current_waypoint_index];
+    auto& wp = behavior.waypoints[plan.current_waypoint_index];
     if (entity.cell_position.x == wp.x && entity.cell_position.y == wp.y) {
-        int next = behavior.current_waypoint_index + behavior.patrol_direction;
+        int next = plan.current_waypoint_index + plan.patrol_direction;
         if (next < 0 || next >= static_cast<int>(behavior.waypoints.size())) {
-            behavior.patrol_direction *= -1;
-            next = behavior.current_waypoint_index + behavior.patrol_direction;
+            plan.patrol_direction *= -1;
+            next = plan.current_waypoint_index + plan.patrol_direction;
         }
-        behavior.current_waypoint_index = next;
-        behavior.current_path.clear();
-        behavior.path_step_index = 0;
+        plan.current_waypoint_index = next;
+        planClearPath(plan);
     }
 
-    // Same path-following logic as waypoint
-    if (behavior.current_path.empty() || behavior.path_step_index >= static_cast<int>(behavior.current_path.size())) {
-        auto& target_wp = behavior.waypoints[behavior.current_waypoint_index];
-        TCODPath path(grid.getTCODMap());
-        path.compute(entity.cell_position.x, entity.cell_position.y, target_wp.x, target_wp.y);
-
-        behavior.current_path.clear();
-        behavior.path_step_index = 0;
-        int px, py;
-        while (path.walk(&px, &py, true)) {
-            behavior.current_path.push_back({px, py});
-        }
-
-        if (behavior.current_path.empty()) {
-            return {BehaviorResult::BLOCKED, target_wp};
-        }
-    }
-
-    auto target = behavior.current_path[behavior.path_step_index];
-    behavior.path_step_index++;
-
-    if (!isCellWalkable(grid, target.x, target.y)) {
-        return {BehaviorResult::BLOCKED, target};
-    }
-
-    return {BehaviorResult::MOVED, target};
+    planFollowWaypoints(entity, grid, plan);
 }
 
-static BehaviorOutput executeLoop(UIEntity& entity, GridData& grid) {
-    auto& behavior = entity.behavior;
+static void planLoop(const UIEntity& entity, const GridData& grid, BehaviorPlan& plan) {
+    const auto& behavior = entity.behavior;
 
     if (behavior.waypoints.empty()) {
-        return {BehaviorResult::NO_ACTION, {}};
+        plan.output = {BehaviorResult::NO_ACTION, {}};
+        return;
     }
 
     // Check if at current waypoint
-    auto& wp = behavior.waypoints[behavior.current_waypoint_index];
+    auto& wp = behavior.waypoints[plan.current_waypoint_index];
     if (entity.cell_position.x == wp.x && entity.cell_position.y == wp.y) {
-        behavior.current_waypoint_index = (behavior.current_waypoint_index + 1) % behavior.waypoints.size();
-        behavior.current_path.clear();
-        behavior.path_step_index = 0;
-    }
-
-    // Same path-following logic
-    if (behavior.current_path.empty() || behavior.path_step_index >= static_cast<int>(behavior.current_path.size())) {
-        auto& target_wp = behavior.waypoints[behavior.current_waypoint_index];
-        TCODPath path(grid.getTCODMap());
-        path.compute(entity.cell_position.x, entity.cell_position.y, target_wp.x, target_wp.y);
-
-        behavior.current_path.clear();
-        behavior.path_step_index = 0;
-        int px, py;
-        while (path.walk(&px, &py, true)) {
-            behavior.current_path.push_back({px, py});
-        }
-
-        if (behavior.current_path.empty()) {
-            return {BehaviorResult::BLOCKED, target_wp};
-        }
-    }
-
-    auto target = behavior.current_path[behavior.path_step_index];
-    behavior.path_step_index++;
-
-    if (!isCellWalkable(grid, target.x, target.y)) {
-        return {BehaviorResult::BLOCKED, target};
+        plan.current_waypoint_index = (plan.current_waypoint_index + 1) % behavior.waypoints.size();
+        planClearPath(plan);
     }
 
-    return {BehaviorResult::MOVED, target};
+    planFollowWaypoints(entity, grid, plan);
 }
 
-static BehaviorOutput executeSleep(UIEntity& entity, GridData& grid) {
-    auto& behavior = entity.behavior;
-
-    if (behavior.sleep_turns_remaining > 0) {
-        behavior.sleep_turns_remaining--;
-        if (behavior.sleep_turns_remaining == 0) {
-            return {BehaviorResult::DONE, {}};
+static void planSleep(BehaviorPlan& plan) {
+    if (plan.sleep_turns_remaining > 0) {
+        plan.sleep_turns_remaining--;
+        if (plan.sleep_turns_remaining == 0) {
+            plan.output = {BehaviorResult::DONE, {}};
+            return;
         }
     }
-    return {BehaviorResult::NO_ACTION, {}};
+    plan.output = {BehaviorResult::NO_ACTION, {}};
 }
 
 // SEEK and FLEE share one implementation now: both delegate to the active
 // PathProvider. FLEE differs only in which map is stored in the provider -
 // DijkstraProvider over an inverted DijkstraMap descends away from the threat,
 // which matches the old max-distance-neighbor behavior.
-static BehaviorOutput executeProviderStep(UIEntity& entity, GridData& grid) {
-    auto& behavior = entity.behavior;
+static void planProviderStep(const UIEntity& entity, const GridData& grid, BehaviorPlan& plan) {
+    const auto& behavior = entity.behavior;
     if (!behavior.path_provider) {
-        return {BehaviorResult::NO_ACTION, {}};
+        plan.output = {BehaviorResult::NO_ACTION, {}};
+        return;
     }
 
     int cx = entity.cell_position.x;
     int cy = entity.cell_position.y;
     bool ok = false;
-    sf::Vector2i next = behavior.path_provider->nextStep({cx, cy}, grid, &ok);
+    sf::Vector2i next = behavior.path_provider->peekStep({cx, cy}, grid, &ok);
+    plan.advance_provider = ok;  // nextStep() consumes every valid step
 
     if (!ok) {
-        return {BehaviorResult::BLOCKED, {cx, cy}};
+        plan.output = {BehaviorResult::BLOCKED, {cx, cy}};
+        return;
     }
     if (next.x == cx && next.y == cy) {
-        return {BehaviorResult::BLOCKED, {cx, cy}};
+        plan.output = {BehaviorResult::BLOCKED, {cx, cy}};
+        return;
     }
-    return {BehaviorResult::MOVED, next};
+    plan.output = {BehaviorResult::MOVED, next};
 }
 
 // =============================================================================
 // Main dispatch
 // =============================================================================
-BehaviorOutput executeBehavior(UIEntity& entity, GridData& grid) {
-    switch (entity.behavior.type) {
-        case BehaviorType::IDLE:     return executeIdle(entity, grid);
-        case BehaviorType::CUSTOM:   return executeCustom(entity, grid);
-        case BehaviorType::NOISE4:   return executeNoise(entity, grid, false);
-        case BehaviorType::NOISE8:   return executeNoise(entity, grid, true);
-        case BehaviorType::PATH:     return executePath(entity, grid);
-        case BehaviorType::WAYPOINT: return executeWaypoint(entity, grid);
-        case BehaviorType::PATROL:   return executePatrol(entity, grid);
-        case BehaviorType::LOOP:     return executeLoop(entity, grid);
-        case BehaviorType::SLEEP:    return executeSleep(entity, grid);
-        case BehaviorType::SEEK:     return executeProviderStep(entity, grid);
-        case BehaviorType::FLEE:     return executeProviderStep(entity, grid);
+BehaviorPlan planBehavior(const UIEntity& entity, const GridData& grid) {
+    const auto& behavior = entity.behavior;
+
+    BehaviorPlan plan;
+    plan.origin = entity.cell_position;
+    plan.type = behavior.type;
+    plan.behavior_generation = behavior.generation;
+    plan.grid_generation = grid.transparency_generation;
+    plan.walkability_generation = grid.walkability_generation;
+    plan.occupancy_generation = providerOccupancy(entity, grid);
+    plan.planned = true;
+    plan.current_waypoint_index = behavior.current_waypoint_index;
+    plan.patrol_direction = behavior.patrol_direction;
+    plan.path_step_index = behavior.path_step_index;
+    plan.sleep_turns_remaining = behavior.sleep_turns_remaining;
+
+    switch (behavior.type) {
+        case BehaviorType::IDLE:     break;  // NO_ACTION
+        case BehaviorType::CUSTOM:   break;  // step callback handles everything
+        case BehaviorType::NOISE4:   planNoise(entity, grid, false, plan); break;
+        case BehaviorType::NOISE8:   planNoise(entity, grid, true, plan); break;
+        case BehaviorType::PATH:     planPath(entity, grid, plan); break;
+        case BehaviorType::WAYPOINT: planWaypoint(entity, grid, plan); break;
+        case BehaviorType::PATROL:   planPatrol(entity, grid, plan); break;
+        case BehaviorType::LOOP:     planLoop(entity, grid, plan); break;
+        case BehaviorType::SLEEP:    planSleep(plan); break;
+        case BehaviorType::SEEK:     planProviderStep(entity, grid, plan); break;
+        case BehaviorType::FLEE:     planProviderStep(entity, grid, plan); break;
+    }
+    return plan;
+}
+
+BehaviorOutput commitBehavior(UIEntity& entity, BehaviorPlan& plan) {
+    auto& behavior = entity.behavior;
+
+    behavior.current_waypoint_index = plan.current_waypoint_index;
+    behavior.patrol_direction = plan.patrol_direction;
+    behavior.path_step_index = plan.path_step_index;
+    behavior.sleep_turns_remaining = plan.sleep_turns_remaining;
+    if (plan.replace_path) {
+        behavior.current_path = std::move(plan.new_path);
+        plan.replace_path = false;
     }
-    return {BehaviorResult::NO_ACTION, {}};
+    if (plan.advance_provider && behavior.path_provider) {
+        behavior.path_provider->advance();
+    }
+
+    if (plan.noise) {
+        if (plan.noise_count == 0) {
+            plan.output = {BehaviorResult::NO_ACTION, {}};
+        } else {
+            std::uniform_int_distribution<int> dist(0, plan.noise_count - 1);
+            plan.output = {BehaviorResult::MOVED, plan.noise_candidates[dist(rng)]};
+        }
+    }
+
+    plan.planned = false;  // a plan commits at most once
+    return plan.output;
+}
+
+BehaviorOutput executeBehavior(UIEntity& entity, GridData& grid) {
+    if (entity.behavior.path_provider) entity.behavior.path_provider->refresh(entity.cell_position, grid);
+    BehaviorPlan plan = planBehavior(entity, grid);
+    return commitBehavior(entity, plan);
 }
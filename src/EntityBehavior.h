@@ -64,11 +64,65 @@ struct EntityBehavior {
     // SEEK/FLEE pathfinding strategy (#315). Nullptr means NO_ACTION.
     std::unique_ptr<PathProvider> path_provider;
 
+    // Bumped by every reset() (i.e. every set_behavior()). A BehaviorPlan made
+    // against an older generation describes a behavior that no longer exists.
+    uint32_t generation = 0;
+
     // Defined in EntityBehavior.cpp to avoid needing the full PathProvider type here.
     void reset();
 };
 
+// =============================================================================
+// BehaviorPlan - the side-effect-free half of one behavior step
+//
+// planBehavior() records what a step WOULD do -- the output plus the cursor
+// state it leaves behind -- without mutating the entity, the grid, or the
+// provider. grid.step(parallel=True) plans every entity on worker threads with
+// the GIL released, then commits the plans in turn order on the main thread.
+// A plan preempted by a TARGET trigger is simply dropped.
+// =============================================================================
+struct BehaviorPlan {
+    BehaviorOutput output;
+
+    // Inputs the plan was made against (see isCurrent()). A Python callback
+    // fired earlier in the round may move the entity, replace its behavior, or
+    // edit walkability; any of those makes the plan stale. So does any entity
+    // move when the path provider follows occupancy (a collide-label map).
+    sf::Vector2i origin{0, 0};
+    BehaviorType type = BehaviorType::IDLE;
+    uint32_t behavior_generation = 0;
+    uint32_t grid_generation = 0;
+    uint32_t walkability_generation = 0;
+    uint32_t occupancy_generation = 0;  // 0 unless the provider tracks occupancy
+    bool planned = false;
+
+    // Cursor state after the step.
+    int current_waypoint_index = 0;
+    int patrol_direction = 1;
+    int path_step_index = 0;
+    int sleep_turns_remaining = 0;
+    bool replace_path = false;          // current_path = std::move(new_path)
+    std::vector<sf::Vector2i> new_path;
+    bool advance_provider = false;      // path_provider->advance()
+
+    // NOISE4/NOISE8: only the walkable candidates are planned. The random pick
+    // happens at commit so the main thread's RNG is consumed in turn order,
+    // exactly as in a serial step.
+    bool noise = false;
+    int noise_count = 0;
+    sf::Vector2i noise_candidates[8];
+
+    // True if the entity and grid still match what the plan was made against.
+    bool isCurrent(const UIEntity& entity, const GridData& grid) const;
+};
+
 // =============================================================================
 // Behavior execution - does NOT modify entity position, just returns intent
 // =============================================================================
+// planBehavior() is safe to call concurrently for DIFFERENT entities on the
+// same grid (it only reads). commitBehavior() must run on the main thread.
+BehaviorPlan planBehavior(const UIEntity& entity, const GridData& grid);
+BehaviorOutput commitBehavior(UIEntity& entity, BehaviorPlan& plan);
+
+// Serial convenience: refresh the path provider, plan, commit.
 BehaviorOutput executeBehavior(UIEntity& entity, GridData& grid);
@@ -0,0 +1,383 @@
+// FOVEngine.cpp - Windowed, thread-safe field of view (see FOVEngine.h)
+#include "FOVEngine.h"
+#include "GridData.h"
+#include "WorkerPool.h"
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace FOVEngine {
+
+void VisibilityMask::reset(int x0, int y0, int width, int height) {
+    ox = x0;
+    oy = y0;
+    w = std::max(0, width);
+    h = std::max(0, height);
+    words.assign((static_cast<size_t>(w) * h + 63) >> 6, 0);
+}
+
+void VisibilityMask::setSpan(int y, int xa, int xb) {
+    size_t first = static_cast<size_t>(y - oy) * w + (xa - ox);
+    size_t last = first + (xb - xa);
+    size_t fw = first >> 6, lw = last >> 6;
+    uint64_t head = ~uint64_t(0) << (first & 63);
+    uint64_t tail = ~uint64_t(0) >> (63 - (last & 63));
+    if (fw == lw) {
+        words[fw] |= head & tail;
+        return;
+    }
+    words[fw] |= head;
+    for (size_t i = fw + 1; i < lw; i++) words[i] = ~uint64_t(0);
+    words[lw] |= tail;
+}
+
+size_t VisibilityMask::count() const {
+    size_t n = 0;
+    for (uint64_t word : words) n += std::popcount(word);
+    return n;
+}
+
+namespace {
+
+// Window of the grid a query may touch: the radius box plus a one-cell margin
+// (light_walls may light a wall on the box edge), or the whole grid.
+struct Window {
+    int x0, y0, w, h;
+};
+
+Window windowFor(const GridData& grid, const Origin& origin) {
+    if (origin.radius <= 0) return {0, 0, grid.grid_w, grid.grid_h};
+    int x0 = std::max(0, origin.x - origin.radius - 1);
+    int y0 = std::max(0, origin.y - origin.radius - 1);
+    int x1 = std::min(grid.grid_w, origin.x + origin.radius + 2);
+    int y1 = std::min(grid.grid_h, origin.y + origin.radius + 2);
+    return {x0, y0, x1 - x0, y1 - y0};
+}
+
+// =============================================================================
+// libtcod algorithms on a per-thread scratch map
+// =============================================================================
+
+// Per-thread libtcod map sized to the last window. Interior origins with the
+// same radius share a window size, so it is only reallocated near grid edges
+// or when the radius changes.
+struct TCODScratch {
+    std::unique_ptr<TCODMap> map;
+    int width = 0;
+    int height = 0;
+
+    TCODMap& sized(int w, int h) {
+        if (!map || width != w || height != h) {
+            map = std::make_unique<TCODMap>(w, h);
+            width = w;
+            height = h;
+        }
+        return *map;
+    }
+};
+
+thread_local TCODScratch tcod_scratch;
+
+void computeTCOD(const GridData& grid, const Origin& origin, const Window& win, VisibilityMask& out) {
+    TCODMap& map = tcod_scratch.sized(win.w, win.h);
+    for (int ly = 0; ly < win.h; ly++) {
+        size_t row = static_cast<size_t>(win.y0 + ly) * grid.grid_w + win.x0;
+        const uint8_t* transparent = grid.transparent_plane.data() + row;
+        const uint8_t* walkable = grid.walkable_plane.data() + row;
+        for (int lx = 0; lx < win.w; lx++) {
+            map.setProperties(lx, ly, transparent[lx] != 0, walkable[lx] != 0);
+        }
+    }
+    map.computeFov(origin.x - win.x0, origin.y - win.y0, origin.radius,
+                   origin.light_walls, origin.algorithm);
+
+    out.reset(win.x0, win.y0, win.w, win.h);
+    for (int ly = 0; ly < win.h; ly++) {
+        for (int lx = 0; lx < win.w; lx++) {
+            if (map.isInFov(lx, ly)) out.set(win.x0 + lx, win.y0 + ly);
+        }
+    }
+}
+
+// =============================================================================
+// Native shadowcasting on opacity bitplanes
+//
+// Symmetric shadowcasting (Albert Ford's formulation) scans each quadrant row
+// by row. A row is handled as runs of equal opacity found with word-wide bit
+// scans rather than cell by cell, so open areas cost a few operations per row.
+// The window's opacity is packed into bitplanes twice: row-major for the
+// north/south quadrants and column-major (a bit transpose of the first) for
+// east/west, so every quadrant row is a contiguous bit range.
+// =============================================================================
+
+// Bit i of out[] = (bytes[i] == 0), i.e. opaque, for i in [0, n). The bits of
+// the last word past n are cleared.
+void packOpaque(const uint8_t* bytes, int n, uint64_t* out) {
+    int i = 0;
+    for (; i + 64 <= n; i += 64) {
+#if defined(__AVX2__)
+        const __m256i zero = _mm256_setzero_si256();
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + i));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + i + 32));
+        uint64_t lo = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, zero)));
+        uint64_t hi = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(b, zero)));
+        out[i >> 6] = lo | (hi << 32);
+#elif defined(__SSE2__)
+        const __m128i zero = _mm_setzero_si128();
+        uint64_t word = 0;
+        for (int k = 0; k < 4; k++) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i + 16 * k));
+            word |= static_cast<uint64_t>(
+                static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero)))) << (16 * k);
+        }
+        out[i >> 6] = word;
+#else
+        uint64_t word = 0;
+        for (int k = 0; k < 64; k++) word |= static_cast<uint64_t>(bytes[i + k] == 0) << k;
+        out[i >> 6] = word;
+#endif
+    }
+    if (i < n) {
+        uint64_t word = 0;
+        for (int k = 0; i + k < n; k++) word |= static_cast<uint64_t>(bytes[i + k] == 0) << k;
+        out[i >> 6] = word;
+    }
+}
+
+// Transpose an 8x8 bit matrix held one row per byte (Hacker's Delight 7-3).
+inline uint64_t transpose8(uint64_t x) {
+    uint64_t t;
+    t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAull;  x ^= t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCull; x ^= t ^ (t << 14);
+    t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ull; x ^= t ^ (t << 28);
+    return x;
+}
+
+// Slope as an exact fraction (den > 0); rows never need more than 64 bits.
+struct Slope {
+    int64_t num;
+    int64_t den;
+};
+
+inline int64_t floorDiv(int64_t a, int64_t b) {
+    int64_t q = a / b;
+    return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+}
+inline int64_t ceilDiv(int64_t a, int64_t b) { return -floorDiv(-a, b); }
+
+struct Row {
+    int depth;
+    Slope start;
+    Slope end;
+};
+
+// One line of a quadrant: bits for columns [-offset, len - offset). Columns
+// outside the window read as opaque.
+struct Line {
+    const uint64_t* bits;
+    int len;
+    int offset;
+
+    bool opaque(int col) const {
+        int i = col + offset;
+        return i < 0 || i >= len || ((bits[i >> 6] >> (i & 63)) & 1u);
+    }
+
+    // Last column in [col, max_col] with the same opacity as `col`.
+    int runEnd(int col, int max_col, bool wall) const {
+        int i = col + offset;
+        const int last = max_col + offset;
+        if (i < 0) {
+            // Only walls lie left of the window.
+            if (last < 0) return max_col;
+            i = 0;
+            if (!opaque(i - offset)) return -offset - 1;
+        }
+        while (i <= last) {
+            if (i >= len) return wall ? max_col : i - 1 - offset;
+            const int bit = i & 63;
+            uint64_t word = bits[i >> 6];
+            uint64_t differ = (wall ? ~word : word) >> bit;
+            // Pad bits past len are opaque, which a wall run simply continues.
+            if (differ) {
+                int pos = i + std::countr_zero(differ);
+                return std::min(pos, last + 1) - 1 - offset;
+            }
+            i += 64 - bit;
+        }
+        return max_col;
+    }
+};
+
+struct ShadowScratch {
+    std::vector<uint64_t> rows;     // row-major opacity, row_words per row
+    std::vector<uint64_t> cols;     // column-major opacity, col_words per column
+    std::vector<Row> stack;
+    std::vector<int> reach;         // reach[d]: widest |col| inside the radius at depth d
+};
+
+thread_local ShadowScratch shadow_scratch;
+
+void buildPlanes(const GridData& grid, const Window& win, ShadowScratch& s,
+                 size_t& row_words, size_t& col_words) {
+    row_words = (static_cast<size_t>(win.w) + 63) >> 6;
+    col_words = (static_cast<size_t>(win.h) + 63) >> 6;
+
+    s.rows.assign(row_words * win.h, 0);
+    const uint64_t row_pad = (win.w & 63) ? ~uint64_t(0) << (win.w & 63) : 0;
+    for (int ly = 0; ly < win.h; ly++) {
+        uint64_t* dst = s.rows.data() + ly * row_words;
+        packOpaque(grid.transparent_plane.data() + static_cast<size_t>(win.y0 + ly) * grid.grid_w + win.x0,
+                   win.w, dst);
+        dst[row_words - 1] |= row_pad;
+    }
+
+    // Column plane by 8x8 bit-block transposes of the row plane. Rows past the
+    // window transpose as all-opaque, so the column pad bits come out set.
+    s.cols.assign(col_words * win.w, ~uint64_t(0));
+    const auto* rb = reinterpret_cast<const uint8_t*>(s.rows.data());
+    auto* cb = reinterpret_cast<uint8_t*>(s.cols.data());
+    const size_t row_bytes = row_words * 8, col_bytes = col_words * 8;
+    const int blocks_x = (win.w + 7) >> 3, blocks_y = (win.h + 7) >> 3;
+    for (int by = 0; by < blocks_y; by++) {
+        for (int bx = 0; bx < blocks_x; bx++) {
+            uint64_t block = 0;
+            for (int k = 0; k < 8; k++) {
+                int ly = by * 8 + k;
+                uint64_t byte = ly < win.h ? rb[ly * row_bytes + bx] : 0xFF;
+                block |= byte << (8 * k);
+            }
+            block = transpose8(block);
+            for (int j = 0; j < 8; j++) {
+                int lx = bx * 8 + j;
+                if (lx < win.w) cb[lx * col_bytes + by] = static_cast<uint8_t>(block >> (8 * j));
+            }
+        }
+    }
+}
+
+void computeShadowcast(const GridData& grid, const Origin& origin, const Window& win, VisibilityMask& out) {
+    ShadowScratch& s = shadow_scratch;
+    size_t row_words, col_words;
+    buildPlanes(grid, win, s, row_words, col_words);
+
+    out.reset(win.x0, win.y0, win.w, win.h);
+    out.set(origin.x, origin.y);
+
+    const bool symmetric = origin.algorithm == NATIVE_SYMMETRIC;
+    const int r = origin.radius;
+    const int lx0 = origin.x - win.x0, ly0 = origin.y - win.y0;
+
+    if (r > 0) {
+        s.reach.resize(r + 1);
+        for (int d = 0; d <= r; d++) {
+            int c = static_cast<int>(std::sqrt(static_cast<double>(r) * r - static_cast<double>(d) * d));
+            while (c * c + d * d > r * r) c--;
+            while ((c + 1) * (c + 1) + d * d <= r * r) c++;
+            s.reach[d] = c;
+        }
+    }
+
+    // Quadrants: 0 north, 1 south (rows of the row plane), 2 east, 3 west
+    // (columns of the column plane). A column c of depth d maps to
+    // (x + c, y -/+ d) or (x +/- d, y + c).
+    for (int q = 0; q < 4; q++) {
+        const bool vertical = q < 2;
+        const int sign = (q == 0 || q == 3) ? -1 : 1;
+        const int along0 = vertical ? ly0 : lx0;          // origin along the depth axis
+        const int across0 = vertical ? lx0 : ly0;         // origin along the columns
+        const int depth_limit_window = sign < 0 ? along0 : (vertical ? win.h : win.w) - 1 - along0;
+        const int max_depth = r > 0 ? std::min(r, depth_limit_window) : depth_limit_window;
+        if (max_depth < 1) continue;
+
+        auto lineAt = [&](int d) {
+            int along = along0 + sign * d;
+            if (vertical) return Line{s.rows.data() + along * row_words, win.w, across0};
+            return Line{s.cols.data() + along * col_words, win.h, across0};
+        };
+        auto reveal = [&](int d, int ca, int cb) {
+            if (r > 0) {
+                ca = std::max(ca, -s.reach[d]);
+                cb = std::min(cb, s.reach[d]);
+            }
+            const int span = vertical ? win.w : win.h;
+            ca = std::max(ca, -across0);
+            cb = std::min(cb, span - 1 - across0);
+            if (ca > cb) return;
+            if (vertical) {
+                out.setSpan(origin.y + sign * d, origin.x + ca, origin.x + cb);
+            } else {
+                const int x = origin.x + sign * d;
+                for (int c = ca; c <= cb; c++) out.set(x, origin.y + c);
+            }
+        };
+
+        s.stack.clear();
+        s.stack.push_back({1, {-1, 1}, {1, 1}});
+        while (!s.stack.empty()) {
+            Row row = s.stack.back();
+            s.stack.pop_back();
+            const int d = row.depth;
+            // Columns whose centre-ray band the row's slopes cover.
+            int min_col = static_cast<int>(floorDiv(2 * d * row.start.num + row.start.den, 2 * row.start.den));
+            int max_col = static_cast<int>(ceilDiv(2 * d * row.end.num - row.end.den, 2 * row.end.den));
+            if (min_col > max_col) continue;
+
+            const Line line = lineAt(d);
+            const bool can_descend = d < max_depth;
+            int prev = -1;  // -1 none, 0 floor, 1 wall
+            for (int c = min_col; c <= max_col;) {
+                const bool wall = line.opaque(c);
+                const int end = line.runEnd(c, max_col, wall);
+                if (wall) {
+                    if (origin.light_walls) reveal(d, c, end);
+                    if (prev == 0 && can_descend) {
+                        s.stack.push_back({d + 1, row.start, {2 * c - 1, 2 * d}});
+                    }
+                } else {
+                    if (prev == 1) row.start = {2 * c - 1, 2 * d};
+                    int a = c, b = end;
+                    if (symmetric) {
+                        // Only floors whose centre lies inside the row's slopes.
+                        a = std::max(a, static_cast<int>(ceilDiv(d * row.start.num, row.start.den)));
+                        b = std::min(b, static_cast<int>(floorDiv(d * row.end.num, row.end.den)));
+                    }
+                    if (a <= b) reveal(d, a, b);
+                }
+                prev = wall ? 1 : 0;
+                c = end + 1;
+            }
+            if (prev == 0 && can_descend) s.stack.push_back({d + 1, row.start, row.end});
+        }
+    }
+}
+
+} // namespace
+
+void compute(const GridData& grid, const Origin& origin, VisibilityMask& out) {
+    const int gw = grid.grid_w, gh = grid.grid_h;
+    if (origin.x < 0 || origin.x >= gw || origin.y < 0 || origin.y >= gh ||
+        grid.transparent_plane.size() != static_cast<size_t>(gw) * gh) {
+        out.clear();
+        return;
+    }
+
+    const Window win = windowFor(grid, origin);
+    if (isNative(origin.algorithm)) {
+        computeShadowcast(grid, origin, win, out);
+    } else {
+        computeTCOD(grid, origin, win, out);
+    }
+}
+
+void computeBatch(const GridData& grid, const Origin* origins, size_t count, VisibilityMask* out) {
+    WorkerPool::instance().parallelFor(count, 16, [&](size_t begin, size_t end, unsigned) {
+        for (size_t i = begin; i < end; i++) compute(grid, origins[i], out[i]);
+    });
+}
+
+} // namespace FOVEngine
@@ -0,0 +1,132 @@
+#pragma once
+// FOVEngine.h - Field of view for many origins without the shared TCODMap.
+//
+// libtcod writes FOV results into the map it runs on, so GridData used to
+// serialize every query through grid.tcod_map under fov_mutex and callers then
+// copied the answer out cell by cell. This module instead runs each query on a
+// per-thread scratch TCODMap that covers only the origin's radius window,
+// filled from GridData::transparent_plane / walkable_plane, and returns the
+// result as a packed bitset. Nothing here touches Python or mutates the grid,
+// so queries for different origins may run concurrently on worker threads.
+//
+// The window is the radius box around the origin (plus a one-cell margin)
+// clamped to the grid, which is exactly the region libtcod's algorithms scan
+// for a positive radius, so results match a whole-grid computeFov. A radius
+// of 0 or less means unlimited, as in libtcod, and uses the whole grid.
+//
+// Two native algorithms skip libtcod entirely: shadowcasting over opacity
+// bitplanes packed straight from transparent_plane (SSE2/AVX2 when the build
+// targets them, scalar otherwise), scanning each row as runs of equal opacity
+// and emitting whole row spans of visible bits.
+
+#include <libtcod.h>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class GridData;
+
+namespace FOVEngine {
+
+// Native algorithms, numbered after libtcod's so they travel in the same
+// TCOD_fov_algorithm_t (and the same mcrfpy.FOV enum). They never reach
+// libtcod.
+//   NATIVE_SYMMETRIC: symmetric shadowcasting - a floor is visible only if
+//     its centre is, so A sees B exactly when B sees A. Walls are lit.
+//   NATIVE_FAST: the same scan without the centre test (every floor the
+//     light band touches is lit); cheaper and slightly more permissive.
+constexpr TCOD_fov_algorithm_t NATIVE_SYMMETRIC = static_cast<TCOD_fov_algorithm_t>(NB_FOV_ALGORITHMS);
+constexpr TCOD_fov_algorithm_t NATIVE_FAST = static_cast<TCOD_fov_algorithm_t>(NB_FOV_ALGORITHMS + 1);
+constexpr int ALGORITHM_COUNT = NB_FOV_ALGORITHMS + 2;
+
+inline bool isNative(TCOD_fov_algorithm_t algorithm) {
+    return algorithm == NATIVE_SYMMETRIC || algorithm == NATIVE_FAST;
+}
+
+// Visibility over a rectangular window of the grid, one bit per cell
+// (row-major within the window). Cells outside the window are not visible.
+class VisibilityMask {
+public:
+    // Empty the mask and make it cover [x0, x0+width) x [y0, y0+height).
+    void reset(int x0, int y0, int width, int height);
+    // Cover nothing (every test() is false).
+    void clear() { reset(0, 0, 0, 0); }
+
+    bool test(int x, int y) const {
+        unsigned lx = static_cast<unsigned>(x - ox);
+        unsigned ly = static_cast<unsigned>(y - oy);
+        if (lx >= static_cast<unsigned>(w) || ly >= static_cast<unsigned>(h)) return false;
+        size_t i = static_cast<size_t>(ly) * w + lx;
+        return (words[i >> 6] >> (i & 63)) & 1u;
+    }
+    // (x, y) must lie inside the window.
+    void set(int x, int y) {
+        size_t i = static_cast<size_t>(y - oy) * w + (x - ox);
+        words[i >> 6] |= uint64_t(1) << (i & 63);
+    }
+    // Set [xa, xb] on row y, a word at a time; the span must lie inside the window.
+    void setSpan(int y, int xa, int xb);
+
+    int x0() const { return ox; }
+    int y0() const { return oy; }
+    int x1() const { return ox + w; }  // exclusive
+    int y1() const { return oy + h; }  // exclusive
+    int width() const { return w; }
+    int height() const { return h; }
+    bool covers() const { return w > 0 && h > 0; }
+
+    // The 64 window bits starting at bit index i (= ly * width() + lx), low
+    // bit first; bits past the end of the mask read as 0. Lets consumers copy
+    // a row out a word at a time instead of testing cells.
+    uint64_t bitsFrom(size_t i) const {
+        size_t wi = i >> 6;
+        unsigned sh = i & 63;
+        if (wi >= words.size()) return 0;
+        uint64_t lo = words[wi] >> sh;
+        if (sh && wi + 1 < words.size()) lo |= words[wi + 1] << (64 - sh);
+        return lo;
+    }
+
+    size_t count() const;
+    size_t bytes() const { return words.capacity() * sizeof(uint64_t); }
+
+    // Call fn(x, y) for every visible cell, in row-major order.
+    template <typename F>
+    void forEachVisible(F&& fn) const {
+        for (size_t wi = 0; wi < words.size(); wi++) {
+            uint64_t bits = words[wi];
+            while (bits) {
+                size_t i = (wi << 6) + std::countr_zero(bits);
+                bits &= bits - 1;
+                fn(ox + static_cast<int>(i % w), oy + static_cast<int>(i / w));
+            }
+        }
+    }
+
+private:
+    int ox = 0, oy = 0, w = 0, h = 0;
+    std::vector<uint64_t> words;
+};
+
+// One FOV query. radius <= 0 means unlimited (whole grid).
+struct Origin {
+    int x = 0;
+    int y = 0;
+    int radius = 0;
+    bool light_walls = true;
+    TCOD_fov_algorithm_t algorithm = FOV_BASIC;
+};
+
+// FOV from a single origin into `out`. An origin outside the grid (or a grid
+// with no storage) yields an empty mask. Safe to call from any thread as long
+// as nothing writes the grid's cell planes meanwhile.
+void compute(const GridData& grid, const Origin& origin, VisibilityMask& out);
+
+// FOV for origins[0..count) into out[0..count), spread over WorkerPool. Each
+// result is identical to compute() for the same origin. Callers holding the
+// GIL should release it around this call; the first exception thrown by a
+// worker is rethrown here.
+void computeBatch(const GridData& grid, const Origin* origins, size_t count, VisibilityMask* out);
+
+} // namespace FOVEngine
@@ -0,0 +1,130 @@
+#include "FactionPerspective.h"
+#include "GridData.h"
+#include "UIEntity.h"
+#include <algorithm>
+
+namespace {
+
+bool sameOrigin(const FOVEngine::Origin& a, const FOVEngine::Origin& b) {
+    return a.x == b.x && a.y == b.y && a.radius == b.radius &&
+           a.light_walls == b.light_walls && a.algorithm == b.algorithm;
+}
+
+} // namespace
+
+size_t FactionPerspective::prepare(const GridData& grid)
+{
+    stale.clear();
+    stale_origins.clear();
+    departed = false;
+
+    if (grid.grid_w <= 0 || grid.grid_h <= 0) {
+        memory.reset();
+        members.clear();
+        return 0;
+    }
+    if (!memory || memory->width() != grid.grid_w || memory->height() != grid.grid_h) {
+        // Memory of a differently-sized grid means nothing here; start over.
+        memory = std::make_unique<PerspectiveBits>(grid.grid_w, grid.grid_h);
+        members.clear();
+        reset = true;
+    }
+    transparency_gen = grid.transparency_generation;
+
+    for (auto& [entity, member] : members) member.present = false;
+
+    if (grid.entities) {
+        for (const auto& entity : *grid.entities) {
+            if (!entity || !entity->labels.count(label_)) continue;
+            FOVEngine::Origin origin;
+            origin.x = entity->cell_position.x;
+            origin.y = entity->cell_position.y;
+            origin.radius = grid.fov_radius;
+            origin.algorithm = grid.fov_algorithm;
+
+            auto [it, inserted] = members.try_emplace(entity.get());
+            Member& member = it->second;
+            if (member.present) continue;  // listed twice
+            member.present = true;
+            if (inserted || !member.computed || !sameOrigin(member.origin, origin) ||
+                member.transparency_gen != transparency_gen) {
+                stale.push_back(entity.get());
+                stale_origins.push_back(origin);
+            }
+        }
+    }
+
+    for (auto& [entity, member] : members) {
+        if (!member.present) { departed = true; break; }
+    }
+    stale_masks.resize(stale.size());
+    return stale.size();
+}
+
+void FactionPerspective::computeStale(const GridData& grid)
+{
+    if (stale.empty()) return;
+    FOVEngine::computeBatch(grid, stale_origins.data(), stale_origins.size(), stale_masks.data());
+}
+
+bool FactionPerspective::merge()
+{
+    if (!memory || (stale.empty() && !departed && !reset)) return false;
+
+    dirty_x0 = dirty_y0 = dirty_x1 = dirty_y1 = 0;
+    if (reset) {
+        dirty_x1 = memory->width();
+        dirty_y1 = memory->height();
+    }
+
+    // Demote every window that is going away: departed members' and the old
+    // windows of recomputed members.
+    for (auto it = members.begin(); it != members.end();) {
+        if (it->second.present) { ++it; continue; }
+        const auto& fov = it->second.fov;
+        if (fov.covers()) {
+            memory->demoteVisibleRect(fov.x0(), fov.y0(), fov.x1(), fov.y1());
+            growDirty(fov);
+        }
+        it = members.erase(it);
+    }
+    for (size_t i = 0; i < stale.size(); i++) {
+        Member& member = members[stale[i]];
+        if (member.fov.covers()) {
+            memory->demoteVisibleRect(member.fov.x0(), member.fov.y0(),
+                                      member.fov.x1(), member.fov.y1());
+            growDirty(member.fov);
+        }
+        member.fov = std::move(stale_masks[i]);
+        member.origin = stale_origins[i];
+        member.transparency_gen = transparency_gen;
+        member.computed = true;
+        growDirty(member.fov);
+    }
+
+    // OR every member back in; unchanged members restore anything the demote
+    // above cleared that they still see.
+    for (const auto& [entity, member] : members) {
+        memory->promote(member.fov);
+    }
+
+    stale.clear();
+    stale_origins.clear();
+    stale_masks.clear();
+    departed = false;
+    reset = false;
+    return true;
+}
+
+void FactionPerspective::growDirty(const FOVEngine::VisibilityMask& m)
+{
+    if (!m.covers()) return;
+    if (dirty_x1 <= dirty_x0 || dirty_y1 <= dirty_y0) {
+        dirty_x0 = m.x0(); dirty_y0 = m.y0(); dirty_x1 = m.x1(); dirty_y1 = m.y1();
+        return;
+    }
+    dirty_x0 = std::min(dirty_x0, m.x0());
+    dirty_y0 = std::min(dirty_y0, m.y0());
+    dirty_x1 = std::max(dirty_x1, m.x1());
+    dirty_y1 = std::max(dirty_y1, m.y1());
+}
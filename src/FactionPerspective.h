@@ -0,0 +1,85 @@
+#pragma once
+// FactionPerspective.h - Shared "what can my side see" memory for a label.
+//
+// Every entity on the grid carrying the faction's label contributes its FOV
+// (FOVEngine::VisibilityMask, at the grid's fov_radius / fov algorithm). The
+// faction keeps each member's last mask and the union as PerspectiveBits, so
+// it has the same 0 = unknown / 1 = discovered / 2 = visible states as an
+// entity's perspective_map.
+//
+// Updates are incremental: only members whose cell, the grid's FOV settings,
+// or the grid's transparency changed are recomputed. The windows of changed
+// and departed members are demoted, then every member's mask is ORed back
+// in, so cells still seen by an unchanged member stay visible. An update in
+// which nothing changed touches no memory and reports false.
+//
+// Use through GridData::updateFaction(), which also repaints ColorLayers bound
+// to the faction. The three-step prepare / computeStale / merge form lets the
+// Python wrapper release the GIL around the FOV work.
+
+#include "FOVEngine.h"
+#include "PerspectiveBits.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class GridData;
+class UIEntity;
+
+class FactionPerspective {
+public:
+    explicit FactionPerspective(std::string label) : label_(std::move(label)) {}
+
+    const std::string& label() const { return label_; }
+
+    // Scan the grid's entities for members and queue the ones whose FOV is
+    // out of date. Resets everything if the grid was resized. Main thread.
+    // Returns the number of queued FOVs.
+    size_t prepare(const GridData& grid);
+    // Compute the queued FOVs on WorkerPool. Touches no Python state, so the
+    // GIL may be released around it; the grid must not be edited meanwhile.
+    void computeStale(const GridData& grid);
+    // Fold the results into the union. Returns true if the memory changed;
+    // dirtyRect() then bounds the cells that may differ.
+    bool merge();
+
+    // (x, y) must be inside the grid; 0 before the first update.
+    uint8_t get(int x, int y) const { return memory ? memory->get(x, y) : 0; }
+    const PerspectiveBits* bits() const { return memory.get(); }
+    size_t memberCount() const { return members.size(); }
+
+    // Half-open rect touched by the last merge() that returned true.
+    void dirtyRect(int& x0, int& y0, int& x1, int& y1) const {
+        x0 = dirty_x0; y0 = dirty_y0; x1 = dirty_x1; y1 = dirty_y1;
+    }
+
+private:
+    struct Member {
+        FOVEngine::Origin origin;
+        uint32_t transparency_gen = 0;
+        FOVEngine::VisibilityMask fov;
+        bool present = false;
+        bool computed = false;  // fov holds a merged result
+    };
+
+    void growDirty(const FOVEngine::VisibilityMask& m);
+
+    std::string label_;
+    std::unique_ptr<PerspectiveBits> memory;
+    // Keyed by identity only (never dereferenced): a stale key reused by a new
+    // entity is harmless, since the mask depends only on the origin.
+    std::unordered_map<const UIEntity*, Member> members;
+    uint32_t transparency_gen = 0;
+
+    // Work queued by prepare()
+    std::vector<const UIEntity*> stale;
+    std::vector<FOVEngine::Origin> stale_origins;
+    std::vector<FOVEngine::VisibilityMask> stale_masks;
+    bool departed = false;
+    bool reset = false;  // memory reallocated: the whole grid is dirty
+
+    int dirty_x0 = 0, dirty_y0 = 0, dirty_x1 = 0, dirty_y1 = 0;
+};
@@ -563,31 +563,9 @@ std::shared_ptr<Timer> GameEngine::getTimer(const std::string& name)
 void GameEngine::testTimers()
 {
     int now = headless ? simulation_time : runtime.getElapsedTime().asMilliseconds();
-    auto it = timers.begin();
-    while (it != timers.end())
-    {
-        // Keep a local copy of the timer to prevent use-after-free.
-        // If the callback calls stop(), the timer may be marked for removal,
-        // but we need the Timer object to survive until test() returns.
-        auto timer = it->second;
-
-        // Skip stopped timers (they'll be removed below)
-        if (!timer->isStopped()) {
-            timer->test(now);
-        }
-
-        // Remove timers that have been stopped (including one-shot timers that fired).
-        // The stopped flag is the authoritative marker for "remove from map".
-        // Note: Check it->second (current map value) in case callback replaced it.
-        if (it->second->isStopped())
-        {
-            it = timers.erase(it);
-        }
-        else
-        {
-            it++;
-        }
-    }
+    // Only due timers are visited; stopped ones (including one-shot timers
+    // that fired) leave the map at the end of the pass
+    timers.fire(now);
 }
 
 void GameEngine::processEvent(const sf::Event& event)
@@ -913,20 +891,11 @@ float GameEngine::step(float dt) {
     if (dt < 0) {
         // dt < 0 means "advance to next event"
         // Find the minimum time until next timer fires
-        int min_remaining = INT_MAX;
-
-        for (auto& [name, timer] : timers) {
-            if (timer && timer->isActive()) {
-                int remaining = timer->getRemaining(simulation_time);
-                if (remaining > 0 && remaining < min_remaining) {
-                    min_remaining = remaining;
-                }
-            }
-        }
+        int min_remaining = timers.untilNext(simulation_time);
 
         // Also consider animations - find minimum time to completion
         // AnimationManager doesn't expose this, so we'll just step by 1ms if no timers
-        if (min_remaining == INT_MAX) {
+        if (min_remaining < 0) {
             // No pending timers - check if there are active animations
             // Step by a small amount to advance any running animations
             min_remaining = 1;  // 1ms minimum step
@@ -954,22 +923,7 @@ float GameEngine::step(float dt) {
     // Test timers with the new simulation time.
     // Kept on simulation_time (not runtime): step() is the deterministic headless
     // clock, which is the whole point of driving time explicitly from a test.
-    auto it = timers.begin();
-    while (it != timers.end()) {
-        auto timer = it->second;
-
-        // Custom timer test using simulation time instead of runtime
-        if (timer && timer->isActive() && timer->hasElapsed(simulation_time)) {
-            timer->test(simulation_time);
-        }
-
-        // Remove cancelled timers
-        if (!it->second->getCallback() || it->second->getCallback() == Py_None) {
-            it = timers.erase(it);
-        } else {
-            it++;
-        }
-    }
+    timers.fire(simulation_time);
 
     // Python Scene.update(dt) hook -- the originally-filed omission
     {
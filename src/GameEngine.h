@@ -5,6 +5,7 @@
 #include "McRFPy_API.h"
 #include "IndexTexture.h"
 #include "Timer.h"
+#include "TimerScheduler.h"
 #include "PyCallable.h"
 #include "McRogueFaceConfig.h"
 #include "HeadlessRenderer.h"
@@ -34,7 +35,15 @@ struct ProfilingMetrics {
     int fps = 0;                     // Frames per second
     int drawCalls = 0;               // Draw calls per frame
     int uiElements = 0;              // Number of UI elements rendered
-    int visibleElements = 0;         // Number of visible elements
+    int visibleElements = 0;         // Number of UI elements drawn (not hidden or culled)
+    int culledElements = 0;          // Skipped: entirely outside the window or parent clip
+    int occludedElements = 0;        // Skipped: entirely under an opaque sibling frame
+    int uiBatchDrawCalls = 0;        // Draw calls spent on batched captions/sprites in child lists
+    int glyphRunBuilds = 0;          // Caption glyph runs laid out (text, font or size changed)
+    int retainedBlits = 0;           // Retained-scene layers drawn as one cached blit
+    int retainedRebuilds = 0;        // Retained-scene layers rasterized again
+    int framePartialRecomposites = 0; // Cached frames repainted only where children changed
+    int frameFullRebuilds = 0;       // Cached frames redrawn with every child
 
     // Detailed timing breakdowns (added for profiling system)
     float gridRenderTime = 0.0f;     // Time spent rendering grids (ms)
@@ -42,12 +51,18 @@ struct ProfilingMetrics {
     float fovOverlayTime = 0.0f;     // Time spent rendering FOV overlays (ms)
     float pythonScriptTime = 0.0f;   // Time spent in Python callbacks (ms)
     float animationTime = 0.0f;      // Time spent updating animations (ms)
+    int animationsUpdated = 0;       // Animations advanced this simulation frame
+    int animationsBatched = 0;       // ...of which scalar tweens updated in batches
     float workTime = 0.0f;           // Total work time before display/sleep (ms)
 
     // Grid-specific metrics
     int gridCellsRendered = 0;       // Number of grid cells drawn this frame
     int entitiesRendered = 0;        // Number of entities drawn this frame
+    int entityDrawCalls = 0;         // Draw calls spent on grid entities (batched per texture)
     int totalEntities = 0;           // Total entities in scene
+    int chunkCacheHits = 0;          // Visible layer chunks drawn from a resident texture
+    int chunkCacheMisses = 0;        // Visible layer chunks rasterized (not resident, or edited)
+    int chunkCacheEvictions = 0;     // Chunks evicted to stay within the texture budget
 
     // Frame time history for averaging
     static constexpr int HISTORY_SIZE = 60;
@@ -70,14 +85,28 @@ struct ProfilingMetrics {
         int drawCalls = 0;
         int uiElements = 0;
         int visibleElements = 0;
+        int culledElements = 0;
+        int occludedElements = 0;
+        int uiBatchDrawCalls = 0;
+        int glyphRunBuilds = 0;
+        int retainedBlits = 0;
+        int retainedRebuilds = 0;
+        int framePartialRecomposites = 0;
+        int frameFullRebuilds = 0;
         int gridCellsRendered = 0;
         int entitiesRendered = 0;
+        int entityDrawCalls = 0;
         int totalEntities = 0;
+        int chunkCacheHits = 0;
+        int chunkCacheMisses = 0;
+        int chunkCacheEvictions = 0;
         float gridRenderTime = 0.0f;
         float entityRenderTime = 0.0f;
         float fovOverlayTime = 0.0f;
         float pythonScriptTime = 0.0f;
         float animationTime = 0.0f;
+        int animationsUpdated = 0;
+        int animationsBatched = 0;
     } published;
 
     void updateFrameTime(float deltaMs) {
@@ -109,9 +138,21 @@ struct ProfilingMetrics {
         drawCalls = 0;
         uiElements = 0;
         visibleElements = 0;
+        culledElements = 0;
+        occludedElements = 0;
+        uiBatchDrawCalls = 0;
+        glyphRunBuilds = 0;
+        retainedBlits = 0;
+        retainedRebuilds = 0;
+        framePartialRecomposites = 0;
+        frameFullRebuilds = 0;
         gridCellsRendered = 0;
         entitiesRendered = 0;
+        entityDrawCalls = 0;
         totalEntities = 0;
+        chunkCacheHits = 0;
+        chunkCacheMisses = 0;
+        chunkCacheEvictions = 0;
         gridRenderTime = 0.0f;
         entityRenderTime = 0.0f;
         fovOverlayTime = 0.0f;
@@ -121,9 +162,21 @@ struct ProfilingMetrics {
         published.drawCalls = drawCalls;
         published.uiElements = uiElements;
         published.visibleElements = visibleElements;
+        published.culledElements = culledElements;
+        published.occludedElements = occludedElements;
+        published.uiBatchDrawCalls = uiBatchDrawCalls;
+        published.glyphRunBuilds = glyphRunBuilds;
+        published.retainedBlits = retainedBlits;
+        published.retainedRebuilds = retainedRebuilds;
+        published.framePartialRecomposites = framePartialRecomposites;
+        published.frameFullRebuilds = frameFullRebuilds;
         published.gridCellsRendered = gridCellsRendered;
         published.entitiesRendered = entitiesRendered;
+        published.entityDrawCalls = entityDrawCalls;
         published.totalEntities = totalEntities;
+        published.chunkCacheHits = chunkCacheHits;
+        published.chunkCacheMisses = chunkCacheMisses;
+        published.chunkCacheEvictions = chunkCacheEvictions;
         published.gridRenderTime = gridRenderTime;
         published.entityRenderTime = entityRenderTime;
         published.fovOverlayTime = fovOverlayTime;
@@ -132,11 +185,15 @@ struct ProfilingMetrics {
     void beginSimFrame() {
         pythonScriptTime = 0.0f;
         animationTime = 0.0f;
+        animationsUpdated = 0;
+        animationsBatched = 0;
     }
 
     void endSimFrame() {
         published.pythonScriptTime = pythonScriptTime;
         published.animationTime = animationTime;
+        published.animationsUpdated = animationsUpdated;
+        published.animationsBatched = animationsBatched;
     }
 };
 
@@ -268,7 +325,7 @@ private:
 
 public:
     sf::Clock runtime;
-    std::map<std::string, std::shared_ptr<Timer>> timers;
+    TimerScheduler timers;  // by name, fired from a next-fire heap
     std::string scene;
     
     // Profiling metrics (struct defined above class)
@@ -0,0 +1,124 @@
+#include "GlyphRun.h"
+
+namespace {
+#ifndef MCRF_SDL2
+    // One glyph quad at pen position (x, y), matching sf::Text's geometry:
+    // bounds and texture rect grown by a pixel of padding, top leaning right
+    // by the italic shear.
+    void addGlyphQuad(std::vector<sf::Vertex>& out, float x, float y,
+                      const sf::Glyph& glyph, float shear, float outline)
+    {
+        const float padding = 1.0f;
+        float left   = glyph.bounds.left - padding;
+        float top    = glyph.bounds.top - padding;
+        float right  = glyph.bounds.left + glyph.bounds.width + padding;
+        float bottom = glyph.bounds.top + glyph.bounds.height + padding;
+
+        float u1 = static_cast<float>(glyph.textureRect.left) - padding;
+        float v1 = static_cast<float>(glyph.textureRect.top) - padding;
+        float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + padding;
+        float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + padding;
+
+        out.push_back(sf::Vertex(sf::Vector2f(x + left - shear * top - outline, y + top - outline),
+                                 sf::Vector2f(u1, v1)));
+        out.push_back(sf::Vertex(sf::Vector2f(x + right - shear * top - outline, y + top - outline),
+                                 sf::Vector2f(u2, v1)));
+        out.push_back(sf::Vertex(sf::Vector2f(x + right - shear * bottom - outline, y + bottom - outline),
+                                 sf::Vector2f(u2, v2)));
+        out.push_back(sf::Vertex(sf::Vector2f(x + left - shear * bottom - outline, y + bottom - outline),
+                                 sf::Vector2f(u1, v2)));
+    }
+#endif
+}
+
+bool GlyphRun::batchable(const sf::Text& text)
+{
+#ifdef MCRF_SDL2
+    // SDL2 fonts rasterize through their own FontAtlas; sf::Text draws them
+    (void)text;
+    return false;
+#else
+    return text.getFont() != nullptr &&
+           (text.getStyle() & (sf::Text::Underlined | sf::Text::StrikeThrough)) == 0;
+#endif
+}
+
+bool GlyphRun::stale(const sf::Text& text) const
+{
+    return !built ||
+           text.getFont() != font ||
+           text.getCharacterSize() != character_size ||
+           text.getStyle() != style ||
+           text.getOutlineThickness() != outline_thickness ||
+           text.getString() != string;
+}
+
+void GlyphRun::build(const sf::Text& text)
+{
+    string = text.getString();
+    font = text.getFont();
+    character_size = text.getCharacterSize();
+    style = text.getStyle();
+    outline_thickness = text.getOutlineThickness();
+    built = true;
+
+    vertices.clear();
+    outline_vertices = fill_vertices = 0;
+    page = nullptr;
+#ifndef MCRF_SDL2
+    if (!font) return;
+    page = &font->getTexture(character_size);
+
+    bool bold = (style & sf::Text::Bold) != 0;
+    float shear = (style & sf::Text::Italic) ? 0.209f : 0.0f;  // 12 degrees
+    float whitespace = font->getGlyph(U' ', character_size, bold).advance;
+    float line_spacing = font->getLineSpacing(character_size);
+#if SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR < 6
+    // SFML 2.5 offsets outline glyphs by the thickness; 2.6 bakes it in
+    float outline_shift = outline_thickness;
+#else
+    float outline_shift = 0.0f;
+#endif
+
+    // Two passes so the outline quads precede every fill quad
+    std::vector<sf::Vertex> fill;
+    float x = 0.0f;
+    float y = static_cast<float>(character_size);
+    sf::Uint32 prev = 0;
+    for (auto ch : string) {
+        auto cur = static_cast<sf::Uint32>(static_cast<std::make_unsigned_t<decltype(ch)>>(ch));
+        if (cur == U'\r') continue;
+        x += font->getKerning(prev, cur, character_size);
+        prev = cur;
+
+        if (cur == U' ' || cur == U'\t' || cur == U'\n') {
+            if (cur == U' ') x += whitespace;
+            else if (cur == U'\t') x += whitespace * 4;
+            else { y += line_spacing; x = 0.0f; }
+            continue;
+        }
+
+        if (outline_thickness != 0) {
+            const sf::Glyph& glyph = font->getGlyph(cur, character_size, bold, outline_thickness);
+            addGlyphQuad(vertices, x, y, glyph, shear, outline_shift);
+        }
+        const sf::Glyph& glyph = font->getGlyph(cur, character_size, bold);
+        addGlyphQuad(fill, x, y, glyph, shear, 0.0f);
+        x += glyph.advance;
+    }
+
+    outline_vertices = vertices.size();
+    fill_vertices = fill.size();
+    vertices.insert(vertices.end(), fill.begin(), fill.end());
+#endif
+}
+
+void GlyphRun::addTo(SpriteBatch& batch, const sf::Transform& transform,
+                     sf::Color fill, sf::Color outline) const
+{
+    if (!page) return;
+    if (outline_vertices > 0) {
+        batch.addQuads(page, transform, vertices.data(), outline_vertices, outline);
+    }
+    batch.addQuads(page, transform, vertices.data() + outline_vertices, fill_vertices, fill);
+}
@@ -0,0 +1,55 @@
+#pragma once
+// GlyphRun.h - Cached glyph layout for one sf::Text.
+//
+// sf::Text keeps its layout private, so a caption could only be drawn with
+// its own draw call. A GlyphRun lays the text out once into local-space
+// quads on the font's page texture (outline quads first, then fill, as
+// sf::Text draws them) and keeps them until the string, font, character
+// size, style or outline thickness change. Colors are applied when the
+// quads are queued, so fades and tints never rebuild the run.
+//
+// Layout follows sf::Text: baseline at characterSize, kerning, whitespace
+// and tab advances, line spacing on '\n', italic shear. Underline and
+// strike-through are not laid out; texts using them are not batchable.
+
+#include "Common.h"
+#include "SpriteBatch.h"
+#include <string>
+#include <type_traits>
+#include <vector>
+
+class GlyphRun {
+public:
+    // False when text must be drawn by sf::Text itself (no font, unsupported
+    // style, or a backend whose fonts do not expose glyph pages)
+    static bool batchable(const sf::Text& text);
+
+    // True when text differs from what the run was built for
+    bool stale(const sf::Text& text) const;
+
+    // Lay text out again. Only call when batchable(text).
+    void build(const sf::Text& text);
+
+    // Queue the run through transform with the text's current colors
+    void addTo(SpriteBatch& batch, const sf::Transform& transform,
+               sf::Color fill, sf::Color outline) const;
+
+    size_t glyphCount() const { return fill_vertices / 4; }
+
+private:
+    // sf::String, or std::string in the headless stub
+    using TextString = std::decay_t<decltype(std::declval<const sf::Text&>().getString())>;
+
+    // Layout key
+    bool built = false;
+    TextString string;
+    const sf::Font* font = nullptr;
+    unsigned int character_size = 0;
+    sf::Uint32 style = 0;
+    float outline_thickness = 0.0f;
+
+    const sf::Texture* page = nullptr;
+    std::vector<sf::Vertex> vertices;  // outline quads, then fill quads
+    size_t outline_vertices = 0;
+    size_t fill_vertices = 0;
+};
@@ -5,12 +5,14 @@
 #include "UIGridView.h"        // #313/#359 - markDirty notifies registered views
 #include "PythonObjectCache.h" // #361 - GridData owns its own cache serial
 #include <algorithm>
+#include <limits>
 
 // #313/#361 - Render invalidation from the data layer (see GridData.h).
 // Notifies every registered view; there is no longer a drawable half of `this`
 // to notify.
 void GridData::markDirty() {
     content_generation++;  // #351 - content changed; invalidate view early-out
+    entity_reach_stale = true;  // entity setters land here
     for (auto& weak_view : views) {
         if (auto view = weak_view.lock()) view->markDirty();
     }
@@ -18,11 +20,94 @@ void GridData::markDirty() {
 
 void GridData::markCompositeDirty() {
     content_generation++;  // #351 - content changed; invalidate view early-out
+    notifyCompositeDirty();
+}
+
+void GridData::notifyCompositeDirty() {
     for (auto& weak_view : views) {
         if (auto view = weak_view.lock()) view->markCompositeDirty();
     }
 }
 
+// Precise damage log (see GridData.h)
+static void logDamage(GridData& grid, const GridData::Damage& d) {
+    if (grid.damage_log.size() >= GridData::DAMAGE_LOG_LIMIT) {
+        grid.damage_log.erase(grid.damage_log.begin(),
+                              grid.damage_log.begin() + GridData::DAMAGE_LOG_LIMIT / 2);
+    }
+    grid.damage_log.push_back(d);
+}
+
+void GridData::damageCells(int x0, int y0, int x1, int y1) {
+    content_generation++;
+    logDamage(*this, {content_generation,
+                      sf::FloatRect(static_cast<float>(x0), static_cast<float>(y0),
+                                    static_cast<float>(x1 - x0), static_cast<float>(y1 - y0)),
+                      {0.f, 0.f}, {0.f, 0.f}});
+}
+
+// Drawn size of an entity in unzoomed pixels: one sprite, or the #237
+// composite. False if the extent cannot be bounded from the sprite alone.
+static bool entityDrawSize(const UIEntity& e, sf::Vector2f& size) {
+    const UISprite& sprite = e.sprite;
+    auto tex = sprite.getTexture();
+    if (sprite.rotation != 0.0f || sprite.origin != sf::Vector2f(0.f, 0.f) || !tex) return false;
+    size = sf::Vector2f(static_cast<float>(tex->sprite_width), static_cast<float>(tex->sprite_height));
+    if (!e.sprite_grid.empty()) {
+        size.x *= e.tile_width;
+        size.y *= e.tile_height;
+    }
+    return true;
+}
+
+static float entityReachOf(const UIEntity& e, float cell_w, float cell_h) {
+    if (!e.sprite.getTexture()) return 0.f;  // draws nothing
+    sf::Vector2f size;
+    if (!entityDrawSize(e, size)) return std::numeric_limits<float>::infinity();
+    const sf::Vector2f& off = e.sprite_offset;
+    return std::max({0.f,
+                     (off.x + size.x) / cell_w - 1.f, -off.x / cell_w,
+                     (off.y + size.y) / cell_h - 1.f, -off.y / cell_h});
+}
+
+float GridData::entityReach() {
+    if (!entities) return 0.f;
+    if (entity_reach_stale || entity_reach_count != entities->size()) {
+        const float cw = static_cast<float>(cell_width()), ch = static_cast<float>(cell_height());
+        entity_reach = 0.f;
+        for (const auto& e : *entities) {
+            entity_reach = std::max(entity_reach, entityReachOf(*e, cw, ch));
+        }
+        entity_reach_stale = false;
+        entity_reach_count = entities->size();
+    }
+    return entity_reach;
+}
+
+void GridData::damageEntity(const UIEntity& e, sf::Vector2f at) {
+    sf::Vector2f size;
+    if (!entityDrawSize(e, size)) {
+        content_generation++;
+        entity_reach_stale = true;
+        return;
+    }
+    float w = size.x, h = size.y;
+    if (!entity_reach_stale) {
+        entity_reach = std::max(entity_reach, entityReachOf(e, static_cast<float>(cell_width()),
+                                                            static_cast<float>(cell_height())));
+    }
+    content_generation++;
+    logDamage(*this, {content_generation, sf::FloatRect(at.x, at.y, 0.f, 0.f),
+                      e.sprite_offset, sf::Vector2f(w, h)});
+}
+
+void GridData::entityMoved(UIEntity& e, sf::Vector2f old_pos) {
+    spatial_hash.update(e.shared_from_this(), old_pos.x, old_pos.y);
+    damageEntity(e, old_pos);
+    damageEntity(e, e.position);
+    notifyCompositeDirty();
+}
+
 // #359 - View registry (see GridData.h). Kept small (typically 1-2 entries:
 // split-screen / minimap use cases), so linear scan is fine.
 void GridData::registerView(const std::shared_ptr<UIGridView>& view) {
@@ -110,6 +195,11 @@ void GridData::initStorage(int gx, int gy, GridData* parent_ref)
     // transparent (matches the former UIGridPoint() default).
     walkable_plane.assign((size_t)gx * (size_t)gy, 0);
     transparent_plane.assign((size_t)gx * (size_t)gy, 0);
+    walkability_generation++;
+    walkability_log.clear();  // cell indices from the old size mean nothing now
+    walkability_log_base = walkability_generation;
+    spatial_hash.resize(gx, gy);
+    fov_mask.clear();
 
     syncTCODMap();
 }
@@ -148,7 +238,13 @@ void GridData::computeFOV(int x, int y, int radius, bool light_walls, TCOD_fov_a
     }
 
     std::lock_guard<std::mutex> lock(fov_mutex);
-    tcod_map->computeFov(x, y, radius, light_walls, algo);
+    FOVEngine::Origin origin;
+    origin.x = x;
+    origin.y = y;
+    origin.radius = radius;
+    origin.light_walls = light_walls;
+    origin.algorithm = algo;
+    FOVEngine::compute(*this, origin, fov_mask);
 
     fov_dirty = false;
     fov_last_x = x;
@@ -162,7 +258,37 @@ bool GridData::isInFOV(int x, int y) const
 {
     if (!tcod_map || x < 0 || x >= grid_w || y < 0 || y >= grid_h) return false;
     std::lock_guard<std::mutex> lock(fov_mutex);
-    return tcod_map->isInFov(x, y);
+    return fov_mask.test(x, y);
+}
+
+FactionPerspective& GridData::faction(const std::string& label)
+{
+    auto& slot = factions[label];
+    if (!slot) slot = std::make_unique<FactionPerspective>(label);
+    return *slot;
+}
+
+bool GridData::updateFaction(const std::string& label)
+{
+    auto& f = faction(label);
+    f.prepare(*this);
+    f.computeStale(*this);
+    if (!f.merge()) return false;
+    refreshFactionLayers(f);
+    return true;
+}
+
+void GridData::refreshFactionLayers(const FactionPerspective& f)
+{
+    int x0, y0, x1, y1;
+    f.dirtyRect(x0, y0, x1, y1);
+    for (auto& layer : layers) {
+        if (layer->type != GridLayerType::Color) continue;
+        auto color_layer = std::static_pointer_cast<ColorLayer>(layer);
+        if (color_layer->has_perspective && color_layer->perspective_faction == f.label()) {
+            color_layer->paintFaction(f, x0, y0, x1, y1);
+        }
+    }
 }
 
 // Layer management
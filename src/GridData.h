@@ -20,6 +20,10 @@
 #include "UIGridPoint.h"
 #include "SpatialHash.h"
 #include "GridLayers.h"
+#include "DijkstraCache.h"
+#include "HPAGraph.h"
+#include "FOVEngine.h"
+#include "FactionPerspective.h"
 
 // Forward declarations
 class DijkstraMap;
@@ -79,9 +83,48 @@ public:
 
     bool isWalkable(int x, int y) const { return walkable_plane[(size_t)y * grid_w + x] != 0; }
     bool isTransparent(int x, int y) const { return transparent_plane[(size_t)y * grid_w + x] != 0; }
-    void setWalkable(int x, int y, bool v) { walkable_plane[(size_t)y * grid_w + x] = v ? 1 : 0; }
+    void setWalkable(int x, int y, bool v) {
+        size_t idx = (size_t)y * grid_w + x;
+        uint8_t& cell = walkable_plane[idx];
+        uint8_t nv = v ? 1 : 0;
+        if (cell != nv) { cell = nv; noteWalkabilityChange(idx); }
+    }
+
+    // Bumped whenever any cell's walkability actually changes. Pathfinding
+    // caches compare against it (transparency edits do not invalidate them).
+    uint32_t walkability_generation = 0;
+
+    // Cells behind the most recent walkability changes, so a Dijkstra map a
+    // few edits behind can repair just the affected region instead of
+    // recomputing (see DijkstraMap::refresh). Entry i is change number
+    // walkability_log_base + i + 1. When full the log restarts, and maps older
+    // than walkability_log_base fall back to a full recompute.
+    static constexpr size_t WALKABILITY_LOG_LIMIT = 4096;
+    std::vector<uint32_t> walkability_log;
+    uint32_t walkability_log_base = 0;
+
+    // Cells changed since `generation` (possibly repeated), or false if the
+    // log no longer reaches back that far.
+    bool walkabilityChangesSince(uint32_t generation, const uint32_t** first, size_t* count) const {
+        if (generation < walkability_log_base || generation > walkability_generation) return false;
+        *first = walkability_log.data() + (generation - walkability_log_base);
+        *count = walkability_generation - generation;
+        return true;
+    }
     void setTransparent(int x, int y, bool v) { transparent_plane[(size_t)y * grid_w + x] = v ? 1 : 0; }
 
+private:
+    void noteWalkabilityChange(size_t idx) {
+        walkability_generation++;
+        if (walkability_log.size() >= WALKABILITY_LOG_LIMIT) {
+            walkability_log.clear();
+            walkability_log_base = walkability_generation - 1;
+        }
+        walkability_log.push_back(static_cast<uint32_t>(idx));
+    }
+
+public:
+
     // =========================================================================
     // Entity management
     // =========================================================================
@@ -100,9 +143,13 @@ public:
 
     void syncTCODMap();
     void syncTCODMapCell(int x, int y);
+    // Computed with FOVEngine from the cell planes; the result is kept in
+    // fov_mask (tcod_map is not written), and isInFOV() reads it.
     void computeFOV(int x, int y, int radius, bool light_walls = true,
                     TCOD_fov_algorithm_t algo = FOV_BASIC);
     bool isInFOV(int x, int y) const;
+    // Result of the last computeFOV(). Main thread only (no fov_mutex).
+    const FOVEngine::VisibilityMask& fovMask() const { return fov_mask; }
     TCODMap* getTCODMap() const { return tcod_map; }
 
     // #114 - FOV algorithm and radius defaults
@@ -115,16 +162,35 @@ public:
     int fov_last_radius = -1;
     bool fov_last_light_walls = true;
     TCOD_fov_algorithm_t fov_last_algo = FOV_BASIC;
+    FOVEngine::VisibilityMask fov_mask;
 
     // #303 - Transparency generation counter for per-entity FOV caching
     // Bumped whenever any cell's transparent/walkable property changes
     uint32_t transparency_generation = 0;
 
+    // Shared visibility memory per faction label (see FactionPerspective).
+    // Created on first use; members are the entities carrying the label.
+    std::map<std::string, std::unique_ptr<FactionPerspective>> factions;
+    FactionPerspective& faction(const std::string& label);
+    // Bring the faction up to date (recomputing only stale members) and, if
+    // its memory changed, repaint the ColorLayers bound to it. Returns true
+    // on change.
+    bool updateFaction(const std::string& label);
+    // Repaint bound ColorLayers over the faction's last dirty rect.
+    void refreshFactionLayers(const FactionPerspective& faction);
+
     // =========================================================================
     // Pathfinding caches
     // =========================================================================
-    // Cache key: (root_x, root_y, collide_label) where collide_label="" means no collision filtering
-    std::map<std::tuple<int,int,std::string>, std::shared_ptr<DijkstraMap>> dijkstra_maps;
+    // Single-root maps keyed by (root_x, root_y, collide_label); LRU-bounded by
+    // a byte budget. A hit is brought up to date with the grid before it is
+    // returned (repaired from walkability_log when possible).
+    DijkstraCache dijkstra_maps;
+
+    // Cluster graph for Heuristic.HIERARCHICAL queries and hierarchical SEEK.
+    // Built on first use and kept current from walkability_log like the
+    // cached Dijkstra maps; see HPAGraph.h.
+    HPAGraph hpa_graph;
 
     // =========================================================================
     // Layer system (#147, #150)
@@ -189,6 +255,45 @@ public:
     // live on the view and are compared there directly, not counted here.
     uint64_t content_generation = 0;
 
+    // Precise damage: content changes that know the grid-world area they
+    // touched bump content_generation through damage*() and log that area
+    // under the generation they produced. A view whose last raster is N
+    // generations old finds N log entries past it exactly when every change
+    // since was precise, and then redraws only those areas; any plain bump
+    // (layer fill, entity added, ...) leaves a gap and forces a full redraw.
+    // The log keeps the most recent DAMAGE_LOG_LIMIT entries; views further
+    // behind than that redraw fully.
+    struct Damage {
+        uint64_t generation;
+        sf::FloatRect tiles;        // area in tile units
+        sf::Vector2f pixel_offset;  // plus a pixel box (sprites) from the
+        sf::Vector2f pixel_size;    // tiles' top-left corner, unzoomed
+    };
+    std::vector<Damage> damage_log;
+    static constexpr size_t DAMAGE_LOG_LIMIT = 256;
+    // Cells [x0, x1) x [y0, y1) changed (layer edits)
+    void damageCells(int x0, int y0, int x1, int y1);
+    // The area entity `e` draws over when placed at `at`. Sprites whose
+    // extent cannot be bounded here (rotated, custom origin) bump plainly.
+    void damageEntity(const UIEntity& e, sf::Vector2f at);
+    // An entity's draw position changed from old_pos: re-bucket it, damage
+    // both placements and invalidate the views (cf. markCompositeDirty()).
+    void entityMoved(UIEntity& e, sf::Vector2f old_pos);
+    // markCompositeDirty() without the generation bump, for callers that
+    // already recorded damage
+    void notifyCompositeDirty();
+
+    // How far, in tiles, an entity can draw past its own cell (#237
+    // composites, sprites larger than a cell, sprite_offset). Redrawing some
+    // tiles must also redraw entities anchored this far outside them.
+    // Infinite while an entity's extent cannot be bounded (rotated sprite,
+    // custom origin). Rescanned after plain changes or when the entity count
+    // changes; damaged moves only widen it.
+    float entityReach();
+    float entity_reach = 0.f;
+    bool entity_reach_stale = true;
+    size_t entity_reach_count = 0;
+
     // #313/#359 - Render invalidation from the data layer. Entities hold
     // shared_ptr<GridData> but still need to invalidate rendering when their
     // visual state changes, so the data notifies every registered view (see
@@ -139,12 +139,20 @@ GridLayer::GridLayer(GridLayerType type, int z_index, int grid_x, int grid_y, Gr
     : type(type), z_index(z_index), grid_x(grid_x), grid_y(grid_y),
       parent_grid(parent), visible(true),
       chunks_x(0), chunks_y(0),
-      cached_cell_width(0), cached_cell_height(0)
+      cached_cell_width(0), cached_cell_height(0),
+      vertices_cell_width(0), vertices_cell_height(0),
+      overview_blocks_x(0), overview_blocks_y(0)
 {
     initChunks();
 }
 
+GridLayer::~GridLayer() {
+    releaseChunkCache();
+}
+
 void GridLayer::initChunks() {
+    releaseChunkCache();
+
     // Calculate chunk dimensions
     chunks_x = (grid_x + CHUNK_SIZE - 1) / CHUNK_SIZE;
     chunks_y = (grid_y + CHUNK_SIZE - 1) / CHUNK_SIZE;
@@ -154,15 +162,64 @@ void GridLayer::initChunks() {
     chunk_dirty.assign(total_chunks, true);  // All chunks start dirty
     chunk_texture_initialized.assign(total_chunks, false);
     chunk_textures.clear();
-    chunk_textures.reserve(total_chunks);
-    for (int i = 0; i < total_chunks; ++i) {
-        chunk_textures.push_back(std::make_unique<sf::RenderTexture>());
+    chunk_textures.resize(total_chunks);
+
+    // Vertex arrays are sized on a chunk's first render, so chunks that are
+    // never on screen cost no geometry memory.
+    chunk_vertices.assign(total_chunks, sf::VertexArray(sf::Quads));
+    chunk_vertices_valid.assign(total_chunks, false);
+    chunk_pending_cells.assign(total_chunks, {});
+
+    chunk_mips.clear();
+    chunk_mips.resize(total_chunks);
+    chunk_mips_valid.assign(total_chunks, 0);
+
+    overview_blocks_x = (grid_x + OVERVIEW_BLOCK - 1) / OVERVIEW_BLOCK;
+    overview_blocks_y = (grid_y + OVERVIEW_BLOCK - 1) / OVERVIEW_BLOCK;
+    overview_blocks.clear();
+    overview_blocks.resize(overview_blocks_x * overview_blocks_y);
+    chunk_overview_dirty.assign(total_chunks, true);
+
+    chunk_cache_slots.assign(total_chunks, ChunkCache::Slot());
+    chunk_cached.assign(total_chunks, false);
+}
+
+void GridLayer::releaseChunkCache() {
+    auto& cache = ChunkCache::get();
+    for (int i = 0; i < static_cast<int>(chunk_cached.size()); ++i) {
+        cache.forget(this, i);
     }
 }
 
+size_t GridLayer::chunkCacheBytes(int chunk_idx) const {
+    size_t bytes = 0;
+    if (chunk_texture_initialized[chunk_idx]) {
+        sf::Vector2u size = chunk_textures[chunk_idx]->getSize();
+        bytes += static_cast<size_t>(size.x) * size.y * 4;
+    }
+    for (const auto& mip : chunk_mips[chunk_idx]) {
+        if (!mip) continue;
+        sf::Vector2u size = mip->getSize();
+        bytes += static_cast<size_t>(size.x) * size.y * 4;
+    }
+    return bytes;
+}
+
+void GridLayer::evictChunk(int chunk_idx) {
+    chunk_textures[chunk_idx].reset();
+    chunk_texture_initialized[chunk_idx] = false;
+    for (auto& mip : chunk_mips[chunk_idx]) mip.reset();
+    chunk_mips_valid[chunk_idx] = 0;
+    chunk_vertices[chunk_idx] = sf::VertexArray(sf::Quads);
+    chunk_vertices_valid[chunk_idx] = false;
+    chunk_pending_cells[chunk_idx].clear();
+    chunk_dirty[chunk_idx] = true;
+}
+
 void GridLayer::markDirty() {
     // Mark ALL chunks as dirty
     std::fill(chunk_dirty.begin(), chunk_dirty.end(), true);
+    std::fill(chunk_overview_dirty.begin(), chunk_overview_dirty.end(), true);
     if (parent_grid) parent_grid->content_generation++;  // #351 - view early-out
 }
 
@@ -171,10 +228,28 @@ void GridLayer::markDirty(int cell_x, int cell_y) {
     if (cell_x < 0 || cell_x >= grid_x || cell_y < 0 || cell_y >= grid_y) return;
 
     int chunk_idx = getChunkIndex(cell_x, cell_y);
-    if (chunk_idx >= 0 && chunk_idx < static_cast<int>(chunk_dirty.size())) {
-        chunk_dirty[chunk_idx] = true;
+    if (chunk_idx >= 0 && chunk_idx < static_cast<int>(chunk_dirty.size()) && !chunk_dirty[chunk_idx]) {
+        // Queue the cell so only its quad is rewritten; a chunk with many
+        // edits is cheaper to rebuild outright.
+        auto& pending = chunk_pending_cells[chunk_idx];
+        if (pending.size() >= PENDING_CELL_LIMIT) {
+            chunk_dirty[chunk_idx] = true;
+            pending.clear();
+        } else {
+            pending.push_back(cell_y * grid_x + cell_x);
+        }
     }
-    if (parent_grid) parent_grid->content_generation++;  // #351 - view early-out
+    if (chunk_idx >= 0 && chunk_idx < static_cast<int>(chunk_overview_dirty.size())) {
+        chunk_overview_dirty[chunk_idx] = true;
+    }
+    // #351 - view early-out; views redraw just this cell
+    if (parent_grid) parent_grid->damageCells(cell_x, cell_y, cell_x + 1, cell_y + 1);
+}
+
+void GridLayer::markChunkDirty(int chunk_idx) {
+    if (chunk_idx < 0 || chunk_idx >= static_cast<int>(chunk_dirty.size())) return;
+    chunk_dirty[chunk_idx] = true;
+    chunk_overview_dirty[chunk_idx] = true;
 }
 
 int GridLayer::getChunkIndex(int cell_x, int cell_y) const {
@@ -192,7 +267,7 @@ void GridLayer::getChunkBounds(int chunk_x, int chunk_y, int& start_x, int& star
 
 void GridLayer::ensureChunkTexture(int chunk_idx, int cell_width, int cell_height) {
     if (chunk_idx < 0 || chunk_idx >= static_cast<int>(chunk_textures.size())) return;
-    if (!chunk_textures[chunk_idx]) return;
+    if (!chunk_textures[chunk_idx]) chunk_textures[chunk_idx] = std::make_unique<sf::RenderTexture>();
 
     // Calculate chunk dimensions in cells
     int cx = chunk_idx % chunks_x;
@@ -227,6 +302,274 @@ void GridLayer::ensureChunkTexture(int chunk_idx, int cell_width, int cell_heigh
     cached_cell_height = cell_height;
 }
 
+void GridLayer::updateChunkVertices(int chunk_idx, int cell_width, int cell_height) {
+    if (vertices_cell_width != cell_width || vertices_cell_height != cell_height) {
+        // Quad positions are in pixels of the old cell size
+        std::fill(chunk_vertices_valid.begin(), chunk_vertices_valid.end(), false);
+        vertices_cell_width = cell_width;
+        vertices_cell_height = cell_height;
+    }
+
+    int start_x, start_y, end_x, end_y;
+    getChunkBounds(chunk_idx % chunks_x, chunk_idx / chunks_x, start_x, start_y, end_x, end_y);
+    int chunk_w = end_x - start_x;
+
+    sf::VertexArray& quads = chunk_vertices[chunk_idx];
+    auto& pending = chunk_pending_cells[chunk_idx];
+    auto writeCell = [&](int x, int y) {
+        size_t local = static_cast<size_t>(y - start_y) * chunk_w + (x - start_x);
+        writeCellQuad(x, y, static_cast<float>((x - start_x) * cell_width),
+                      static_cast<float>((y - start_y) * cell_height),
+                      cell_width, cell_height, &quads[local * 4]);
+    };
+
+    if (chunk_dirty[chunk_idx] || !chunk_vertices_valid[chunk_idx]) {
+        quads.setPrimitiveType(sf::Quads);
+        quads.resize(static_cast<size_t>(chunk_w) * (end_y - start_y) * 4);
+        for (int y = start_y; y < end_y; ++y) {
+            for (int x = start_x; x < end_x; ++x) {
+                writeCell(x, y);
+            }
+        }
+        chunk_vertices_valid[chunk_idx] = true;
+    } else {
+        // Repeats just rewrite the same 4 vertices
+        for (int cell : pending) {
+            writeCell(cell % grid_x, cell / grid_x);
+        }
+    }
+    pending.clear();
+}
+
+// Render a single chunk to its cached texture: one draw of its vertex array
+void GridLayer::renderChunkToTexture(int chunk_x, int chunk_y, int cell_width, int cell_height) {
+    int chunk_idx = chunk_y * chunks_x + chunk_x;
+    if (chunk_idx < 0 || chunk_idx >= static_cast<int>(chunk_textures.size())) return;
+
+    ensureChunkTexture(chunk_idx, cell_width, cell_height);
+    if (!chunk_texture_initialized[chunk_idx]) return;
+
+    updateChunkVertices(chunk_idx, cell_width, cell_height);
+
+    sf::RenderStates states;
+    states.texture = batchTexture();
+    chunk_textures[chunk_idx]->clear(sf::Color::Transparent);
+    chunk_textures[chunk_idx]->draw(chunk_vertices[chunk_idx], states);
+    chunk_textures[chunk_idx]->display();
+    chunk_dirty[chunk_idx] = false;
+    chunk_mips_valid[chunk_idx] = 0;
+    ChunkCache::get().touch(this, chunk_idx, chunkCacheBytes(chunk_idx));
+}
+
+void GridLayer::drawChunkDirect(sf::RenderTarget& target, int chunk_x, int chunk_y,
+                                float left_spritepixels, float top_spritepixels,
+                                float zoom, int cell_width, int cell_height) {
+    int chunk_idx = chunk_y * chunks_x + chunk_x;
+    updateChunkVertices(chunk_idx, cell_width, cell_height);
+    // No texture holds this chunk; a later ensureChunkTexture() re-dirties it.
+    chunk_dirty[chunk_idx] = false;
+    chunk_mips_valid[chunk_idx] = 0;
+
+    int start_x, start_y, end_x, end_y;
+    getChunkBounds(chunk_x, chunk_y, start_x, start_y, end_x, end_y);
+
+    sf::Transform transform;
+    transform.translate((start_x * cell_width - left_spritepixels) * zoom,
+                        (start_y * cell_height - top_spritepixels) * zoom);
+    transform.scale(zoom, zoom);
+    sf::RenderStates states(transform);
+    states.texture = batchTexture();
+    target.draw(chunk_vertices[chunk_idx], states);
+}
+
+int GridLayer::mipLevelForZoom(float zoom) {
+    int level = 0;
+    while (level < MIP_LEVELS && zoom <= 0.5f / (1 << level)) ++level;
+    return level;
+}
+
+sf::RenderTexture* GridLayer::chunkMip(int chunk_idx, int level) {
+    if (level == 0) {
+        return chunk_texture_initialized[chunk_idx] ? chunk_textures[chunk_idx].get() : nullptr;
+    }
+    sf::RenderTexture* src = chunkMip(chunk_idx, level - 1);
+    if (!src) return nullptr;
+
+    // Levels only go stale together (a full-size redraw clears every bit), so
+    // a valid bit here means the level above it is unchanged too
+    auto& mip = chunk_mips[chunk_idx][level - 1];
+    uint8_t bit = static_cast<uint8_t>(1 << (level - 1));
+    if (mip && (chunk_mips_valid[chunk_idx] & bit)) return mip.get();
+
+    sf::Vector2u src_size = src->getSize();
+    unsigned int w = std::max(1u, (src_size.x + 1) / 2);
+    unsigned int h = std::max(1u, (src_size.y + 1) / 2);
+    if (!mip) mip = std::make_unique<sf::RenderTexture>();
+    if (mip->getSize().x != w || mip->getSize().y != h) {
+        if (!mip->create(w, h)) {
+            mip.reset();
+            return nullptr;
+        }
+        mip->setSmooth(true);
+    }
+
+    // Bilinear sampling at half scale averages each 2x2 block of texels
+    src->setSmooth(true);
+    sf::Sprite half(src->getTexture());
+    half.setScale(static_cast<float>(w) / src_size.x, static_cast<float>(h) / src_size.y);
+    sf::RenderStates states;
+#if !defined(MCRF_HEADLESS) && !defined(MCRF_SDL2)
+    states.blendMode = sf::BlendNone;  // copy texels; blending would darken translucent cells again
+#endif
+    mip->clear(sf::Color::Transparent);
+    mip->draw(half, states);
+    mip->display();
+    if (level == 1) src->setSmooth(false);  // full-size blits stay pixel-exact
+
+    chunk_mips_valid[chunk_idx] |= bit;
+    return mip.get();
+}
+
+void GridLayer::renderOverview(sf::RenderTarget& target,
+                               float left_spritepixels, float top_spritepixels,
+                               int chunk_left, int chunk_top, int chunk_right, int chunk_bottom,
+                               float zoom, int cell_width, int cell_height) {
+    constexpr int CHUNKS_PER_BLOCK = OVERVIEW_BLOCK / CHUNK_SIZE;
+    std::vector<sf::Uint8> pixels;
+
+    // Rewrite the stale chunks in view, straight from layer data
+    for (int cy = chunk_top; cy <= chunk_bottom; ++cy) {
+        for (int cx = chunk_left; cx <= chunk_right; ++cx) {
+            int chunk_idx = cy * chunks_x + cx;
+            if (!chunk_overview_dirty[chunk_idx]) continue;
+
+            int bx = cx / CHUNKS_PER_BLOCK, by = cy / CHUNKS_PER_BLOCK;
+            auto& block = overview_blocks[by * overview_blocks_x + bx];
+            if (!block) {
+                block = std::make_unique<sf::Texture>();
+                unsigned int bw = std::min(OVERVIEW_BLOCK, grid_x - bx * OVERVIEW_BLOCK);
+                unsigned int bh = std::min(OVERVIEW_BLOCK, grid_y - by * OVERVIEW_BLOCK);
+                if (!block->create(bw, bh)) {
+                    block.reset();
+                    continue;
+                }
+                block->setSmooth(true);
+            }
+
+            int start_x, start_y, end_x, end_y;
+            getChunkBounds(cx, cy, start_x, start_y, end_x, end_y);
+            pixels.resize(static_cast<size_t>(end_x - start_x) * (end_y - start_y) * 4);
+            size_t i = 0;
+            for (int y = start_y; y < end_y; ++y) {
+                for (int x = start_x; x < end_x; ++x) {
+                    sf::Color c = overviewColor(x, y);
+                    pixels[i++] = c.r;
+                    pixels[i++] = c.g;
+                    pixels[i++] = c.b;
+                    pixels[i++] = c.a;
+                }
+            }
+            block->update(pixels.data(), end_x - start_x, end_y - start_y,
+                          start_x - bx * OVERVIEW_BLOCK, start_y - by * OVERVIEW_BLOCK);
+            chunk_overview_dirty[chunk_idx] = false;
+        }
+    }
+
+    // Draw the visible cell range of each block it touches
+    int cell_left = chunk_left * CHUNK_SIZE, cell_top = chunk_top * CHUNK_SIZE;
+    int cell_right = std::min(grid_x, (chunk_right + 1) * CHUNK_SIZE);
+    int cell_bottom = std::min(grid_y, (chunk_bottom + 1) * CHUNK_SIZE);
+    for (int by = chunk_top / CHUNKS_PER_BLOCK; by <= chunk_bottom / CHUNKS_PER_BLOCK; ++by) {
+        for (int bx = chunk_left / CHUNKS_PER_BLOCK; bx <= chunk_right / CHUNKS_PER_BLOCK; ++bx) {
+            auto& block = overview_blocks[by * overview_blocks_x + bx];
+            if (!block) continue;
+            int x0 = std::max(cell_left, bx * OVERVIEW_BLOCK);
+            int y0 = std::max(cell_top, by * OVERVIEW_BLOCK);
+            int x1 = std::min(cell_right, (bx + 1) * OVERVIEW_BLOCK);
+            int y1 = std::min(cell_bottom, (by + 1) * OVERVIEW_BLOCK);
+
+            sf::Sprite sprite(*block, sf::IntRect(x0 - bx * OVERVIEW_BLOCK, y0 - by * OVERVIEW_BLOCK,
+                                                  x1 - x0, y1 - y0));
+            sprite.setPosition(sf::Vector2f((x0 * cell_width - left_spritepixels) * zoom,
+                                            (y0 * cell_height - top_spritepixels) * zoom));
+            sprite.setScale(sf::Vector2f(zoom * cell_width, zoom * cell_height));
+            target.draw(sprite);
+        }
+    }
+}
+
+void GridLayer::renderChunks(sf::RenderTarget& target,
+                             float left_spritepixels, float top_spritepixels,
+                             int left_edge, int top_edge, int x_limit, int y_limit,
+                             float zoom, int cell_width, int cell_height) {
+    // Calculate visible chunk range
+    int chunk_left = std::max(0, left_edge / CHUNK_SIZE);
+    int chunk_top = std::max(0, top_edge / CHUNK_SIZE);
+    int chunk_right = std::min(chunks_x - 1, (x_limit + CHUNK_SIZE - 1) / CHUNK_SIZE);
+    int chunk_bottom = std::min(chunks_y - 1, (y_limit + CHUNK_SIZE - 1) / CHUNK_SIZE);
+
+    // A cell no bigger than a pixel: sprite detail is invisible, draw colors
+    if (zoom * std::max(cell_width, cell_height) <= 1.0f) {
+        renderOverview(target, left_spritepixels, top_spritepixels,
+                       chunk_left, chunk_top, chunk_right, chunk_bottom,
+                       zoom, cell_width, cell_height);
+        return;
+    }
+    int level = mipLevelForZoom(zoom);
+    auto& chunk_cache = ChunkCache::get();
+
+    // Iterate only over visible chunks
+    for (int cy = chunk_top; cy <= chunk_bottom; ++cy) {
+        for (int cx = chunk_left; cx <= chunk_right; ++cx) {
+            int chunk_idx = cy * chunks_x + cx;
+            // Re-render chunk only if dirty AND visible. A resident chunk
+            // rasterized again because it changed is a miss, not a hit.
+            if (chunkNeedsRender(chunk_idx)) {
+                ++chunk_cache.misses;
+                renderChunkToTexture(cx, cy, cell_width, cell_height);
+            } else if (chunk_cached[chunk_idx]) {
+                ++chunk_cache.hits;
+            } else {
+                ++chunk_cache.misses;
+            }
+
+            if (!chunk_texture_initialized[chunk_idx]) {
+                // Fallback: draw this chunk's quads directly
+                drawChunkDirect(target, cx, cy, left_spritepixels, top_spritepixels,
+                                zoom, cell_width, cell_height);
+                continue;
+            }
+
+            // Blit the chunk from the smallest cache that still covers its
+            // on-screen size (full size if a mip level can't be made)
+            const sf::RenderTexture* full = chunk_textures[chunk_idx].get();
+            const sf::RenderTexture* cache = level > 0 ? chunkMip(chunk_idx, level) : nullptr;
+            if (!cache) cache = full;
+
+            int start_x, start_y, end_x, end_y;
+            getChunkBounds(cx, cy, start_x, start_y, end_x, end_y);
+
+            // Chunk position in world pixel coordinates
+            float chunk_world_x = start_x * cell_width;
+            float chunk_world_y = start_y * cell_height;
+
+            // Position in target (accounting for viewport offset and zoom)
+            float dest_x = (chunk_world_x - left_spritepixels) * zoom;
+            float dest_y = (chunk_world_y - top_spritepixels) * zoom;
+
+            sf::Sprite chunk_sprite(cache->getTexture());
+            chunk_sprite.setPosition(sf::Vector2f(dest_x, dest_y));
+            chunk_sprite.setScale(sf::Vector2f(zoom * full->getSize().x / cache->getSize().x,
+                                               zoom * full->getSize().y / cache->getSize().y));
+
+            target.draw(chunk_sprite);
+
+            // Mark it recently drawn, counting any mip just built
+            chunk_cache.touch(this, chunk_idx, chunkCacheBytes(chunk_idx));
+        }
+    }
+}
+
 // =============================================================================
 // ColorLayer implementation
 // =============================================================================
@@ -259,6 +602,7 @@ void ColorLayer::fillRect(int x, int y, int width, int height, const sf::Color&
     int y1 = std::max(0, y);
     int x2 = std::min(grid_x, x + width);
     int y2 = std::min(grid_y, y + height);
+    if (x2 <= x1 || y2 <= y1) return;
 
     // Fill the rectangle
     for (int fy = y1; fy < y2; ++fy) {
@@ -276,11 +620,10 @@ void ColorLayer::fillRect(int x, int y, int width, int height, const sf::Color&
     for (int cy = chunk_y1; cy <= chunk_y2; ++cy) {
         for (int cx = chunk_x1; cx <= chunk_x2; ++cx) {
             int idx = cy * chunks_x + cx;
-            if (idx >= 0 && idx < static_cast<int>(chunk_dirty.size())) {
-                chunk_dirty[idx] = true;
-            }
+            markChunkDirty(idx);
         }
     }
+    if (parent_grid) parent_grid->damageCells(x1, y1, x2, y2);  // #351 - view early-out
 }
 
 void ColorLayer::drawFOV(int source_x, int source_y, int radius,
@@ -299,12 +642,13 @@ void ColorLayer::drawFOV(int source_x, int source_y, int radius,
 
     // Compute FOV on the parent grid
     parent_grid->computeFOV(source_x, source_y, radius, true, algorithm);
+    const auto& fov = parent_grid->fovMask();
 
     // Paint cells based on visibility
     for (int cy = 0; cy < grid_y; ++cy) {
         for (int cx = 0; cx < grid_x; ++cx) {
             // Check if in FOV (visible right now)
-            if (parent_grid->isInFOV(cx, cy)) {
+            if (fov.test(cx, cy)) {
                 colors[cy * grid_x + cx] = visible_color;
             }
             // Check if previously discovered (current color != unknown)
@@ -327,6 +671,7 @@ void ColorLayer::applyPerspective(std::shared_ptr<UIEntity> entity,
                                    const sf::Color& discovered,
                                    const sf::Color& unknown) {
     perspective_entity = entity;
+    perspective_faction.clear();
     perspective_visible = visible;
     perspective_discovered = discovered;
     perspective_unknown = unknown;
@@ -336,9 +681,61 @@ void ColorLayer::applyPerspective(std::shared_ptr<UIEntity> entity,
     updatePerspective();
 }
 
+void ColorLayer::applyFactionPerspective(const std::string& label,
+                                         const sf::Color& visible,
+                                         const sf::Color& discovered,
+                                         const sf::Color& unknown) {
+    perspective_entity.reset();
+    perspective_faction = label;
+    perspective_visible = visible;
+    perspective_discovered = discovered;
+    perspective_unknown = unknown;
+    has_perspective = true;
+
+    // Show the faction's current memory; later changes arrive through
+    // GridData::updateFaction().
+    if (parent_grid) paintFaction(parent_grid->faction(label), 0, 0, grid_x, grid_y);
+}
+
+void ColorLayer::paintFaction(const FactionPerspective& faction, int x0, int y0, int x1, int y1) {
+    x0 = std::max(0, x0);
+    y0 = std::max(0, y0);
+    x1 = std::min(grid_x, x1);
+    y1 = std::min(grid_y, y1);
+    if (x1 <= x0 || y1 <= y0) return;
+
+    // Memory sized for another grid (not yet updated since a resize) reads
+    // as all unknown.
+    const PerspectiveBits* bits = faction.bits();
+    bool usable = bits && bits->width() == grid_x && bits->height() == grid_y;
+    for (int cy = y0; cy < y1; ++cy) {
+        sf::Color* row = colors.data() + static_cast<size_t>(cy) * grid_x;
+        for (int cx = x0; cx < x1; ++cx) {
+            uint8_t state = usable ? bits->get(cx, cy) : 0;
+            row[cx] = state == 2 ? perspective_visible
+                    : state == 1 ? perspective_discovered
+                    : perspective_unknown;
+        }
+    }
+
+    for (int cy = y0 / CHUNK_SIZE; cy <= (y1 - 1) / CHUNK_SIZE; ++cy) {
+        for (int cx = x0 / CHUNK_SIZE; cx <= (x1 - 1) / CHUNK_SIZE; ++cx) {
+            int idx = cy * chunks_x + cx;
+            markChunkDirty(idx);
+        }
+    }
+    if (parent_grid) parent_grid->damageCells(x0, y0, x1, y1);  // #351 - view early-out
+}
+
 void ColorLayer::updatePerspective() {
     if (!has_perspective) return;
 
+    if (!perspective_faction.empty()) {
+        // Repaints this layer (and any other bound to the faction) on change.
+        if (parent_grid) parent_grid->updateFaction(perspective_faction);
+        return;
+    }
+
     auto entity = perspective_entity.lock();
     if (!entity) {
         // Entity was deleted, clear perspective
@@ -361,6 +758,7 @@ void ColorLayer::updatePerspective() {
 
 void ColorLayer::clearPerspective() {
     perspective_entity.reset();
+    perspective_faction.clear();
     has_perspective = false;
 }
 
@@ -384,40 +782,17 @@ void ColorLayer::resize(int new_grid_x, int new_grid_y) {
     initChunks();
 }
 
-// Render a single chunk to its cached texture
-void ColorLayer::renderChunkToTexture(int chunk_x, int chunk_y, int cell_width, int cell_height) {
-    int chunk_idx = chunk_y * chunks_x + chunk_x;
-    if (chunk_idx < 0 || chunk_idx >= static_cast<int>(chunk_textures.size())) return;
-    if (!chunk_textures[chunk_idx]) return;
-
-    ensureChunkTexture(chunk_idx, cell_width, cell_height);
-    if (!chunk_texture_initialized[chunk_idx]) return;
-
-    // Get chunk bounds
-    int start_x, start_y, end_x, end_y;
-    getChunkBounds(chunk_x, chunk_y, start_x, start_y, end_x, end_y);
-
-    chunk_textures[chunk_idx]->clear(sf::Color::Transparent);
-
-    sf::RectangleShape rect;
-    rect.setSize(sf::Vector2f(cell_width, cell_height));
-    rect.setOutlineThickness(0);
-
-    // Render only cells within this chunk (local coordinates in texture)
-    for (int x = start_x; x < end_x; ++x) {
-        for (int y = start_y; y < end_y; ++y) {
-            const sf::Color& color = at(x, y);
-            if (color.a == 0) continue;  // Skip fully transparent
-
-            // Position relative to chunk origin
-            rect.setPosition(sf::Vector2f((x - start_x) * cell_width, (y - start_y) * cell_height));
-            rect.setFillColor(color);
-            chunk_textures[chunk_idx]->draw(rect);
-        }
-    }
-
-    chunk_textures[chunk_idx]->display();
-    chunk_dirty[chunk_idx] = false;
+void ColorLayer::writeCellQuad(int x, int y, float px, float py,
+                               int cell_width, int cell_height, sf::Vertex* quad) const {
+    const sf::Color& color = at(x, y);
+    // Fully transparent cells collapse to a point and rasterize nothing
+    float w = color.a ? static_cast<float>(cell_width) : 0.0f;
+    float h = color.a ? static_cast<float>(cell_height) : 0.0f;
+    quad[0].position = sf::Vector2f(px, py);
+    quad[1].position = sf::Vector2f(px + w, py);
+    quad[2].position = sf::Vector2f(px + w, py + h);
+    quad[3].position = sf::Vector2f(px, py + h);
+    for (int i = 0; i < 4; ++i) quad[i].color = color;
 }
 
 // Legacy: render all chunks (used by fill, resize, etc.)
@@ -434,68 +809,8 @@ void ColorLayer::render(sf::RenderTarget& target,
                        int left_edge, int top_edge, int x_limit, int y_limit,
                        float zoom, int cell_width, int cell_height) {
     if (!visible) return;
-
-    // Calculate visible chunk range
-    int chunk_left = std::max(0, left_edge / CHUNK_SIZE);
-    int chunk_top = std::max(0, top_edge / CHUNK_SIZE);
-    int chunk_right = std::min(chunks_x - 1, (x_limit + CHUNK_SIZE - 1) / CHUNK_SIZE);
-    int chunk_bottom = std::min(chunks_y - 1, (y_limit + CHUNK_SIZE - 1) / CHUNK_SIZE);
-
-    // Iterate only over visible chunks
-    for (int cy = chunk_top; cy <= chunk_bottom; ++cy) {
-        for (int cx = chunk_left; cx <= chunk_right; ++cx) {
-            int chunk_idx = cy * chunks_x + cx;
-
-            // Re-render chunk only if dirty AND visible
-            if (chunk_dirty[chunk_idx] || !chunk_texture_initialized[chunk_idx]) {
-                renderChunkToTexture(cx, cy, cell_width, cell_height);
-            }
-
-            if (!chunk_texture_initialized[chunk_idx]) {
-                // Fallback: direct rendering for this chunk
-                int start_x, start_y, end_x, end_y;
-                getChunkBounds(cx, cy, start_x, start_y, end_x, end_y);
-
-                sf::RectangleShape rect;
-                rect.setSize(sf::Vector2f(cell_width * zoom, cell_height * zoom));
-                rect.setOutlineThickness(0);
-
-                for (int x = start_x; x < end_x; ++x) {
-                    for (int y = start_y; y < end_y; ++y) {
-                        const sf::Color& color = at(x, y);
-                        if (color.a == 0) continue;
-
-                        auto pixel_pos = sf::Vector2f(
-                            (x * cell_width - left_spritepixels) * zoom,
-                            (y * cell_height - top_spritepixels) * zoom
-                        );
-                        rect.setPosition(pixel_pos);
-                        rect.setFillColor(color);
-                        target.draw(rect);
-                    }
-                }
-                continue;
-            }
-
-            // Blit this chunk's texture to target
-            int start_x, start_y, end_x, end_y;
-            getChunkBounds(cx, cy, start_x, start_y, end_x, end_y);
-
-            // Chunk position in world pixel coordinates
-            float chunk_world_x = start_x * cell_width;
-            float chunk_world_y = start_y * cell_height;
-
-            // Position in target (accounting for viewport offset and zoom)
-            float dest_x = (chunk_world_x - left_spritepixels) * zoom;
-            float dest_y = (chunk_world_y - top_spritepixels) * zoom;
-
-            sf::Sprite chunk_sprite(chunk_textures[chunk_idx]->getTexture());
-            chunk_sprite.setPosition(sf::Vector2f(dest_x, dest_y));
-            chunk_sprite.setScale(sf::Vector2f(zoom, zoom));
-
-            target.draw(chunk_sprite);
-        }
-    }
+    renderChunks(target, left_spritepixels, top_spritepixels,
+                 left_edge, top_edge, x_limit, y_limit, zoom, cell_width, cell_height);
 }
 
 // =============================================================================
@@ -528,6 +843,7 @@ void TileLayer::fillRect(int x, int y, int width, int height, int tile_index) {
     int y1 = std::max(0, y);
     int x2 = std::min(grid_x, x + width);
     int y2 = std::min(grid_y, y + height);
+    if (x2 <= x1 || y2 <= y1) return;
 
     // Fill the rectangle
     for (int fy = y1; fy < y2; ++fy) {
@@ -545,11 +861,10 @@ void TileLayer::fillRect(int x, int y, int width, int height, int tile_index) {
     for (int cy = chunk_y1; cy <= chunk_y2; ++cy) {
         for (int cx = chunk_x1; cx <= chunk_x2; ++cx) {
             int idx = cy * chunks_x + cx;
-            if (idx >= 0 && idx < static_cast<int>(chunk_dirty.size())) {
-                chunk_dirty[idx] = true;
-            }
+            markChunkDirty(idx);
         }
     }
+    if (parent_grid) parent_grid->damageCells(x1, y1, x2, y2);  // #351 - view early-out
 }
 
 void TileLayer::resize(int new_grid_x, int new_grid_y) {
@@ -572,38 +887,37 @@ void TileLayer::resize(int new_grid_x, int new_grid_y) {
     initChunks();
 }
 
-// Render a single chunk to its cached texture
-void TileLayer::renderChunkToTexture(int chunk_x, int chunk_y, int cell_width, int cell_height) {
-    if (!texture) return;
-
-    int chunk_idx = chunk_y * chunks_x + chunk_x;
-    if (chunk_idx < 0 || chunk_idx >= static_cast<int>(chunk_textures.size())) return;
-    if (!chunk_textures[chunk_idx]) return;
-
-    ensureChunkTexture(chunk_idx, cell_width, cell_height);
-    if (!chunk_texture_initialized[chunk_idx]) return;
-
-    // Get chunk bounds
-    int start_x, start_y, end_x, end_y;
-    getChunkBounds(chunk_x, chunk_y, start_x, start_y, end_x, end_y);
-
-    chunk_textures[chunk_idx]->clear(sf::Color::Transparent);
+void TileLayer::writeCellQuad(int x, int y, float px, float py,
+                              int cell_width, int cell_height, sf::Vertex* quad) const {
+    int tile_index = at(x, y);
+    // Same source rect and unscaled size as texture->sprite(); no tile collapses
+    sf::IntRect r = (texture && tile_index >= 0) ? texture->spriteRect(tile_index) : sf::IntRect();
+    float w = static_cast<float>(r.width);
+    float h = static_cast<float>(r.height);
+    float u0 = static_cast<float>(r.left), v0 = static_cast<float>(r.top);
+    quad[0].position = sf::Vector2f(px, py);
+    quad[1].position = sf::Vector2f(px + w, py);
+    quad[2].position = sf::Vector2f(px + w, py + h);
+    quad[3].position = sf::Vector2f(px, py + h);
+    quad[0].texCoords = sf::Vector2f(u0, v0);
+    quad[1].texCoords = sf::Vector2f(u0 + w, v0);
+    quad[2].texCoords = sf::Vector2f(u0 + w, v0 + h);
+    quad[3].texCoords = sf::Vector2f(u0, v0 + h);
+    for (int i = 0; i < 4; ++i) quad[i].color = sf::Color::White;
+}
 
-    // Render only tiles within this chunk (local coordinates in texture)
-    for (int x = start_x; x < end_x; ++x) {
-        for (int y = start_y; y < end_y; ++y) {
-            int tile_index = at(x, y);
-            if (tile_index < 0) continue;  // No tile
+const sf::Texture* TileLayer::batchTexture() const {
+    return texture ? texture->getSFMLTexture() : nullptr;
+}
 
-            // Position relative to chunk origin
-            auto pixel_pos = sf::Vector2f((x - start_x) * cell_width, (y - start_y) * cell_height);
-            sf::Sprite sprite = texture->sprite(tile_index, pixel_pos, sf::Vector2f(1.0f, 1.0f));
-            chunk_textures[chunk_idx]->draw(sprite);
-        }
-    }
+sf::Color TileLayer::overviewColor(int x, int y) const {
+    int tile_index = at(x, y);
+    return (texture && tile_index >= 0) ? texture->spriteAverageColor(tile_index) : sf::Color::Transparent;
+}
 
-    chunk_textures[chunk_idx]->display();
-    chunk_dirty[chunk_idx] = false;
+void TileLayer::renderChunkToTexture(int chunk_x, int chunk_y, int cell_width, int cell_height) {
+    if (!texture) return;
+    GridLayer::renderChunkToTexture(chunk_x, chunk_y, cell_width, cell_height);
 }
 
 // Legacy: render all chunks (used by fill, resize, etc.)
@@ -620,63 +934,8 @@ void TileLayer::render(sf::RenderTarget& target,
                       int left_edge, int top_edge, int x_limit, int y_limit,
                       float zoom, int cell_width, int cell_height) {
     if (!visible || !texture) return;
-
-    // Calculate visible chunk range
-    int chunk_left = std::max(0, left_edge / CHUNK_SIZE);
-    int chunk_top = std::max(0, top_edge / CHUNK_SIZE);
-    int chunk_right = std::min(chunks_x - 1, (x_limit + CHUNK_SIZE - 1) / CHUNK_SIZE);
-    int chunk_bottom = std::min(chunks_y - 1, (y_limit + CHUNK_SIZE - 1) / CHUNK_SIZE);
-
-    // Iterate only over visible chunks
-    for (int cy = chunk_top; cy <= chunk_bottom; ++cy) {
-        for (int cx = chunk_left; cx <= chunk_right; ++cx) {
-            int chunk_idx = cy * chunks_x + cx;
-
-            // Re-render chunk only if dirty AND visible
-            if (chunk_dirty[chunk_idx] || !chunk_texture_initialized[chunk_idx]) {
-                renderChunkToTexture(cx, cy, cell_width, cell_height);
-            }
-
-            if (!chunk_texture_initialized[chunk_idx]) {
-                // Fallback: direct rendering for this chunk
-                int start_x, start_y, end_x, end_y;
-                getChunkBounds(cx, cy, start_x, start_y, end_x, end_y);
-
-                for (int x = start_x; x < end_x; ++x) {
-                    for (int y = start_y; y < end_y; ++y) {
-                        int tile_index = at(x, y);
-                        if (tile_index < 0) continue;
-
-                        auto pixel_pos = sf::Vector2f(
-                            (x * cell_width - left_spritepixels) * zoom,
-                            (y * cell_height - top_spritepixels) * zoom
-                        );
-                        sf::Sprite sprite = texture->sprite(tile_index, pixel_pos, sf::Vector2f(zoom, zoom));
-                        target.draw(sprite);
-                    }
-                }
-                continue;
-            }
-
-            // Blit this chunk's texture to target
-            int start_x, start_y, end_x, end_y;
-            getChunkBounds(cx, cy, start_x, start_y, end_x, end_y);
-
-            // Chunk position in world pixel coordinates
-            float chunk_world_x = start_x * cell_width;
-            float chunk_world_y = start_y * cell_height;
-
-            // Position in target (accounting for viewport offset and zoom)
-            float dest_x = (chunk_world_x - left_spritepixels) * zoom;
-            float dest_y = (chunk_world_y - top_spritepixels) * zoom;
-
-            sf::Sprite chunk_sprite(chunk_textures[chunk_idx]->getTexture());
-            chunk_sprite.setPosition(sf::Vector2f(dest_x, dest_y));
-            chunk_sprite.setScale(sf::Vector2f(zoom, zoom));
-
-            target.draw(chunk_sprite);
-        }
-    }
+    renderChunks(target, left_spritepixels, top_spritepixels,
+                 left_edge, top_edge, x_limit, y_limit, zoom, cell_width, cell_height);
 }
 
 // =============================================================================
@@ -855,18 +1114,20 @@ PyMethodDef PyGridLayerAPI::ColorLayer_methods[] = {
      )},
     {"apply_perspective", (PyCFunction)PyGridLayerAPI::ColorLayer_apply_perspective, METH_VARARGS | METH_KEYWORDS,
      MCRF_METHOD(ColorLayer, apply_perspective,
-         MCRF_SIG("(entity: Entity, visible: Color | None = None, discovered: Color | None = None, unknown: Color | None = None)", "None"),
-         MCRF_DESC("Bind this layer to an entity for automatic FOV updates. After binding, call update_perspective() when the entity moves.")
+         MCRF_SIG("(entity: Entity = None, visible: Color | None = None, discovered: Color | None = None, unknown: Color | None = None, faction: str = None)", "None"),
+         MCRF_DESC("Bind this layer to an entity, or to a faction, for automatic FOV updates. After binding to an entity, call update_perspective() when the entity moves. A faction-bound layer shows the union of what every entity with that label sees and is repainted by grid.update_faction().")
          MCRF_ARGS_START
          MCRF_ARG("entity", "The entity whose perspective to track")
          MCRF_ARG("visible", "Color for currently visible cells")
          MCRF_ARG("discovered", "Color for previously seen cells")
          MCRF_ARG("unknown", "Color for never-seen cells")
+         MCRF_ARG("faction", "Entity label whose shared perspective to track, instead of entity")
+         MCRF_RAISES("TypeError", "If neither or both of entity and faction are given")
      )},
     {"update_perspective", (PyCFunction)PyGridLayerAPI::ColorLayer_update_perspective, METH_NOARGS,
      MCRF_METHOD(ColorLayer, update_perspective,
          MCRF_SIG("()", "None"),
-         MCRF_DESC("Redraw FOV based on the bound entity's current position. Call this after the entity moves to update the visibility layer.")
+         MCRF_DESC("Redraw FOV based on the bound entity's current position. Call this after the entity moves to update the visibility layer. For a faction binding, equivalent to grid.update_faction(label).")
          MCRF_RAISES("RuntimeError", "If no perspective binding has been set via apply_perspective()")
      )},
     {"clear_perspective", (PyCFunction)PyGridLayerAPI::ColorLayer_clear_perspective, METH_NOARGS,
@@ -1317,14 +1578,24 @@ PyObject* PyGridLayerAPI::ColorLayer_draw_fov(PyColorLayerObject* self, PyObject
 }
 
 PyObject* PyGridLayerAPI::ColorLayer_apply_perspective(PyColorLayerObject* self, PyObject* args, PyObject* kwds) {
-    static const char* kwlist[] = {"entity", "visible", "discovered", "unknown", NULL};
-    PyObject* entity_obj;
+    static const char* kwlist[] = {"entity", "visible", "discovered", "unknown", "faction", NULL};
+    PyObject* entity_obj = Py_None;
     PyObject* visible_obj = nullptr;
     PyObject* discovered_obj = nullptr;
     PyObject* unknown_obj = nullptr;
+    const char* faction = nullptr;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|OOOOz", const_cast<char**>(kwlist),
+                                     &entity_obj, &visible_obj, &discovered_obj, &unknown_obj, &faction)) {
+        return NULL;
+    }
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|OOO", const_cast<char**>(kwlist),
-                                     &entity_obj, &visible_obj, &discovered_obj, &unknown_obj)) {
+    if ((entity_obj == Py_None) == (faction == nullptr)) {
+        PyErr_SetString(PyExc_TypeError, "apply_perspective() needs exactly one of entity or faction");
+        return NULL;
+    }
+    if (faction && !*faction) {
+        PyErr_SetString(PyExc_ValueError, "faction label must not be empty");
         return NULL;
     }
 
@@ -1338,16 +1609,19 @@ PyObject* PyGridLayerAPI::ColorLayer_apply_perspective(PyColorLayerObject* self,
         return NULL;
     }
 
-    if (!PyObject_IsInstance(entity_obj, (PyObject*)&mcrfpydef::PyUIEntityType)) {
-        PyErr_SetString(PyExc_TypeError, "entity must be an Entity object");
-        return NULL;
-    }
+    PyUIEntityObject* py_entity = nullptr;
+    if (!faction) {
+        if (!PyObject_IsInstance(entity_obj, (PyObject*)&mcrfpydef::PyUIEntityType)) {
+            PyErr_SetString(PyExc_TypeError, "entity must be an Entity object");
+            return NULL;
+        }
 
-    // Get the shared_ptr to the entity
-    PyUIEntityObject* py_entity = (PyUIEntityObject*)entity_obj;
-    if (!py_entity->data) {
-        PyErr_SetString(PyExc_RuntimeError, "Entity has no data");
-        return NULL;
+        // Get the shared_ptr to the entity
+        py_entity = (PyUIEntityObject*)entity_obj;
+        if (!py_entity->data) {
+            PyErr_SetString(PyExc_RuntimeError, "Entity has no data");
+            return NULL;
+        }
     }
 
     // Helper lambda to parse color
@@ -1382,7 +1656,11 @@ PyObject* PyGridLayerAPI::ColorLayer_apply_perspective(PyColorLayerObject* self,
     if (!parse_color(discovered_obj, discovered_color, discovered_color, "discovered")) return NULL;
     if (!parse_color(unknown_obj, unknown_color, unknown_color, "unknown")) return NULL;
 
-    self->data->applyPerspective(py_entity->data, visible_color, discovered_color, unknown_color);
+    if (faction) {
+        self->data->applyFactionPerspective(faction, visible_color, discovered_color, unknown_color);
+    } else {
+        self->data->applyPerspective(py_entity->data, visible_color, discovered_color, unknown_color);
+    }
     Py_RETURN_NONE;
 }
 
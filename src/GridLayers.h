@@ -2,7 +2,9 @@
 #include "Common.h"
 #include "Python.h"
 #include "structmember.h"
+#include "ChunkCache.h"
 #include <libtcod.h>
+#include <array>
 #include <memory>
 #include <vector>
 #include <string>
@@ -12,6 +14,7 @@ class GridData;
 class GridData;
 class PyTexture;
 class UIEntity;
+class FactionPerspective;
 
 // Include PyTexture.h for PyTextureObject (typedef, not struct)
 #include "PyTexture.h"
@@ -41,12 +44,45 @@ public:
 
     // Per-chunk dirty flags and RenderTextures
     std::vector<bool> chunk_dirty;                              // One flag per chunk
-    std::vector<std::unique_ptr<sf::RenderTexture>> chunk_textures;  // One texture per chunk
+    std::vector<std::unique_ptr<sf::RenderTexture>> chunk_textures;  // Created when first drawn
     std::vector<bool> chunk_texture_initialized;                // Track which textures are created
     int cached_cell_width, cached_cell_height;                  // Cell size used for cached textures
 
+    // Batched chunk geometry: one sf::Quads array per chunk, 4 vertices per
+    // cell in chunk-local row-major order and chunk-local pixels. Rendering a
+    // chunk texture is a single draw of its array instead of a draw per cell.
+    std::vector<sf::VertexArray> chunk_vertices;
+    std::vector<bool> chunk_vertices_valid;                     // Array matches the layer data
+    int vertices_cell_width, vertices_cell_height;              // Cell size the arrays were built for
+    // Cells edited through markDirty(x, y) since their chunk was last drawn
+    // (grid indices, may repeat). Only their quads are rewritten; beyond
+    // PENDING_CELL_LIMIT the chunk's array is rebuilt instead.
+    std::vector<std::vector<int>> chunk_pending_cells;
+    static constexpr size_t PENDING_CELL_LIMIT = CHUNK_SIZE * CHUNK_SIZE / 8;
+
+    // Downsampled chunk caches for zoomed-out views. Level L (1..MIP_LEVELS)
+    // is the chunk texture at 1/2^L scale, box-filtered from level L-1. Built
+    // lazily when a zoom selects it; a redraw of the full-size chunk texture
+    // (i.e. any chunk_dirty / pending-cell refresh) invalidates the pyramid.
+    static constexpr int MIP_LEVELS = 3;
+    std::vector<std::array<std::unique_ptr<sf::RenderTexture>, MIP_LEVELS>> chunk_mips;
+    std::vector<uint8_t> chunk_mips_valid;                      // Bit L-1 set: level L is current
+
+    // One-pixel-per-cell overview for zooms where a cell covers a pixel or
+    // less. Pixels come straight from layer data (overviewColor), so no chunk
+    // texture is built; each OVERVIEW_BLOCK-cell square is one texture, which
+    // bounds the draws of a whole-map view.
+    static constexpr int OVERVIEW_BLOCK = 1024;                 // Multiple of CHUNK_SIZE
+    int overview_blocks_x, overview_blocks_y;
+    std::vector<std::unique_ptr<sf::Texture>> overview_blocks;  // Created on first use
+    std::vector<bool> chunk_overview_dirty;                     // Chunk's overview pixels are stale
+
+    // Residency in the shared chunk texture budget (see ChunkCache)
+    std::vector<ChunkCache::Slot> chunk_cache_slots;            // Valid where chunk_cached
+    std::vector<bool> chunk_cached;
+
     GridLayer(GridLayerType type, int z_index, int grid_x, int grid_y, GridData* parent);
-    virtual ~GridLayer() = default;
+    virtual ~GridLayer();
 
     // Mark entire layer as needing re-render
     void markDirty();
@@ -54,6 +90,9 @@ public:
     // Mark specific cell's chunk as dirty
     void markDirty(int cell_x, int cell_y);
 
+    // Mark a whole chunk for re-render (full-size cache and overview pixels)
+    void markChunkDirty(int chunk_idx);
+
     // Get chunk index for a cell
     int getChunkIndex(int cell_x, int cell_y) const;
 
@@ -66,8 +105,66 @@ public:
     // Initialize chunk tracking arrays
     void initChunks();
 
+    // Bytes of texture (full size plus mips) a chunk holds
+    size_t chunkCacheBytes(int chunk_idx) const;
+
+    // Free a chunk's textures and geometry (ChunkCache eviction); it is
+    // re-rasterized the next time it is drawn
+    void evictChunk(int chunk_idx);
+
+    // Drop every chunk of this layer from the shared budget
+    void releaseChunkCache();
+
+    // True if the chunk's cached texture must be redrawn before use
+    bool chunkNeedsRender(int chunk_idx) const {
+        return chunk_dirty[chunk_idx] || !chunk_texture_initialized[chunk_idx] ||
+               !chunk_pending_cells[chunk_idx].empty();
+    }
+
+    // Bring a chunk's vertex array up to date (full rebuild or pending cells)
+    void updateChunkVertices(int chunk_idx, int cell_width, int cell_height);
+
+    // Fill the 4 vertices of cell (x, y), whose top-left corner is at
+    // (px, py) in chunk-local pixels. Empty cells get a degenerate quad.
+    virtual void writeCellQuad(int x, int y, float px, float py,
+                               int cell_width, int cell_height, sf::Vertex* quad) const = 0;
+
+    // Texture sampled by the quads (nullptr for untextured layers)
+    virtual const sf::Texture* batchTexture() const { return nullptr; }
+
     // Render a specific chunk to its cached texture (called when chunk is dirty)
-    virtual void renderChunkToTexture(int chunk_x, int chunk_y, int cell_width, int cell_height) = 0;
+    virtual void renderChunkToTexture(int chunk_x, int chunk_y, int cell_width, int cell_height);
+
+    // Draw a chunk's quads straight to target (when its texture is unavailable)
+    void drawChunkDirect(sf::RenderTarget& target, int chunk_x, int chunk_y,
+                         float left_spritepixels, float top_spritepixels,
+                         float zoom, int cell_width, int cell_height);
+
+    // Mip level to blit at zoom: the smallest cache still at least as large
+    // as its on-screen size (0 = full size)
+    static int mipLevelForZoom(float zoom);
+
+    // Mip `level` of a chunk, brought up to date from the level above; nullptr
+    // if the chunk has no full-size texture or a level can't be created
+    sf::RenderTexture* chunkMip(int chunk_idx, int level);
+
+    // Overview pixel for cell (x, y)
+    virtual sf::Color overviewColor(int x, int y) const = 0;
+
+    // Refresh stale overview pixels of the visible chunks and draw that part
+    // of the overview blocks
+    void renderOverview(sf::RenderTarget& target,
+                        float left_spritepixels, float top_spritepixels,
+                        int chunk_left, int chunk_top, int chunk_right, int chunk_bottom,
+                        float zoom, int cell_width, int cell_height);
+
+    // Draw the visible chunks from the cache that suits zoom: the overview
+    // when cells are a pixel or smaller, else a mip level or the full-size
+    // chunk texture (redrawing dirty chunks first)
+    void renderChunks(sf::RenderTarget& target,
+                      float left_spritepixels, float top_spritepixels,
+                      int left_edge, int top_edge, int x_limit, int y_limit,
+                      float zoom, int cell_width, int cell_height);
 
     // Render the layer content to the cached texture (legacy - marks all dirty)
     virtual void renderToTexture(int cell_width, int cell_height) = 0;
@@ -90,6 +187,9 @@ public:
 
     // Perspective binding (#113) - binds layer to entity for automatic FOV updates
     std::weak_ptr<UIEntity> perspective_entity;
+    // Faction binding: when non-empty the layer shows GridData's faction of
+    // this label instead of perspective_entity, repainted by updateFaction().
+    std::string perspective_faction;
     sf::Color perspective_visible;
     sf::Color perspective_discovered;
     sf::Color perspective_unknown;
@@ -121,14 +221,27 @@ public:
                           const sf::Color& discovered,
                           const sf::Color& unknown);
 
+    // Bind to a faction's shared memory (GridData::faction); paints it whole.
+    void applyFactionPerspective(const std::string& label,
+                                 const sf::Color& visible,
+                                 const sf::Color& discovered,
+                                 const sf::Color& unknown);
+
+    // Paint the half-open rect [x0,x1) x [y0,y1) from a faction's memory
+    // with the perspective colors and dirty the chunks it covers.
+    void paintFaction(const FactionPerspective& faction, int x0, int y0, int x1, int y1);
+
     // Update perspective - redraws based on bound entity's current position
+    // (or brings the bound faction up to date)
     void updatePerspective();
 
     // Clear perspective binding
     void clearPerspective();
 
-    // Render a specific chunk to its texture (called when chunk is dirty AND visible)
-    void renderChunkToTexture(int chunk_x, int chunk_y, int cell_width, int cell_height) override;
+    // One flat-colored quad per cell (transparent cells collapse)
+    void writeCellQuad(int x, int y, float px, float py,
+                       int cell_width, int cell_height, sf::Vertex* quad) const override;
+    sf::Color overviewColor(int x, int y) const override { return at(x, y); }
 
     // #148 - Render all content to cached texture (legacy - calls renderChunkToTexture for all)
     void renderToTexture(int cell_width, int cell_height) override;
@@ -160,6 +273,13 @@ public:
     // Fill a rectangular region with a tile index (#113)
     void fillRect(int x, int y, int width, int height, int tile_index);
 
+    // One textured quad per cell, sampling the sprite's rect (no tile collapses)
+    void writeCellQuad(int x, int y, float px, float py,
+                       int cell_width, int cell_height, sf::Vertex* quad) const override;
+    const sf::Texture* batchTexture() const override;
+    // The tile sprite's average color (transparent for no tile)
+    sf::Color overviewColor(int x, int y) const override;
+
     // Render a specific chunk to its texture (called when chunk is dirty AND visible)
     void renderChunkToTexture(int chunk_x, int chunk_y, int cell_width, int cell_height) override;
 
@@ -320,7 +440,7 @@ namespace mcrfpydef {
                            "    fill(color): Fill the entire layer with a single color\n"
                            "    fill_rect(x, y, w, h, color): Fill a rectangular region with a color\n"
                            "    draw_fov(...): Draw FOV-based visibility colors\n"
-                           "    apply_perspective(entity, ...): Bind layer to entity for automatic FOV updates\n\n"
+                           "    apply_perspective(entity | faction=, ...): Bind layer to an entity or faction for FOV updates\n\n"
                            "Example:\n"
                            "    fog = mcrfpy.ColorLayer(z_index=-1, name='fog')\n"
                            "    grid = mcrfpy.Grid(grid_size=(20, 15), layers=[fog])\n"
@@ -0,0 +1,379 @@
+#include "HPAGraph.h"
+#include "GridData.h"
+#include "WorkerPool.h"
+#include <algorithm>
+#include <queue>
+#include <tuple>
+
+using PathEngine::UNREACHABLE;
+
+namespace {
+
+// Pseudo-node ids for the query endpoints (real ids are below 2^31).
+constexpr uint32_t START_NODE = 0xFFFFFFFEu;
+constexpr uint32_t GOAL_NODE = 0xFFFFFFFDu;
+
+// Octile distance: admissible for both 8- and 4-connected costs.
+uint32_t octile(const PathEngine::StepCosts& costs, int dx, int dy) {
+    dx = std::abs(dx); dy = std::abs(dy);
+    if (!costs.diagonal) return costs.orthogonal * static_cast<uint32_t>(dx + dy);
+    int lo = std::min(dx, dy), hi = std::max(dx, dy);
+    uint32_t diag = std::min(costs.diagonal, 2 * costs.orthogonal);
+    return diag * static_cast<uint32_t>(lo) + costs.orthogonal * static_cast<uint32_t>(hi - lo);
+}
+
+// Search window over one cluster: a private copy of its walkable cells so the
+// search cannot leave the cluster.
+struct ClusterWindow {
+    std::vector<uint8_t> walkable;
+    PathEngine::Terrain terrain;
+
+    void load(const GridData& grid, int x0, int y0, int w, int h) {
+        walkable.resize(static_cast<size_t>(w) * h);
+        for (int y = 0; y < h; y++) {
+            const uint8_t* row = grid.walkable_plane.data() + static_cast<size_t>(y0 + y) * grid.grid_w + x0;
+            std::copy(row, row + w, walkable.data() + static_cast<size_t>(y) * w);
+        }
+        terrain = PathEngine::Terrain{};
+        terrain.width = w;
+        terrain.height = h;
+        terrain.walkable = walkable.data();
+    }
+};
+
+// Entrance positions along the open border run [begin, end): the middle of a
+// short run, both ends of a long one.
+void addRun(std::vector<int>& out, int begin, int end) {
+    int len = end - begin;
+    if (len <= 0) return;
+    if (len < HPAGraph::WIDE_ENTRANCE) {
+        out.push_back(begin + len / 2);
+    } else {
+        out.push_back(begin);
+        out.push_back(end - 1);
+    }
+}
+
+} // namespace
+
+void HPAGraph::sync(const GridData& grid, const PathEngine::StepCosts& step_costs)
+{
+    bool reshape = !is_built || source != &grid || width != grid.grid_w || height != grid.grid_h ||
+                   costs.orthogonal != step_costs.orthogonal || costs.diagonal != step_costs.diagonal;
+    const uint32_t* changed = nullptr;
+    size_t count = 0;
+    if (!reshape) {
+        if (walkability_generation == grid.walkability_generation) return;
+        reshape = !grid.walkabilityChangesSince(walkability_generation, &changed, &count);
+    }
+
+    source = &grid;
+    costs = step_costs;
+    walkability_generation = grid.walkability_generation;
+    if (reshape) {
+        fullBuild(grid);
+        return;
+    }
+
+    std::vector<char> dirty(clusters.size(), 0);
+    for (size_t i = 0; i < count; i++) {
+        int x = static_cast<int>(changed[i] % static_cast<uint32_t>(width));
+        int y = static_cast<int>(changed[i] / static_cast<uint32_t>(width));
+        dirty[clusterOf(x, y)] = 1;
+    }
+
+    // Every border of a dirty cluster may have gained or lost entrances, and
+    // with them the nodes of the cluster on the other side.
+    std::vector<char> rebuild(clusters.size(), 0);
+    for (int c = 0; c < static_cast<int>(clusters.size()); c++) {
+        if (!dirty[c]) continue;
+        int cx = c % clusters_x, cy = c / clusters_x;
+        scanEast(grid, c);
+        scanSouth(grid, c);
+        rebuild[c] = 1;
+        if (cx > 0) { scanEast(grid, c - 1); rebuild[c - 1] = 1; }
+        if (cy > 0) { scanSouth(grid, c - clusters_x); rebuild[c - clusters_x] = 1; }
+        if (cx + 1 < clusters_x) rebuild[c + 1] = 1;
+        if (cy + 1 < clusters_y) rebuild[c + clusters_x] = 1;
+    }
+    std::vector<int> which;
+    for (int c = 0; c < static_cast<int>(clusters.size()); c++) {
+        if (rebuild[c]) which.push_back(c);
+    }
+    rebuildClusters(grid, which);
+}
+
+void HPAGraph::fullBuild(const GridData& grid)
+{
+    width = grid.grid_w;
+    height = grid.grid_h;
+    clusters_x = width > 0 ? (width + CLUSTER_SIZE - 1) / CLUSTER_SIZE : 0;
+    clusters_y = height > 0 ? (height + CLUSTER_SIZE - 1) / CLUSTER_SIZE : 0;
+    size_t n = static_cast<size_t>(clusters_x) * clusters_y;
+
+    clusters.assign(n, Cluster{});
+    east.assign(n, {});
+    south.assign(n, {});
+    for (int c = 0; c < static_cast<int>(n); c++) {
+        Cluster& cl = clusters[c];
+        cl.x0 = (c % clusters_x) * CLUSTER_SIZE;
+        cl.y0 = (c / clusters_x) * CLUSTER_SIZE;
+        cl.w = std::min(CLUSTER_SIZE, width - cl.x0);
+        cl.h = std::min(CLUSTER_SIZE, height - cl.y0);
+    }
+    for (int c = 0; c < static_cast<int>(n); c++) {
+        scanEast(grid, c);
+        scanSouth(grid, c);
+    }
+
+    std::vector<int> all(n);
+    for (size_t c = 0; c < n; c++) all[c] = static_cast<int>(c);
+    rebuildClusters(grid, all);
+
+    is_built = true;
+    counters.full_builds++;
+}
+
+void HPAGraph::scanEast(const GridData& grid, int c)
+{
+    auto& out = east[c];
+    out.clear();
+    const Cluster& cl = clusters[c];
+    if (c % clusters_x + 1 >= clusters_x) return;
+
+    int x = cl.x0 + cl.w - 1;
+    std::vector<int> picks;
+    int run = -1;
+    for (int y = cl.y0; y <= cl.y0 + cl.h; y++) {
+        bool open = y < cl.y0 + cl.h && grid.isWalkable(x, y) && grid.isWalkable(x + 1, y);
+        if (open && run < 0) run = y;
+        if (!open && run >= 0) { addRun(picks, run, y); run = -1; }
+    }
+    for (int y : picks) {
+        uint32_t inside = static_cast<uint32_t>(y) * width + x;
+        out.push_back({inside, inside + 1});
+    }
+}
+
+void HPAGraph::scanSouth(const GridData& grid, int c)
+{
+    auto& out = south[c];
+    out.clear();
+    const Cluster& cl = clusters[c];
+    if (c / clusters_x + 1 >= clusters_y) return;
+
+    int y = cl.y0 + cl.h - 1;
+    std::vector<int> picks;
+    int run = -1;
+    for (int x = cl.x0; x <= cl.x0 + cl.w; x++) {
+        bool open = x < cl.x0 + cl.w && grid.isWalkable(x, y) && grid.isWalkable(x, y + 1);
+        if (open && run < 0) run = x;
+        if (!open && run >= 0) { addRun(picks, run, x); run = -1; }
+    }
+    for (int x : picks) {
+        uint32_t inside = static_cast<uint32_t>(y) * width + x;
+        out.push_back({inside, inside + static_cast<uint32_t>(width)});
+    }
+}
+
+void HPAGraph::rebuildCluster(const GridData& grid, int c)
+{
+    Cluster& cl = clusters[c];
+    int cx = c % clusters_x, cy = c / clusters_x;
+    cl.nodes.clear();
+    cl.across.clear();
+
+    auto link = [&cl](uint32_t inside, uint32_t outside) {
+        auto it = std::find(cl.nodes.begin(), cl.nodes.end(), inside);
+        size_t i = static_cast<size_t>(it - cl.nodes.begin());
+        if (it == cl.nodes.end()) {
+            cl.nodes.push_back(inside);
+            cl.across.emplace_back();
+        }
+        cl.across[i].push_back(outside);
+    };
+    for (const auto& t : east[c]) link(t.inside, t.outside);
+    for (const auto& t : south[c]) link(t.inside, t.outside);
+    if (cx > 0) for (const auto& t : east[c - 1]) link(t.outside, t.inside);
+    if (cy > 0) for (const auto& t : south[c - clusters_x]) link(t.outside, t.inside);
+
+    size_t n = cl.nodes.size();
+    cl.dist.assign(n * n, UNREACHABLE);
+    if (n == 0) return;
+
+    thread_local ClusterWindow window;
+    thread_local std::vector<uint32_t> field;
+    window.load(grid, cl.x0, cl.y0, cl.w, cl.h);
+    std::vector<sf::Vector2i> root(1);
+    for (size_t i = 0; i < n; i++) {
+        root[0] = sf::Vector2i(static_cast<int>(cl.nodes[i] % width) - cl.x0,
+                               static_cast<int>(cl.nodes[i] / width) - cl.y0);
+        PathEngine::computeDistances(window.terrain, costs, root, field);
+        for (size_t j = 0; j < n; j++) {
+            int lx = static_cast<int>(cl.nodes[j] % width) - cl.x0;
+            int ly = static_cast<int>(cl.nodes[j] / width) - cl.y0;
+            cl.dist[i * n + j] = field[static_cast<size_t>(ly) * cl.w + lx];
+        }
+    }
+}
+
+void HPAGraph::rebuildClusters(const GridData& grid, const std::vector<int>& which)
+{
+    WorkerPool::instance().parallelFor(which.size(), 4,
+        [&](size_t begin, size_t end, unsigned) {
+            for (size_t i = begin; i < end; i++) rebuildCluster(grid, which[i]);
+        });
+    counters.cluster_rebuilds += which.size();
+}
+
+void HPAGraph::endpointCosts(const GridData& grid, int c, sf::Vector2i p, std::vector<uint32_t>& out) const
+{
+    const Cluster& cl = clusters[c];
+    out.assign(cl.nodes.size(), UNREACHABLE);
+    if (cl.nodes.empty()) return;
+
+    thread_local ClusterWindow window;
+    thread_local std::vector<uint32_t> field;
+    window.load(grid, cl.x0, cl.y0, cl.w, cl.h);
+    std::vector<sf::Vector2i> root{ sf::Vector2i(p.x - cl.x0, p.y - cl.y0) };
+    PathEngine::computeDistances(window.terrain, costs, root, field);
+    for (size_t j = 0; j < cl.nodes.size(); j++) {
+        int lx = static_cast<int>(cl.nodes[j] % width) - cl.x0;
+        int ly = static_cast<int>(cl.nodes[j] / width) - cl.y0;
+        out[j] = field[static_cast<size_t>(ly) * cl.w + lx];
+    }
+}
+
+bool HPAGraph::findPath(const PathEngine::Terrain& terrain, sf::Vector2i start, sf::Vector2i goal,
+                        std::vector<sf::Vector2i>& path)
+{
+    counters.queries++;
+    path.clear();
+    if (!terrain.inBounds(start.x, start.y) || !terrain.inBounds(goal.x, goal.y)) return false;
+    if (start == goal) return true;
+
+    PathEngine::Heuristic flat_h = costs.diagonal ? PathEngine::Heuristic::DIAGONAL
+                                                  : PathEngine::Heuristic::MANHATTAN;
+    auto flat = [&]() {
+        counters.fallbacks++;
+        path.clear();
+        return PathEngine::findPath(terrain, costs, start, goal, flat_h, 1.0f, path);
+    };
+
+    size_t goal_idx = static_cast<size_t>(goal.y) * terrain.width + goal.x;
+    if (!terrain.passable(goal_idx)) return false;
+    if (!is_built || !source || terrain.width != width || terrain.height != height) return flat();
+
+    int sc = clusterOf(start.x, start.y), gc = clusterOf(goal.x, goal.y);
+    int dcx = std::abs(sc % clusters_x - gc % clusters_x);
+    int dcy = std::abs(sc / clusters_x - gc / clusters_x);
+    // Neighbouring clusters: one flat search is already short.
+    if (dcx <= 1 && dcy <= 1) return flat();
+
+    std::vector<uint32_t> from_start, to_goal;
+    endpointCosts(*source, sc, start, from_start);
+    endpointCosts(*source, gc, goal, to_goal);
+
+    // Abstract A* over entrance nodes, keyed (cluster, local index) so the
+    // bookkeeping lives in per-cluster arrays instead of a hash map.
+    if (++search_epoch == 0) {
+        for (auto& cl : clusters) cl.epoch = 0;
+        search_epoch = 1;
+    }
+    auto touch = [&](int c) -> Cluster& {
+        Cluster& cl = clusters[c];
+        if (cl.epoch != search_epoch) {
+            cl.epoch = search_epoch;
+            cl.g.assign(cl.nodes.size(), UNREACHABLE);
+            cl.parent.assign(cl.nodes.size(), START_NODE);
+        }
+        return cl;
+    };
+    uint32_t goal_g = UNREACHABLE, goal_parent = START_NODE;
+
+    using Entry = std::tuple<uint32_t, uint32_t, uint32_t>;  // f, g, node
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+    auto relax = [&](int c, size_t i, uint32_t g, uint32_t parent) {
+        Cluster& cl = touch(c);
+        if (g >= cl.g[i]) return;
+        cl.g[i] = g;
+        cl.parent[i] = parent;
+        uint32_t cell = cl.nodes[i];
+        uint32_t f = g + octile(costs, goal.x - static_cast<int>(cell % width),
+                                goal.y - static_cast<int>(cell / width));
+        open.emplace(f, g, nodeId(c, i));
+    };
+
+    {
+        const Cluster& cl = clusters[sc];
+        for (size_t j = 0; j < cl.nodes.size(); j++) {
+            if (from_start[j] != UNREACHABLE) relax(sc, j, from_start[j], START_NODE);
+        }
+    }
+    while (!open.empty()) {
+        auto [f, g, node] = open.top();
+        open.pop();
+        if (node == GOAL_NODE) break;
+        int c = static_cast<int>(node >> NODE_BITS);
+        size_t i = node & ((1u << NODE_BITS) - 1);
+        const Cluster& cl = clusters[c];
+        if (cl.g[i] != g) continue;  // stale entry
+
+        size_t n = cl.nodes.size();
+        for (size_t j = 0; j < n; j++) {
+            uint32_t d = cl.dist[i * n + j];
+            if (j != i && d != UNREACHABLE) relax(c, j, g + d, node);
+        }
+        for (uint32_t other : cl.across[i]) {
+            int oc = clusterOf(static_cast<int>(other % width), static_cast<int>(other / width));
+            const auto& on = clusters[oc].nodes;
+            size_t j = static_cast<size_t>(std::find(on.begin(), on.end(), other) - on.begin());
+            if (j < on.size()) relax(oc, j, g + costs.orthogonal, node);
+        }
+        if (c == gc && to_goal[i] != UNREACHABLE && g + to_goal[i] < goal_g) {
+            goal_g = g + to_goal[i];
+            goal_parent = node;
+            open.emplace(goal_g, goal_g, GOAL_NODE);
+        }
+    }
+    if (goal_g == UNREACHABLE) return flat();
+
+    std::vector<sf::Vector2i> waypoints;
+    for (uint32_t node = goal_parent; node != START_NODE;) {
+        const Cluster& cl = clusters[node >> NODE_BITS];
+        size_t i = node & ((1u << NODE_BITS) - 1);
+        waypoints.emplace_back(static_cast<int>(cl.nodes[i] % width), static_cast<int>(cl.nodes[i] / width));
+        node = cl.parent[i];
+    }
+    std::reverse(waypoints.begin(), waypoints.end());
+    waypoints.push_back(goal);
+
+    // Refine hop by hop on the caller's terrain (overlay, weights).
+    std::vector<sf::Vector2i> segment;
+    sf::Vector2i at = start;
+    for (const sf::Vector2i& next : waypoints) {
+        if (next == at) continue;
+        if (!PathEngine::findPath(terrain, costs, at, next, flat_h, 1.0f, segment)) return flat();
+        path.insert(path.end(), segment.begin(), segment.end());
+        at = next;
+    }
+    return true;
+}
+
+size_t HPAGraph::nodeCount() const
+{
+    size_t n = 0;
+    for (const auto& cl : clusters) n += cl.nodes.size();
+    return n;
+}
+
+size_t HPAGraph::edgeCount() const
+{
+    size_t n = 0;
+    for (const auto& cl : clusters) {
+        for (uint32_t d : cl.dist) n += d != UNREACHABLE ? 1 : 0;
+        n -= cl.nodes.size();  // the zero diagonal
+        for (const auto& a : cl.across) n += a.size();
+    }
+    return n;
+}
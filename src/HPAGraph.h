@@ -0,0 +1,104 @@
+#pragma once
+// HPAGraph.h - Hierarchical pathfinding (HPA*) over GridData's walkable plane.
+//
+// The grid is tiled into square clusters. Each open stretch of a border
+// between two clusters becomes one or two entrances (a cell pair straddling
+// the border), and every cluster stores the in-cluster cost between each pair
+// of its entrance cells. A query links start and goal into their clusters,
+// runs A* over that small abstract graph, and refines each hop with
+// PathEngine::findPath, so a cross-map path costs a few short searches
+// instead of one that floods the map.
+//
+// The graph follows the grid through walkability_generation and its change
+// log (as DijkstraMap::refresh does): an edit rescans the borders of its
+// cluster and rebuilds that cluster and the neighbours sharing those borders.
+// Paths are not always shortest - in-cluster costs and the entrance choice
+// are approximations - but refinement keeps every hop optimal.
+
+#include "Common.h"
+#include "PathEngine.h"
+#include <cstdint>
+#include <vector>
+
+class GridData;
+
+class HPAGraph {
+public:
+    // Cluster edge in cells. Clusters are laid out like GridLayer's render
+    // chunks (row-major, partial clusters on the right and bottom edges) at
+    // half of GridLayer::CHUNK_SIZE, which keeps a cluster rebuild and the
+    // start/goal insertion to about a thousand cells each.
+    static constexpr int CLUSTER_SIZE = 32;
+    // Open border runs at least this long get an entrance at each end rather
+    // than one in the middle.
+    static constexpr int WIDE_ENTRANCE = 6;
+
+    struct Stats {
+        uint64_t full_builds = 0;
+        uint64_t cluster_rebuilds = 0;
+        uint64_t queries = 0;
+        uint64_t fallbacks = 0;  // answered by flat A* (nearby endpoints or no abstract route)
+    };
+
+    // Bring the graph up to date with the grid for these step costs. Builds
+    // on first use; a resize, a different diagonal cost, or edits older than
+    // the grid's change log rebuild everything. Main thread only. The full
+    // build runs clusters on WorkerPool.
+    void sync(const GridData& grid, const PathEngine::StepCosts& costs);
+
+    // Like PathEngine::findPath: fills `path` with the steps after start,
+    // ending at goal. Call sync() first. The abstract search sees walkability
+    // only; terrain's overlay and weights are honoured while refining, and a
+    // route they break is retried as flat A*. Touches no Python state.
+    bool findPath(const PathEngine::Terrain& terrain, sf::Vector2i start, sf::Vector2i goal,
+                  std::vector<sf::Vector2i>& path);
+
+    bool built() const { return is_built; }
+    size_t clusterCount() const { return clusters.size(); }
+    size_t nodeCount() const;
+    size_t edgeCount() const;
+    const Stats& stats() const { return counters; }
+
+private:
+    struct Transition {
+        uint32_t inside;   // cell in this cluster
+        uint32_t outside;  // cell across the border
+    };
+    struct Cluster {
+        int x0 = 0, y0 = 0, w = 0, h = 0;
+        std::vector<uint32_t> nodes;                // entrance cells (grid indices)
+        std::vector<uint32_t> dist;                 // nodes x nodes in-cluster costs
+        std::vector<std::vector<uint32_t>> across;  // per node: cells it enters across a border
+        // Query scratch, valid while epoch == search_epoch
+        std::vector<uint32_t> g;
+        std::vector<uint32_t> parent;
+        uint32_t epoch = 0;
+    };
+    // Abstract node id: cluster << NODE_BITS | local index. A cluster has at
+    // most one entrance per border cell.
+    static constexpr int NODE_BITS = 8;
+    static_assert(4 * CLUSTER_SIZE <= (1 << NODE_BITS), "entrance index must fit NODE_BITS");
+    static uint32_t nodeId(int c, size_t i) { return (static_cast<uint32_t>(c) << NODE_BITS) | static_cast<uint32_t>(i); }
+
+    int clusterOf(int x, int y) const { return (y / CLUSTER_SIZE) * clusters_x + (x / CLUSTER_SIZE); }
+    void fullBuild(const GridData& grid);
+    void scanEast(const GridData& grid, int c);
+    void scanSouth(const GridData& grid, int c);
+    void rebuildCluster(const GridData& grid, int c);
+    void rebuildClusters(const GridData& grid, const std::vector<int>& which);
+    // Cost from (x, y) to each node of cluster c, searching inside it.
+    void endpointCosts(const GridData& grid, int c, sf::Vector2i p, std::vector<uint32_t>& out) const;
+
+    const GridData* source = nullptr;  // grid the graph was last synced with
+    int width = 0, height = 0;
+    int clusters_x = 0, clusters_y = 0;
+    PathEngine::StepCosts costs;
+    uint32_t walkability_generation = 0;
+    bool is_built = false;
+    uint32_t search_epoch = 0;
+
+    std::vector<Cluster> clusters;
+    std::vector<std::vector<Transition>> east;   // border between c and c + 1
+    std::vector<std::vector<Transition>> south;  // border between c and c + clusters_x
+    Stats counters;
+};
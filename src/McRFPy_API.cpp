@@ -64,6 +64,7 @@
 #include "UICircle.h"
 #include "UIArc.h"
 #include "GridLayers.h"
+#include "PyStepEvents.h"
 #include "Resources.h"
 #include "PyScene.h"
 #include "PythonObjectCache.h"
@@ -220,6 +221,50 @@ static PyObject* mcrfpy_get_save_dir(PyObject* self, void* closure)
 #endif
 }
 
+static PyObject* mcrfpy_get_chunk_cache_budget(PyObject* self, void* closure)
+{
+    return PyLong_FromSize_t(ChunkCache::get().budget());
+}
+
+static int mcrfpy_set_chunk_cache_budget(PyObject* self, PyObject* value, void* closure)
+{
+    if (!value) {
+        PyErr_SetString(PyExc_AttributeError, "cannot delete 'chunk_cache_budget'");
+        return -1;
+    }
+    if (!PyLong_Check(value)) {
+        PyErr_SetString(PyExc_TypeError, "chunk_cache_budget must be an int (bytes)");
+        return -1;
+    }
+    long long bytes = PyLong_AsLongLong(value);
+    if (bytes == -1 && PyErr_Occurred()) return -1;
+    if (bytes < 0) {
+        PyErr_SetString(PyExc_ValueError, "chunk_cache_budget must be non-negative");
+        return -1;
+    }
+    ChunkCache::get().setBudget(static_cast<size_t>(bytes));
+    return 0;
+}
+
+static PyObject* mcrfpy_get_occlusion_culling(PyObject* self, void* closure)
+{
+    return PyBool_FromLong(UIDrawable::occlusion_culling);
+}
+
+static int mcrfpy_set_occlusion_culling(PyObject* self, PyObject* value, void* closure)
+{
+    if (!value) {
+        PyErr_SetString(PyExc_AttributeError, "cannot delete 'occlusion_culling'");
+        return -1;
+    }
+    if (!PyBool_Check(value)) {
+        PyErr_SetString(PyExc_TypeError, "occlusion_culling must be a bool");
+        return -1;
+    }
+    UIDrawable::occlusion_culling = (value == Py_True);
+    return 0;
+}
+
 static PyGetSetDef mcrfpy_module_getset[] = {
     {"current_scene", mcrfpy_get_current_scene, mcrfpy_set_current_scene,
      MCRF_PROPERTY(current_scene,
@@ -248,6 +293,17 @@ static PyGetSetDef mcrfpy_module_getset[] = {
      MCRF_PROPERTY(default_transition_duration,
          "Default scene-transition duration in seconds (float). Must be non-negative."
      ), NULL},
+    {"chunk_cache_budget", mcrfpy_get_chunk_cache_budget, mcrfpy_set_chunk_cache_budget,
+     MCRF_PROPERTY(chunk_cache_budget,
+         "Memory budget in bytes (int) shared by all grid layers' cached chunk textures. "
+         "Least recently drawn chunks beyond it are freed and re-rendered when next visible. "
+         "Default 256 MiB; lowering it evicts immediately."
+     ), NULL},
+    {"occlusion_culling", mcrfpy_get_occlusion_culling, mcrfpy_set_occlusion_culling,
+     MCRF_PROPERTY(occlusion_culling,
+         "Skip drawing drawables entirely covered by an opaque Frame later in the same "
+         "child list (bool, default True). Off-screen and clipped drawables are always skipped."
+     ), NULL},
     {"save_dir", mcrfpy_get_save_dir, NULL,
      MCRF_PROPERTY(save_dir,
          "Directory used for persistent save data (str, read-only). '/save' under Emscripten."
@@ -389,7 +445,7 @@ static PyMethodDef mcrfpyMethods[] = {
      MCRF_METHOD(mcrfpy, get_metrics,
          MCRF_SIG("()", "dict"),
          MCRF_DESC("Get current performance metrics."),
-         MCRF_RETURNS("dict: Performance data with keys: frame_time (last frame duration in MILLISECONDS), avg_frame_time (rolling mean frame time over the last 60 frames, in milliseconds), fps (frames per second, derived from avg_frame_time -- a rolling average, not an instantaneous rate), draw_calls (number of draw calls), ui_elements (total UI element count), visible_elements (visible element count), current_frame (frame counter), runtime (total runtime in seconds), grid_render_time (grid rendering time in ms), entity_render_time (entity rendering time in ms), fov_overlay_time (FOV overlay rendering time in ms), python_time (Python script execution time in ms), animation_time (animation processing time in ms), grid_cells_rendered (grid cell draws this frame, counted per layer), entities_rendered (number of entities drawn this frame), total_entities (total entity count across all rendered grids)")
+         MCRF_RETURNS("dict: Performance data with keys: frame_time (last frame duration in MILLISECONDS), avg_frame_time (rolling mean frame time over the last 60 frames, in milliseconds), fps (frames per second, derived from avg_frame_time -- a rolling average, not an instantaneous rate), draw_calls (number of draw calls), ui_elements (UI elements walked in scene and frame child lists), visible_elements (elements drawn: not hidden, culled or occluded), culled_elements (skipped as entirely outside the window or a clipping parent), occluded_elements (skipped as entirely under an opaque Frame; see occlusion_culling), ui_batch_draw_calls (draw calls spent on runs of captions and sprites sharing a texture in scene and frame child lists; included in draw_calls), glyph_runs_built (captions whose glyph layout was rebuilt because their text, font, size or outline changed), retained_blits / retained_rebuilds (layers of Scene.retained scenes drawn as one cached blit / rasterized again), frame_partial_recomposites / frame_full_rebuilds (cached Frame rasters repainted only where changed children were and are / redrawn with every child), current_frame (frame counter), runtime (total runtime in seconds), grid_render_time (grid rendering time in ms), entity_render_time (entity rendering time in ms), fov_overlay_time (FOV overlay rendering time in ms), python_time (Python script execution time in ms), animation_time (animation processing time in ms), animations_updated / animations_batched (animations advanced in the last simulation frame / how many of those were scalar tweens updated in batches per easing function), grid_cells_rendered (grid cell draws this frame, counted per layer), entities_rendered (number of entities drawn this frame), entity_draw_calls (draw calls spent on grid entities; visible entities are batched into one call per texture, and these calls are included in draw_calls), total_entities (total entity count across all rendered grids), chunk_cache_hits / chunk_cache_misses (visible layer chunks drawn from a resident texture / rasterized because they were not resident or their cells changed), chunk_cache_evictions (chunks evicted to stay within chunk_cache_budget), chunk_cache_chunks and chunk_cache_bytes (chunks and texture bytes resident now)")
          MCRF_NOTE("All per-frame counters and timing breakdowns describe the last COMPLETED frame. "
                    "Python callbacks run before the frame is rendered, so the in-progress frame's "
                    "values are not available yet; frame_time, fps, runtime and current_frame are live.")
@@ -640,6 +696,9 @@ PyObject* PyInit_mcrfpy()
         /*#335: layer.edit() context manager - returned by ColorLayer/TileLayer.edit(), not instantiable*/
         &mcrfpydef::PyLayerEditType,
 
+        /*grid.step(batch_callbacks=...) round events - passed to the handler, not instantiable*/
+        &mcrfpydef::PyStepEventsType,
+
         /*3D navigation grid - returned by Viewport3D.at() but not directly instantiable*/
         &mcrfpydef::PyVoxelPointType,
 
@@ -1908,6 +1967,14 @@ PyObject* McRFPy_API::_getMetrics(PyObject* self, PyObject* args) {
     PyDict_SetItemString(dict, "draw_calls", PyLong_FromLong(pub.drawCalls));
     PyDict_SetItemString(dict, "ui_elements", PyLong_FromLong(pub.uiElements));
     PyDict_SetItemString(dict, "visible_elements", PyLong_FromLong(pub.visibleElements));
+    PyDict_SetItemString(dict, "culled_elements", PyLong_FromLong(pub.culledElements));
+    PyDict_SetItemString(dict, "occluded_elements", PyLong_FromLong(pub.occludedElements));
+    PyDict_SetItemString(dict, "ui_batch_draw_calls", PyLong_FromLong(pub.uiBatchDrawCalls));
+    PyDict_SetItemString(dict, "glyph_runs_built", PyLong_FromLong(pub.glyphRunBuilds));
+    PyDict_SetItemString(dict, "retained_blits", PyLong_FromLong(pub.retainedBlits));
+    PyDict_SetItemString(dict, "retained_rebuilds", PyLong_FromLong(pub.retainedRebuilds));
+    PyDict_SetItemString(dict, "frame_partial_recomposites", PyLong_FromLong(pub.framePartialRecomposites));
+    PyDict_SetItemString(dict, "frame_full_rebuilds", PyLong_FromLong(pub.frameFullRebuilds));
 
     // #144 - Add detailed timing breakdown (in milliseconds)
     PyDict_SetItemString(dict, "grid_render_time", PyFloat_FromDouble(pub.gridRenderTime));
@@ -1915,12 +1982,22 @@ PyObject* McRFPy_API::_getMetrics(PyObject* self, PyObject* args) {
     PyDict_SetItemString(dict, "fov_overlay_time", PyFloat_FromDouble(pub.fovOverlayTime));
     PyDict_SetItemString(dict, "python_time", PyFloat_FromDouble(pub.pythonScriptTime));
     PyDict_SetItemString(dict, "animation_time", PyFloat_FromDouble(pub.animationTime));
+    PyDict_SetItemString(dict, "animations_updated", PyLong_FromLong(pub.animationsUpdated));
+    PyDict_SetItemString(dict, "animations_batched", PyLong_FromLong(pub.animationsBatched));
 
     // #144 - Add grid-specific metrics
     PyDict_SetItemString(dict, "grid_cells_rendered", PyLong_FromLong(pub.gridCellsRendered));
     PyDict_SetItemString(dict, "entities_rendered", PyLong_FromLong(pub.entitiesRendered));
+    PyDict_SetItemString(dict, "entity_draw_calls", PyLong_FromLong(pub.entityDrawCalls));
     PyDict_SetItemString(dict, "total_entities", PyLong_FromLong(pub.totalEntities));
 
+    // Layer chunk texture cache: last frame's traffic, current residency
+    PyDict_SetItemString(dict, "chunk_cache_hits", PyLong_FromLong(pub.chunkCacheHits));
+    PyDict_SetItemString(dict, "chunk_cache_misses", PyLong_FromLong(pub.chunkCacheMisses));
+    PyDict_SetItemString(dict, "chunk_cache_evictions", PyLong_FromLong(pub.chunkCacheEvictions));
+    PyDict_SetItemString(dict, "chunk_cache_chunks", PyLong_FromSize_t(ChunkCache::get().residentChunks()));
+    PyDict_SetItemString(dict, "chunk_cache_bytes", PyLong_FromSize_t(ChunkCache::get().residentBytes()));
+
     // Add general metrics
     PyDict_SetItemString(dict, "current_frame", PyLong_FromLong(game->getFrame()));
     PyDict_SetItemString(dict, "runtime", PyFloat_FromDouble(game->runtime.getElapsedTime().asSeconds()));
@@ -0,0 +1,430 @@
+// PathEngine.cpp - Native Dijkstra / A* (see PathEngine.h)
+#include "PathEngine.h"
+#include "GridData.h"
+#include "UIEntity.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+
+namespace PathEngine {
+
+// =============================================================================
+// RadixHeap - monotone integer priority queue
+//
+// Keys pushed must be >= the last key popped (true for Dijkstra; A* clamps,
+// see findPath). Bucket i holds keys whose highest bit differing from the last
+// popped key is bit i-1, so a pop only rescans the first non-empty bucket and
+// each entry moves down at most 32 times over its lifetime.
+// =============================================================================
+template <typename Payload>
+class RadixHeap {
+public:
+    void clear() {
+        for (auto& b : buckets) b.clear();
+        last = 0;
+        count = 0;
+    }
+    bool empty() const { return count == 0; }
+
+    void push(uint32_t key, const Payload& payload) {
+        if (key < last) key = last;
+        buckets[bucketOf(key)].push_back({key, payload});
+        count++;
+    }
+
+    uint32_t pop(Payload& out) {
+        if (buckets[0].empty()) {
+            size_t i = 1;
+            while (buckets[i].empty()) i++;
+            uint32_t min_key = buckets[i][0].key;
+            for (const auto& e : buckets[i]) min_key = std::min(min_key, e.key);
+            last = min_key;
+            for (const auto& e : buckets[i]) buckets[bucketOf(e.key)].push_back(e);
+            buckets[i].clear();
+        }
+        Entry e = buckets[0].back();
+        buckets[0].pop_back();
+        count--;
+        out = e.payload;
+        return e.key;
+    }
+
+private:
+    struct Entry {
+        uint32_t key;
+        Payload payload;
+    };
+    size_t bucketOf(uint32_t key) const {
+        return key == last ? 0 : static_cast<size_t>(std::bit_width(key ^ last));
+    }
+
+    std::array<std::vector<Entry>, 33> buckets;
+    uint32_t last = 0;
+    size_t count = 0;
+};
+
+// Saturating add: heavy weight planes on huge maps must not wrap to a short
+// distance. UNREACHABLE itself stays reserved for "never reached".
+static inline uint32_t addCost(uint32_t a, uint32_t b) {
+    uint64_t sum = static_cast<uint64_t>(a) + b;
+    return sum >= UNREACHABLE ? UNREACHABLE - 1 : static_cast<uint32_t>(sum);
+}
+
+// =============================================================================
+// OccupancyOverlay / Terrain
+// =============================================================================
+
+OccupancyOverlay::OccupancyOverlay(int w, int h)
+    : bits((static_cast<size_t>(w) * h + 63) / 64, 0), width(w) {}
+
+OccupancyOverlay OccupancyOverlay::fromLabel(const GridData& grid, const std::string& label) {
+    OccupancyOverlay overlay(grid.grid_w, grid.grid_h);
+    if (label.empty() || !grid.entities) return overlay;
+    for (const auto& entity : *grid.entities) {
+        if (!entity || !entity->labels.count(label)) continue;
+        int x = entity->cell_position.x;
+        int y = entity->cell_position.y;
+        if (x >= 0 && x < grid.grid_w && y >= 0 && y < grid.grid_h) {
+            overlay.block(x, y);
+        }
+    }
+    return overlay;
+}
+
+void OccupancyOverlay::block(int x, int y) {
+    size_t idx = static_cast<size_t>(y) * width + x;
+    uint64_t mask = uint64_t(1) << (idx & 63);
+    if (!(bits[idx >> 6] & mask)) {
+        bits[idx >> 6] |= mask;
+        count++;
+    }
+}
+
+Terrain Terrain::fromGrid(const GridData& grid, const OccupancyOverlay* overlay,
+                          const uint8_t* weights) {
+    Terrain t;
+    t.width = grid.grid_w;
+    t.height = grid.grid_h;
+    t.walkable = grid.walkable_plane.data();
+    t.weights = weights;
+    t.overlay = (overlay && !overlay->empty()) ? overlay : nullptr;
+    return t;
+}
+
+// =============================================================================
+// Dijkstra
+// =============================================================================
+
+// Reused per thread: the bucket vectors keep their capacity between calls.
+static thread_local RadixHeap<uint32_t> distance_heap;
+
+// Dijkstra inner loop: settle everything queued in `heap`, relaxing neighbors
+// into `dist`. Returns how many distances were lowered.
+static size_t relaxFrom(RadixHeap<uint32_t>& heap, const Terrain& terrain, const StepCosts& costs,
+                        std::vector<uint32_t>& dist) {
+    const int w = terrain.width;
+    const int neighbors = costs.neighborCount();
+    size_t lowered = 0;
+    while (!heap.empty()) {
+        uint32_t idx;
+        uint32_t d = heap.pop(idx);
+        if (d != dist[idx]) continue;  // superseded by a shorter push
+
+        int x = static_cast<int>(idx % w);
+        int y = static_cast<int>(idx / w);
+        for (int k = 0; k < neighbors; k++) {
+            int nx = x + NEIGHBOR_DX[k];
+            int ny = y + NEIGHBOR_DY[k];
+            if (!terrain.inBounds(nx, ny)) continue;
+            size_t nidx = static_cast<size_t>(ny) * w + nx;
+            if (!terrain.passable(nidx)) continue;
+            uint32_t nd = addCost(d, terrain.enterCost(nidx, k < 4 ? costs.orthogonal : costs.diagonal));
+            if (nd < dist[nidx]) {
+                dist[nidx] = nd;
+                heap.push(nd, static_cast<uint32_t>(nidx));
+                lowered++;
+            }
+        }
+    }
+    return lowered;
+}
+
+void computeDistances(const Terrain& terrain, const StepCosts& costs,
+                      const std::vector<sf::Vector2i>& roots, std::vector<uint32_t>& dist) {
+    const int w = terrain.width;
+    const size_t cells = static_cast<size_t>(w) * terrain.height;
+    dist.assign(cells, UNREACHABLE);
+    if (cells == 0) return;
+
+    auto& heap = distance_heap;
+    heap.clear();
+
+    for (const auto& r : roots) {
+        if (!terrain.inBounds(r.x, r.y)) continue;
+        size_t idx = static_cast<size_t>(r.y) * w + r.x;
+        if (dist[idx] != 0) {
+            dist[idx] = 0;
+            heap.push(0, static_cast<uint32_t>(idx));
+        }
+    }
+    relaxFrom(heap, terrain, costs, dist);
+}
+
+size_t repairDistances(const Terrain& terrain, const StepCosts& costs,
+                       const uint32_t* changed, size_t count, std::vector<uint32_t>& dist) {
+    const int w = terrain.width;
+    const size_t cells = static_cast<size_t>(w) * terrain.height;
+    if (cells == 0 || dist.size() != cells) return 0;
+    const int neighbors = costs.neighborCount();
+    auto stepInto = [&](size_t idx, int k) {
+        return terrain.enterCost(idx, k < 4 ? costs.orthogonal : costs.diagonal);
+    };
+
+    auto& heap = distance_heap;
+    heap.clear();
+    thread_local std::vector<uint32_t> invalidated;
+    invalidated.clear();
+
+    // Raise wave. Roots are the only cells at distance 0 (every step costs at
+    // least 1), and they keep it even when blocked, as in computeDistances().
+    for (size_t i = 0; i < count; i++) {
+        uint32_t idx = changed[i];
+        if (idx >= cells || terrain.passable(idx)) continue;
+        if (dist[idx] != UNREACHABLE && dist[idx] != 0) heap.push(dist[idx], idx);
+    }
+    while (!heap.empty()) {
+        uint32_t idx;
+        uint32_t old = heap.pop(idx);
+        if (dist[idx] != old) continue;  // already invalidated
+
+        int x = static_cast<int>(idx % w);
+        int y = static_cast<int>(idx / w);
+        // Predecessors have strictly smaller old distances, so any that were
+        // going to be invalidated already have been: a surviving one at exactly
+        // old - step still proves this distance.
+        if (terrain.passable(idx)) {
+            bool supported = false;
+            for (int k = 0; k < neighbors && !supported; k++) {
+                int px = x - NEIGHBOR_DX[k];
+                int py = y - NEIGHBOR_DY[k];
+                if (!terrain.inBounds(px, py)) continue;
+                uint32_t pd = dist[static_cast<size_t>(py) * w + px];
+                supported = pd != UNREACHABLE && addCost(pd, stepInto(idx, k)) == old;
+            }
+            if (supported) continue;
+        }
+
+        dist[idx] = UNREACHABLE;
+        invalidated.push_back(idx);
+        for (int k = 0; k < neighbors; k++) {
+            int nx = x + NEIGHBOR_DX[k];
+            int ny = y + NEIGHBOR_DY[k];
+            if (!terrain.inBounds(nx, ny)) continue;
+            size_t nidx = static_cast<size_t>(ny) * w + nx;
+            uint32_t nd = dist[nidx];
+            if (nd != UNREACHABLE && nd != 0 && nd == addCost(old, stepInto(nidx, k))) {
+                heap.push(nd, static_cast<uint32_t>(nidx));
+            }
+        }
+    }
+
+    // Lower wave: seed invalidated and newly opened cells from their best
+    // surviving neighbor, then relax outward. Seeds sit below the raise wave's
+    // last key, so the heap restarts; all of them are pushed before the first
+    // pop, which keeps the radix heap's monotone-key rule.
+    heap.clear();
+    size_t rewritten = invalidated.size();
+    auto seed = [&](uint32_t idx) {
+        if (dist[idx] == 0 || !terrain.passable(idx)) return;
+        int x = static_cast<int>(idx % w);
+        int y = static_cast<int>(idx / w);
+        uint32_t best = dist[idx];
+        for (int k = 0; k < neighbors; k++) {
+            int px = x - NEIGHBOR_DX[k];
+            int py = y - NEIGHBOR_DY[k];
+            if (!terrain.inBounds(px, py)) continue;
+            uint32_t pd = dist[static_cast<size_t>(py) * w + px];
+            if (pd != UNREACHABLE) best = std::min(best, addCost(pd, stepInto(idx, k)));
+        }
+        if (best < dist[idx]) {
+            dist[idx] = best;
+            heap.push(best, idx);
+        }
+    };
+    for (uint32_t idx : invalidated) seed(idx);
+    for (size_t i = 0; i < count; i++) {
+        if (changed[i] < cells) seed(changed[i]);
+    }
+    rewritten += relaxFrom(heap, terrain, costs, dist);
+    return rewritten;
+}
+
+bool descend(const std::vector<uint32_t>& dist, int width, int height, int neighbor_count,
+             int x, int y, sf::Vector2i* out) {
+    if (x < 0 || y < 0 || x >= width || y >= height) return false;
+    uint32_t best = dist[static_cast<size_t>(y) * width + x];
+    if (best == UNREACHABLE) return false;
+
+    bool found = false;
+    for (int k = 0; k < neighbor_count; k++) {
+        int nx = x + NEIGHBOR_DX[k];
+        int ny = y + NEIGHBOR_DY[k];
+        if (nx < 0 || ny < 0 || nx >= width || ny >= height) continue;
+        uint32_t nd = dist[static_cast<size_t>(ny) * width + nx];
+        if (nd < best) {  // strict: cardinals win ties, and UNREACHABLE never wins
+            best = nd;
+            *out = sf::Vector2i(nx, ny);
+            found = true;
+        }
+    }
+    return found;
+}
+
+bool ascend(const std::vector<uint32_t>& dist, int width, int height, int neighbor_count,
+            int x, int y, sf::Vector2i* out) {
+    if (x < 0 || y < 0 || x >= width || y >= height) return false;
+    uint32_t best = dist[static_cast<size_t>(y) * width + x];
+    if (best == UNREACHABLE) return false;
+
+    bool found = false;
+    for (int k = 0; k < neighbor_count; k++) {
+        int nx = x + NEIGHBOR_DX[k];
+        int ny = y + NEIGHBOR_DY[k];
+        if (nx < 0 || ny < 0 || nx >= width || ny >= height) continue;
+        uint32_t nd = dist[static_cast<size_t>(ny) * width + nx];
+        if (nd != UNREACHABLE && nd > best) {
+            best = nd;
+            *out = sf::Vector2i(nx, ny);
+            found = true;
+        }
+    }
+    return found;
+}
+
+// =============================================================================
+// A*
+// =============================================================================
+
+namespace {
+
+struct OpenNode {
+    uint32_t idx;
+    uint32_t g;
+};
+
+// Per-thread search state sized to the largest grid seen. `stamp` marks which
+// g/from entries belong to the current search, so a short path on a huge map
+// costs O(cells visited), not O(cells).
+struct AStarScratch {
+    std::vector<uint32_t> g;
+    std::vector<uint32_t> stamp;
+    std::vector<uint8_t> from;  // neighbor index k used to enter the cell
+    uint32_t epoch = 0;
+    RadixHeap<OpenNode> open;
+
+    void begin(size_t cells) {
+        if (g.size() < cells) {
+            g.resize(cells);
+            from.resize(cells);
+            stamp.assign(cells, 0);
+            epoch = 0;
+        }
+        if (++epoch == 0) {
+            std::fill(stamp.begin(), stamp.end(), 0);
+            epoch = 1;
+        }
+        open.clear();
+    }
+    uint32_t gAt(size_t idx) const { return stamp[idx] == epoch ? g[idx] : UNREACHABLE; }
+    void set(size_t idx, uint32_t cost, uint8_t k) {
+        stamp[idx] = epoch;
+        g[idx] = cost;
+        from[idx] = k;
+    }
+};
+
+thread_local AStarScratch astar;
+
+uint32_t estimate(Heuristic h, const StepCosts& costs, float weight, int x, int y, sf::Vector2i goal) {
+    int dx = std::abs(goal.x - x);
+    int dy = std::abs(goal.y - y);
+    double est;
+    switch (h) {
+        case Heuristic::MANHATTAN: est = double(costs.orthogonal) * (dx + dy); break;
+        case Heuristic::CHEBYSHEV: est = double(costs.orthogonal) * std::max(dx, dy); break;
+        case Heuristic::DIAGONAL: {
+            int lo = std::min(dx, dy), hi = std::max(dx, dy);
+            est = costs.diagonal
+                ? double(costs.orthogonal) * (hi - lo) + double(costs.diagonal) * lo
+                : double(costs.orthogonal) * (dx + dy);
+            break;
+        }
+        case Heuristic::ZERO: return 0;
+        case Heuristic::EUCLIDEAN:
+        default: est = double(costs.orthogonal) * std::sqrt(double(dx) * dx + double(dy) * dy); break;
+    }
+    est *= weight;
+    return est >= double(UNREACHABLE - 1) ? UNREACHABLE - 1 : static_cast<uint32_t>(est);
+}
+
+} // namespace
+
+bool findPath(const Terrain& terrain, const StepCosts& costs,
+              sf::Vector2i start, sf::Vector2i goal,
+              Heuristic heuristic, float weight, std::vector<sf::Vector2i>& path) {
+    path.clear();
+    if (!terrain.inBounds(start.x, start.y) || !terrain.inBounds(goal.x, goal.y)) return false;
+    if (start == goal) return true;
+
+    const int w = terrain.width;
+    const size_t goal_idx = static_cast<size_t>(goal.y) * w + goal.x;
+    const size_t start_idx = static_cast<size_t>(start.y) * w + start.x;
+    if (!terrain.passable(goal_idx)) return false;
+
+    astar.begin(static_cast<size_t>(w) * terrain.height);
+    astar.set(start_idx, 0, 0);
+    // An inconsistent heuristic (or weight > 1) can produce an f below the last
+    // popped key; RadixHeap clamps it, which only affects expansion order.
+    astar.open.push(estimate(heuristic, costs, weight, start.x, start.y, goal),
+                    {static_cast<uint32_t>(start_idx), 0});
+
+    const int neighbors = costs.neighborCount();
+    while (!astar.open.empty()) {
+        OpenNode node;
+        astar.open.pop(node);
+        if (node.g != astar.gAt(node.idx)) continue;  // stale entry
+
+        if (node.idx == goal_idx) {
+            size_t cur = goal_idx;
+            while (cur != start_idx) {
+                int cx = static_cast<int>(cur % w);
+                int cy = static_cast<int>(cur / w);
+                path.emplace_back(cx, cy);
+                int k = astar.from[cur];
+                cur = static_cast<size_t>(cy - NEIGHBOR_DY[k]) * w + (cx - NEIGHBOR_DX[k]);
+            }
+            std::reverse(path.begin(), path.end());
+            return true;
+        }
+
+        int x = static_cast<int>(node.idx % w);
+        int y = static_cast<int>(node.idx / w);
+        for (int k = 0; k < neighbors; k++) {
+            int nx = x + NEIGHBOR_DX[k];
+            int ny = y + NEIGHBOR_DY[k];
+            if (!terrain.inBounds(nx, ny)) continue;
+            size_t nidx = static_cast<size_t>(ny) * w + nx;
+            if (!terrain.passable(nidx)) continue;
+            uint32_t ng = addCost(node.g, terrain.enterCost(nidx, k < 4 ? costs.orthogonal : costs.diagonal));
+            if (ng < astar.gAt(nidx)) {
+                astar.set(nidx, ng, static_cast<uint8_t>(k));
+                astar.open.push(addCost(ng, estimate(heuristic, costs, weight, nx, ny, goal)),
+                                {static_cast<uint32_t>(nidx), ng});
+            }
+        }
+    }
+    return false;
+}
+
+} // namespace PathEngine
@@ -0,0 +1,133 @@
+#pragma once
+// PathEngine.h - Native Dijkstra / A* over GridData's dense cell planes.
+//
+// Replaces the libtcod round-trip for pathfinding: searches read
+// GridData::walkable_plane directly instead of a TCODMap copy, so a
+// walkability edit is visible to the next query without syncTCODMap(), and
+// collision labels become a read-only occupancy overlay instead of a
+// mutate-then-restore pass over the shared map.
+//
+// Costs are fixed-point integers (COST_SCALE per orthogonal step, the same
+// scale libtcod's Dijkstra uses), which lets both searches run on a radix
+// heap instead of a comparison heap. Nothing here touches Python or mutates
+// the grid, so any function may run on a worker thread.
+
+#include "Common.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class GridData;
+
+namespace PathEngine {
+
+// Distance value for cells no root can reach.
+constexpr uint32_t UNREACHABLE = 0xFFFFFFFFu;
+// Fixed-point cost of one orthogonal step; distances are reported / COST_SCALE.
+constexpr uint32_t COST_SCALE = 100;
+
+// Neighbor order used by every search and descent: cardinals first, so that
+// cardinal moves win ties against diagonals.
+constexpr int NEIGHBOR_DX[8] = { 0, 0, -1, 1, -1, 1, -1, 1 };
+constexpr int NEIGHBOR_DY[8] = { -1, 1, 0, 0, -1, -1, 1, 1 };
+
+struct StepCosts {
+    uint32_t orthogonal = COST_SCALE;
+    uint32_t diagonal = 141;  // 0 = 4-connected (no diagonal moves)
+
+    // Same rounding as libtcod (so 0.99 maps to 99, not 98).
+    static StepCosts fromDiagonal(float diagonal_cost) {
+        StepCosts c;
+        c.diagonal = diagonal_cost > 0.0f
+            ? static_cast<uint32_t>(diagonal_cost * COST_SCALE + 0.1f) : 0;
+        return c;
+    }
+    int neighborCount() const { return diagonal ? 8 : 4; }
+};
+
+// Cells temporarily treated as blocked for one query (entities carrying a
+// collide label). A bitset over the grid: O(cells / 64) to build, O(1) to test.
+class OccupancyOverlay {
+public:
+    OccupancyOverlay() = default;
+    OccupancyOverlay(int width, int height);
+
+    // Overlay of every cell occupied by an entity with `label` (empty label
+    // yields an empty overlay).
+    static OccupancyOverlay fromLabel(const GridData& grid, const std::string& label);
+
+    void block(int x, int y);
+    bool blocked(size_t idx) const { return (bits[idx >> 6] >> (idx & 63)) & 1u; }
+    bool empty() const { return count == 0; }
+
+private:
+    std::vector<uint64_t> bits;
+    int width = 0;
+    size_t count = 0;
+};
+
+// Read-only view of what a search may enter. Only non-owning pointers, so a
+// Terrain is cheap to build per query.
+struct Terrain {
+    int width = 0;
+    int height = 0;
+    const uint8_t* walkable = nullptr;          // non-zero = passable
+    const uint8_t* weights = nullptr;           // optional entry-cost multiplier; 0 = impassable
+    const OccupancyOverlay* overlay = nullptr;  // optional, ignored when empty
+
+    static Terrain fromGrid(const GridData& grid, const OccupancyOverlay* overlay = nullptr,
+                            const uint8_t* weights = nullptr);
+
+    bool inBounds(int x, int y) const { return x >= 0 && y >= 0 && x < width && y < height; }
+    bool passable(size_t idx) const {
+        if (!walkable[idx]) return false;
+        if (weights && !weights[idx]) return false;
+        return !(overlay && overlay->blocked(idx));
+    }
+    // Cost of stepping INTO idx with the given base step cost.
+    uint32_t enterCost(size_t idx, uint32_t base) const {
+        return weights ? base * weights[idx] : base;
+    }
+};
+
+// Multi-source Dijkstra. Fills `dist` (resized to width*height) with fixed-
+// point distances; unreached cells are UNREACHABLE. Roots always get 0 even if
+// blocked, matching libtcod. Out-of-bounds roots are ignored.
+void computeDistances(const Terrain& terrain, const StepCosts& costs,
+                      const std::vector<sf::Vector2i>& roots, std::vector<uint32_t>& dist);
+
+// Bring a field computeDistances() produced up to date after the cells in
+// `changed` flipped passability (duplicates allowed), rewriting only the
+// region whose distances actually move. A raise wave first invalidates every
+// cell whose shortest path ran through a newly blocked cell, visiting cells in
+// order of old distance so one is dropped only once no surviving neighbor
+// still supports it; a lower wave then re-seeds those cells, and any newly
+// opened ones, from their valid neighbors and relaxes outward. The result is
+// identical to a fresh computeDistances() on `terrain`, which must match the
+// original terrain everywhere but `changed`. Returns the number of distances
+// rewritten.
+size_t repairDistances(const Terrain& terrain, const StepCosts& costs,
+                       const uint32_t* changed, size_t count, std::vector<uint32_t>& dist);
+
+// Steepest-descent neighbor of (x, y) on a distance field: the reachable
+// neighbor with the lowest distance, if it is strictly lower than (x, y)'s.
+bool descend(const std::vector<uint32_t>& dist, int width, int height, int neighbor_count,
+             int x, int y, sf::Vector2i* out);
+
+// Steepest-ascent counterpart, used to walk an inverted view of a field: the
+// reachable neighbor with the highest distance, if strictly higher.
+bool ascend(const std::vector<uint32_t>& dist, int width, int height, int neighbor_count,
+            int x, int y, sf::Vector2i* out);
+
+// A* heuristics; values match mcrfpy.Heuristic.
+enum class Heuristic : int { EUCLIDEAN = 0, MANHATTAN = 1, CHEBYSHEV = 2, DIAGONAL = 3, ZERO = 4 };
+
+// A* from start to goal. On success fills `path` with the steps AFTER start,
+// ending at goal (empty when start == goal) and returns true. The goal must be
+// passable; the start need not be. Weighted / inadmissible heuristics still
+// find a path but not necessarily the shortest one.
+bool findPath(const Terrain& terrain, const StepCosts& costs,
+              sf::Vector2i start, sf::Vector2i goal,
+              Heuristic heuristic, float weight, std::vector<sf::Vector2i>& path);
+
+} // namespace PathEngine
@@ -3,18 +3,26 @@
 #include "UIGridPathfinding.h"
 #include "UIGridPoint.h"
 
-static bool cellWalkable(GridData& grid, int x, int y) {
+static bool cellWalkable(const GridData& grid, int x, int y) {
     if (x < 0 || x >= grid.grid_w || y < 0 || y >= grid.grid_h) return false;
     return grid.isWalkable(x, y);  // #332
 }
 
+sf::Vector2i PathProvider::nextStep(sf::Vector2i from, GridData& grid, bool* ok) {
+    bool valid = false;
+    sf::Vector2i step = peekStep(from, grid, &valid);
+    if (valid) advance();
+    if (ok) *ok = valid;
+    return step;
+}
+
 // -----------------------------------------------------------------------------
 // DijkstraProvider
 // -----------------------------------------------------------------------------
 DijkstraProvider::DijkstraProvider(std::shared_ptr<DijkstraMap> map)
     : map_(std::move(map)) {}
 
-sf::Vector2i DijkstraProvider::nextStep(sf::Vector2i from, GridData& /*grid*/, bool* ok) {
+sf::Vector2i DijkstraProvider::peekStep(sf::Vector2i from, const GridData& /*grid*/, bool* ok) const {
     if (!map_) {
         if (ok) *ok = false;
         return {-1, -1};
@@ -25,19 +33,27 @@ sf::Vector2i DijkstraProvider::nextStep(sf::Vector2i from, GridData& /*grid*/, b
     return step;
 }
 
+void DijkstraProvider::refresh(sf::Vector2i /*from*/, GridData& /*grid*/) {
+    if (map_) map_->refresh();
+}
+
+bool DijkstraProvider::tracksOccupancy() const {
+    return map_ && !map_->getCollideLabel().empty();
+}
+
 // -----------------------------------------------------------------------------
 // AStarProvider
 // -----------------------------------------------------------------------------
 AStarProvider::AStarProvider(std::vector<sf::Vector2i> path)
     : path_(std::move(path)) {}
 
-sf::Vector2i AStarProvider::nextStep(sf::Vector2i /*from*/, GridData& /*grid*/, bool* ok) {
+sf::Vector2i AStarProvider::peekStep(sf::Vector2i /*from*/, const GridData& /*grid*/, bool* ok) const {
     if (index_ >= path_.size()) {
         if (ok) *ok = false;
         return {-1, -1};
     }
     if (ok) *ok = true;
-    return path_[index_++];
+    return path_[index_];
 }
 
 // -----------------------------------------------------------------------------
@@ -46,7 +62,7 @@ sf::Vector2i AStarProvider::nextStep(sf::Vector2i /*from*/, GridData& /*grid*/,
 TargetProvider::TargetProvider(sf::Vector2i target)
     : target_(target) {}
 
-sf::Vector2i TargetProvider::nextStep(sf::Vector2i from, GridData& grid, bool* ok) {
+sf::Vector2i TargetProvider::peekStep(sf::Vector2i from, const GridData& grid, bool* ok) const {
     int dx = target_.x - from.x;
     int dy = target_.y - from.y;
     if (dx == 0 && dy == 0) {
@@ -63,3 +79,34 @@ sf::Vector2i TargetProvider::nextStep(sf::Vector2i from, GridData& grid, bool* o
     if (ok) *ok = true;
     return step;
 }
+
+// -----------------------------------------------------------------------------
+// HPAProvider
+// -----------------------------------------------------------------------------
+HPAProvider::HPAProvider(sf::Vector2i target)
+    : target_(target) {}
+
+sf::Vector2i HPAProvider::peekStep(sf::Vector2i /*from*/, const GridData& grid, bool* ok) const {
+    if (index_ >= path_.size() || !cellWalkable(grid, path_[index_].x, path_[index_].y)) {
+        if (ok) *ok = false;
+        return {-1, -1};
+    }
+    if (ok) *ok = true;
+    return path_[index_];
+}
+
+void HPAProvider::refresh(sf::Vector2i from, GridData& grid) {
+    sf::Vector2i expected = index_ == 0 ? origin_ : path_[index_ - 1];
+    if (planned_ && from == expected && walkability_generation_ == grid.walkability_generation) {
+        return;
+    }
+    planned_ = true;
+    origin_ = from;
+    index_ = 0;
+    walkability_generation_ = grid.walkability_generation;
+
+    PathEngine::StepCosts costs;  // default diagonal cost (1.41)
+    grid.hpa_graph.sync(grid, costs);
+    auto terrain = PathEngine::Terrain::fromGrid(grid);
+    if (!grid.hpa_graph.findPath(terrain, from, target_, path_)) path_.clear();
+}
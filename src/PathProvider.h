@@ -1,5 +1,6 @@
 #pragma once
 #include "Common.h"
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -10,22 +11,39 @@ class DijkstraMap;
 // PathProvider (#315) - strategy interface for "what's my next cell?"
 //
 // EntityBehavior's SEEK/FLEE execute step() by asking the active PathProvider
-// for a single cell. Three concrete providers satisfy every pathfinding shape
+// for a single cell. Four concrete providers satisfy every pathfinding shape
 // the engine exposes today.
 // =============================================================================
 class PathProvider {
 public:
     virtual ~PathProvider() = default;
 
-    // Return the next cell to step to. Sets *ok=true on a valid step, false
-    // otherwise. The provider is responsible for walkability checks -
-    // DijkstraProvider relies on the TCOD map used at compute time,
+    // Return the next cell to step to WITHOUT consuming it. Sets *ok=true on a
+    // valid step, false otherwise. The provider is responsible for walkability
+    // checks - DijkstraProvider relies on its map (kept current by refresh()),
     // TargetProvider re-queries the live grid, AStarProvider trusts the
-    // pre-computed path.
-    virtual sf::Vector2i nextStep(sf::Vector2i from, GridData& grid, bool* ok) = 0;
+    // pre-computed path. Must not mutate anything: grid.step(parallel=True)
+    // calls it from worker threads.
+    virtual sf::Vector2i peekStep(sf::Vector2i from, const GridData& grid, bool* ok) const = 0;
 
-    // Hint for providers that hold iteration state (currently only A*).
+    // Consume the step the last successful peekStep() returned. Only providers
+    // that hold iteration state (currently only A*) need to override this.
+    virtual void advance() {}
+
+    // peekStep() + advance() on success: the serial "take one step" call.
+    sf::Vector2i nextStep(sf::Vector2i from, GridData& grid, bool* ok);
+
+    // Hint for providers that hold iteration state (A* and HPA*).
     virtual void reset() {}
+
+    // Bring precomputed data up to date with the grid before peekStep();
+    // `from` is the entity's current cell. Main thread only; the step loop
+    // calls it ahead of planning.
+    virtual void refresh(sf::Vector2i /*from*/, GridData& /*grid*/) {}
+
+    // True if refresh() follows entity occupancy, so a step planned before
+    // another entity moved may no longer be the one refresh() would give.
+    virtual bool tracksOccupancy() const { return false; }
 };
 
 // Descend a precomputed DijkstraMap. For SEEK, pass the map as-is; for FLEE,
@@ -33,7 +51,11 @@ public:
 class DijkstraProvider : public PathProvider {
 public:
     explicit DijkstraProvider(std::shared_ptr<DijkstraMap> map);
-    sf::Vector2i nextStep(sf::Vector2i from, GridData& grid, bool* ok) override;
+    sf::Vector2i peekStep(sf::Vector2i from, const GridData& grid, bool* ok) const override;
+    // Repairs the shared map after walkability edits; a no-op when current.
+    void refresh(sf::Vector2i from, GridData& grid) override;
+    // Collide maps are repaired as labelled entities move.
+    bool tracksOccupancy() const override;
 
 private:
     std::shared_ptr<DijkstraMap> map_;
@@ -43,7 +65,8 @@ private:
 class AStarProvider : public PathProvider {
 public:
     explicit AStarProvider(std::vector<sf::Vector2i> path);
-    sf::Vector2i nextStep(sf::Vector2i from, GridData& grid, bool* ok) override;
+    sf::Vector2i peekStep(sf::Vector2i from, const GridData& grid, bool* ok) const override;
+    void advance() override { if (index_ < path_.size()) index_++; }
     void reset() override { index_ = 0; }
 
 private:
@@ -57,8 +80,30 @@ private:
 class TargetProvider : public PathProvider {
 public:
     explicit TargetProvider(sf::Vector2i target);
-    sf::Vector2i nextStep(sf::Vector2i from, GridData& grid, bool* ok) override;
+    sf::Vector2i peekStep(sf::Vector2i from, const GridData& grid, bool* ok) const override;
+
+private:
+    sf::Vector2i target_;
+};
+
+// Follow a hierarchical (HPA*) route to a fixed target cell through
+// GridData::hpa_graph. The route is planned in refresh() and re-planned when
+// walkability changes or the entity is not where the route left it (a move
+// was blocked or the entity was teleported). An unreachable target yields
+// no step until one of those changes.
+class HPAProvider : public PathProvider {
+public:
+    explicit HPAProvider(sf::Vector2i target);
+    sf::Vector2i peekStep(sf::Vector2i from, const GridData& grid, bool* ok) const override;
+    void advance() override { if (index_ < path_.size()) index_++; }
+    void reset() override { planned_ = false; }
+    void refresh(sf::Vector2i from, GridData& grid) override;
 
 private:
     sf::Vector2i target_;
+    std::vector<sf::Vector2i> path_;
+    size_t index_ = 0;
+    sf::Vector2i origin_;                  // cell the route was planned from
+    uint32_t walkability_generation_ = 0;  // grid generation it was planned at
+    bool planned_ = false;
 };
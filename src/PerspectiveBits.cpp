@@ -0,0 +1,121 @@
+#include "PerspectiveBits.h"
+#include "FOVEngine.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+// Bits [a, b) of a word, 0 <= a < b <= 64.
+inline uint64_t spanMask(int a, int b) {
+    uint64_t hi = b >= 64 ? ~uint64_t(0) : (uint64_t(1) << b) - 1;
+    return hi & ~((uint64_t(1) << a) - 1);
+}
+
+} // namespace
+
+PerspectiveBits::PerspectiveBits(int w, int h)
+    : w_(w), h_(h), stride_((w + 63) / 64)
+{
+    if (w_ <= 0 || h_ <= 0) {
+        throw std::invalid_argument("PerspectiveBits dimensions must be positive");
+    }
+    size_t words = static_cast<size_t>(stride_) * h_;
+    discovered_.assign(words, 0);
+    visible_.assign(words, 0);
+}
+
+void PerspectiveBits::set(int x, int y, uint8_t value)
+{
+    size_t i = static_cast<size_t>(y) * stride_ + (x >> 6);
+    uint64_t bit = uint64_t(1) << (x & 63);
+    discovered_[i] = value ? (discovered_[i] | bit) : (discovered_[i] & ~bit);
+    visible_[i] = value >= 2 ? (visible_[i] | bit) : (visible_[i] & ~bit);
+}
+
+void PerspectiveBits::demoteVisible()
+{
+    // Visible cells are already discovered; dropping the visible plane is
+    // the whole demote.
+    std::fill(visible_.begin(), visible_.end(), 0);
+}
+
+void PerspectiveBits::demoteVisibleRect(int x0, int y0, int x1, int y1)
+{
+    // Caller guarantees clamped, half-open bounds (as DiscreteMap).
+    if (x1 <= x0 || y1 <= y0) return;
+    int wa = x0 >> 6;
+    int wb = (x1 - 1) >> 6;
+    for (int y = y0; y < y1; ++y) {
+        uint64_t* row = visible_.data() + static_cast<size_t>(y) * stride_;
+        for (int wi = wa; wi <= wb; ++wi) {
+            int a = wi == wa ? (x0 & 63) : 0;
+            int b = wi == wb ? x1 - (wi << 6) : 64;
+            row[wi] &= ~spanMask(a, b);
+        }
+    }
+}
+
+void PerspectiveBits::promote(const FOVEngine::VisibilityMask& fov)
+{
+    if (!fov.covers()) return;
+    const int fw = fov.width();
+    for (int ly = 0; ly < fov.height(); ++ly) {
+        size_t row_base = static_cast<size_t>(fov.y0() + ly) * stride_;
+        uint64_t* disc = discovered_.data() + row_base;
+        uint64_t* vis = visible_.data() + row_base;
+        size_t src = static_cast<size_t>(ly) * fw;
+        for (int k = 0; k < fw; k += 64) {
+            uint64_t bits = fov.bitsFrom(src + k);
+            int n = fw - k;
+            if (n < 64) bits &= (uint64_t(1) << n) - 1;
+            if (!bits) continue;
+            int dx = fov.x0() + k;
+            int wi = dx >> 6;
+            int sh = dx & 63;
+            uint64_t lo = bits << sh;
+            disc[wi] |= lo;
+            vis[wi] |= lo;
+            if (sh) {
+                uint64_t hi = bits >> (64 - sh);
+                if (hi) {
+                    disc[wi + 1] |= hi;
+                    vis[wi + 1] |= hi;
+                }
+            }
+        }
+    }
+}
+
+void PerspectiveBits::toBytes(uint8_t* out) const
+{
+    for (int y = 0; y < h_; ++y) {
+        const uint64_t* disc = discovered_.data() + static_cast<size_t>(y) * stride_;
+        const uint64_t* vis = visible_.data() + static_cast<size_t>(y) * stride_;
+        uint8_t* dst = out + static_cast<size_t>(y) * w_;
+        for (int x = 0; x < w_; ++x) {
+            uint64_t bit = uint64_t(1) << (x & 63);
+            dst[x] = static_cast<uint8_t>(((disc[x >> 6] & bit) ? 1 : 0) + ((vis[x >> 6] & bit) ? 1 : 0));
+        }
+    }
+}
+
+bool PerspectiveBits::fromBytes(const uint8_t* in)
+{
+    size_t total = size();
+    for (size_t i = 0; i < total; ++i) {
+        if (in[i] > 2) return false;
+    }
+    std::fill(discovered_.begin(), discovered_.end(), 0);
+    std::fill(visible_.begin(), visible_.end(), 0);
+    for (int y = 0; y < h_; ++y) {
+        uint64_t* disc = discovered_.data() + static_cast<size_t>(y) * stride_;
+        uint64_t* vis = visible_.data() + static_cast<size_t>(y) * stride_;
+        const uint8_t* src = in + static_cast<size_t>(y) * w_;
+        for (int x = 0; x < w_; ++x) {
+            uint64_t bit = uint64_t(1) << (x & 63);
+            if (src[x]) disc[x >> 6] |= bit;
+            if (src[x] == 2) vis[x >> 6] |= bit;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace FOVEngine { class VisibilityMask; }
+
+// PerspectiveBits - compact per-entity perspective memory.
+//
+// Same 3-state model as the DiscreteMap perspective (#294): 0 = unknown,
+// 1 = discovered, 2 = visible (see PyPerspective), stored as two bitplanes
+// instead of a byte per cell. Invariant: visible implies discovered, so a
+// cell is 2 when its visible bit is set, 1 when only its discovered bit is.
+//
+// Each row starts on a word boundary, so the per-tick demote is a word-wide
+// AND-NOT over the window's rows and promote ORs the FOV bitset into both
+// planes a word at a time. Opted into per entity via
+// Entity.compact_perspective; about a quarter of the DiscreteMap's memory.
+class PerspectiveBits {
+public:
+    PerspectiveBits(int w, int h);
+
+    int width() const { return w_; }
+    int height() const { return h_; }
+    size_t size() const { return static_cast<size_t>(w_) * static_cast<size_t>(h_); }
+    size_t bytes() const { return (discovered_.capacity() + visible_.capacity()) * sizeof(uint64_t); }
+
+    // (x, y) must be in bounds.
+    uint8_t get(int x, int y) const {
+        size_t i = static_cast<size_t>(y) * stride_ + (x >> 6);
+        uint64_t bit = uint64_t(1) << (x & 63);
+        if (visible_[i] & bit) return 2;
+        return (discovered_[i] & bit) ? 1 : 0;
+    }
+    // Values above 2 are treated as 2.
+    void set(int x, int y, uint8_t value);
+
+    // Every visible cell becomes discovered (DiscreteMap::demoteVisible).
+    void demoteVisible();
+    // Same, restricted to the clamped half-open rect [x0,x1) x [y0,y1).
+    void demoteVisibleRect(int x0, int y0, int x1, int y1);
+    // Mark every cell set in `fov` visible (and so discovered). The mask's
+    // window must lie inside the map.
+    void promote(const FOVEngine::VisibilityMask& fov);
+
+    // Byte-per-cell conversion, row-major, size() bytes; the DiscreteMap
+    // layout, so to_bytes/from_bytes round-trip through either form.
+    void toBytes(uint8_t* out) const;
+    // Returns false (leaving the map unchanged) if any value is above 2.
+    bool fromBytes(const uint8_t* in);
+
+private:
+    int w_;
+    int h_;
+    int stride_;  // words per row
+    std::vector<uint64_t> discovered_;
+    std::vector<uint64_t> visible_;
+};
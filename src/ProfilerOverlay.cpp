@@ -104,7 +104,8 @@ void GameEngine::ProfilerOverlay::update(const ProfilingMetrics& metrics) {
 
     // Other metrics
     ss << "Draw Calls: " << metrics.drawCalls << "\n";
-    ss << "UI Elements: " << metrics.uiElements << " (" << metrics.visibleElements << " visible)\n";
+    ss << "UI Elements: " << metrics.uiElements << " (" << metrics.visibleElements << " visible, "
+       << metrics.culledElements + metrics.occludedElements << " culled)\n";
 
     // Calculate unaccounted time
     float accountedTime = metrics.gridRenderTime + metrics.entityRenderTime +
@@ -37,6 +37,56 @@ PyObject* PyCallable::call(PyObject* args, PyObject* kwargs)
     return PyObject_Call(target, args, kwargs);
 }
 
+PyObject* PyCallable::vectorcall(PyObject* callable, std::initializer_list<PyObject*> args)
+{
+    PyObject* stack[MAX_VECTORCALL_ARGS + 1];
+    size_t nargs = 0;
+    for (PyObject* arg : args) {
+        if (nargs == MAX_VECTORCALL_ARGS) break;
+        stack[1 + nargs++] = arg;
+    }
+    return PyObject_Vectorcall(callable, stack + 1,
+                               nargs | PY_VECTORCALL_ARGUMENTS_OFFSET, nullptr);
+}
+
+PyObject* PyCallable::positionArg(sf::Vector2f pos)
+{
+    // Vector has no weakrefs and no GC tracking: a refcount of 1 means only
+    // this slot still sees the object, so rewriting it is unobservable.
+    static PyObject* spare = nullptr;
+    if (!spare || Py_REFCNT(spare) != 1) {
+        PyTypeObject* type = &mcrfpydef::PyVectorType;
+        PyObject* fresh = type->tp_alloc(type, 0);
+        if (!fresh) return nullptr;
+        Py_XDECREF(spare);
+        spare = fresh;
+    }
+    ((PyVectorObject*)spare)->data = pos;
+    return Py_NewRef(spare);
+}
+
+// Report a callback's result and release it
+static void finishCallback(PyObject* retval, const char* failure, const char* non_none)
+{
+    if (!retval)
+    {
+        std::cerr << failure << std::endl;
+        PyErr_Print();
+        PyErr_Clear();
+
+        // Check if we should exit on exception
+        if (McRFPy_API::game && McRFPy_API::game->getConfig().exit_on_exception) {
+            McRFPy_API::signalPythonException();
+        }
+        return;
+    }
+    if (retval != Py_None)
+    {
+        std::cout << non_none << std::endl;
+    }
+    Py_DECREF(retval);
+}
+
 bool PyCallable::isNone() const
 {
     return (target == Py_None || target == NULL);
@@ -53,8 +103,7 @@ PyClickCallable::PyClickCallable()
 
 void PyClickCallable::call(sf::Vector2f mousepos, std::string button, std::string action)
 {
-    // Create a Vector object for the position
-    PyObject* pos = PyObject_CallFunction((PyObject*)&mcrfpydef::PyVectorType, "ff", mousepos.x, mousepos.y);
+    PyObject* pos = positionArg(mousepos);
     if (!pos) {
         std::cerr << "Failed to create Vector object for click callback" << std::endl;
         PyErr_Print();
@@ -72,10 +121,7 @@ void PyClickCallable::call(sf::Vector2f mousepos, std::string button, std::strin
     else if (button == "wheel_up") button_val = 10;   // SCROLL_UP
     else if (button == "wheel_down") button_val = 11; // SCROLL_DOWN
 
-    PyObject* button_enum = nullptr;
-    if (PyMouseButton::mouse_button_enum_class) {
-        button_enum = PyObject_CallFunction(PyMouseButton::mouse_button_enum_class, "i", button_val);
-    }
+    PyObject* button_enum = PyMouseButton::get_enum_member(button_val);
     if (!button_enum) {
         // Fallback to string if enum creation fails
         PyErr_Clear();
@@ -85,41 +131,19 @@ void PyClickCallable::call(sf::Vector2f mousepos, std::string button, std::strin
     // Convert action string to InputState enum (#222)
     int action_val = (action == "start") ? 0 : 1;  // PRESSED=0, RELEASED=1
 
-    PyObject* action_enum = nullptr;
-    if (PyInputState::input_state_enum_class) {
-        action_enum = PyObject_CallFunction(PyInputState::input_state_enum_class, "i", action_val);
-    }
+    PyObject* action_enum = PyInputState::get_enum_member(action_val);
     if (!action_enum) {
         // Fallback to string if enum creation fails
         PyErr_Clear();
         action_enum = PyUnicode_FromString(action.c_str());
     }
 
-    PyObject* args = Py_BuildValue("(OOO)", pos, button_enum, action_enum);
+    PyObject* retval = PyCallable::call({pos, button_enum, action_enum});
     Py_DECREF(pos);
-    Py_DECREF(button_enum);
-    Py_DECREF(action_enum);
-
-    PyObject* retval = PyCallable::call(args, NULL);
-    Py_DECREF(args);
-    if (!retval)
-    {
-        std::cerr << "Click callback raised an exception:" << std::endl;
-        PyErr_Print();
-        PyErr_Clear();
-
-        // Check if we should exit on exception
-        if (McRFPy_API::game && McRFPy_API::game->getConfig().exit_on_exception) {
-            McRFPy_API::signalPythonException();
-        }
-    } else if (retval != Py_None)
-    {
-        std::cout << "ClickCallable returned a non-None value. It's not an error, it's just not being saved or used." << std::endl;
-        std::cout << PyUnicode_AsUTF8(PyObject_Repr(retval)) << std::endl;
-        Py_DECREF(retval);
-    } else {
-        Py_DECREF(retval);
-    }
+    Py_XDECREF(button_enum);
+    Py_XDECREF(action_enum);
+    finishCallback(retval, "Click callback raised an exception:",
+                   "ClickCallable returned a non-None value. It's not an error, it's just not being saved or used.");
 }
 
 PyObject* PyClickCallable::borrow()
@@ -160,25 +184,11 @@ void PyKeyCallable::call(std::string key, std::string action)
         return;
     }
 
-    PyObject* args = Py_BuildValue("(OO)", key_enum, action_enum);
+    PyObject* retval = PyCallable::call({key_enum, action_enum});
     Py_DECREF(key_enum);
     Py_DECREF(action_enum);
-
-    PyObject* retval = PyCallable::call(args, NULL);
-    if (!retval)
-    {
-        std::cerr << "Key callback raised an exception:" << std::endl;
-        PyErr_Print();
-        PyErr_Clear();
-
-        // Check if we should exit on exception
-        if (McRFPy_API::game && McRFPy_API::game->getConfig().exit_on_exception) {
-            McRFPy_API::signalPythonException();
-        }
-    } else if (retval != Py_None)
-    {
-        std::cout << "KeyCallable returned a non-None value. It's not an error, it's just not being saved or used." << std::endl;
-    }
+    finishCallback(retval, "Key callback raised an exception:",
+                   "KeyCallable returned a non-None value. It's not an error, it's just not being saved or used.");
 }
 
 // #230 - PyHoverCallable implementation (position-only for on_enter/on_exit/on_move)
@@ -194,8 +204,7 @@ void PyHoverCallable::call(sf::Vector2f mousepos)
 {
     if (target == Py_None || target == NULL) return;
 
-    // Create a Vector object for the position
-    PyObject* pos = PyObject_CallFunction((PyObject*)&mcrfpydef::PyVectorType, "ff", mousepos.x, mousepos.y);
+    PyObject* pos = positionArg(mousepos);
     if (!pos) {
         std::cerr << "Failed to create Vector object for hover callback" << std::endl;
         PyErr_Print();
@@ -204,28 +213,10 @@ void PyHoverCallable::call(sf::Vector2f mousepos)
     }
 
     // #230 - Hover callbacks take only (pos), not (pos, button, action)
-    PyObject* args = Py_BuildValue("(O)", pos);
+    PyObject* retval = PyCallable::call({pos});
     Py_DECREF(pos);
-
-    PyObject* retval = PyCallable::call(args, NULL);
-    Py_DECREF(args);
-    if (!retval)
-    {
-        std::cerr << "Hover callback raised an exception:" << std::endl;
-        PyErr_Print();
-        PyErr_Clear();
-
-        // Check if we should exit on exception
-        if (McRFPy_API::game && McRFPy_API::game->getConfig().exit_on_exception) {
-            McRFPy_API::signalPythonException();
-        }
-    } else if (retval != Py_None)
-    {
-        std::cout << "HoverCallable returned a non-None value. It's not an error, it's just not being saved or used." << std::endl;
-        Py_DECREF(retval);
-    } else {
-        Py_DECREF(retval);
-    }
+    finishCallback(retval, "Hover callback raised an exception:",
+                   "HoverCallable returned a non-None value. It's not an error, it's just not being saved or used.");
 }
 
 PyObject* PyHoverCallable::borrow()
@@ -246,8 +237,7 @@ void PyCellHoverCallable::call(sf::Vector2i cellpos)
 {
     if (target == Py_None || target == NULL) return;
 
-    // Create a Vector object for the cell position
-    PyObject* pos = PyObject_CallFunction((PyObject*)&mcrfpydef::PyVectorType, "ii", cellpos.x, cellpos.y);
+    PyObject* pos = positionArg(sf::Vector2f(cellpos.x, cellpos.y));
     if (!pos) {
         std::cerr << "Failed to create Vector object for cell hover callback" << std::endl;
         PyErr_Print();
@@ -256,28 +246,10 @@ void PyCellHoverCallable::call(sf::Vector2i cellpos)
     }
 
     // #230 - Cell hover callbacks take only (cell_pos), not (cell_pos, button, action)
-    PyObject* args = Py_BuildValue("(O)", pos);
+    PyObject* retval = PyCallable::call({pos});
     Py_DECREF(pos);
-
-    PyObject* retval = PyCallable::call(args, NULL);
-    Py_DECREF(args);
-    if (!retval)
-    {
-        std::cerr << "Cell hover callback raised an exception:" << std::endl;
-        PyErr_Print();
-        PyErr_Clear();
-
-        // Check if we should exit on exception
-        if (McRFPy_API::game && McRFPy_API::game->getConfig().exit_on_exception) {
-            McRFPy_API::signalPythonException();
-        }
-    } else if (retval != Py_None)
-    {
-        std::cout << "CellHoverCallable returned a non-None value. It's not an error, it's just not being saved or used." << std::endl;
-        Py_DECREF(retval);
-    } else {
-        Py_DECREF(retval);
-    }
+    finishCallback(retval, "Cell hover callback raised an exception:",
+                   "CellHoverCallable returned a non-None value. It's not an error, it's just not being saved or used.");
 }
 
 PyObject* PyCellHoverCallable::borrow()
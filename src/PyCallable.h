@@ -1,6 +1,7 @@
 #pragma once
 #include "Common.h"
 #include "Python.h"
+#include <initializer_list>
 
 class PyCallable
 {
@@ -13,8 +14,21 @@ public:
     PyCallable& operator=(const PyCallable& other);
     ~PyCallable();
     PyObject* call(PyObject*, PyObject*);
+    // Positional call through PyObject_Vectorcall: no argument tuple is built.
+    PyObject* call(std::initializer_list<PyObject*> args) { return vectorcall(target, args); }
     bool isNone() const;
     PyObject* borrow() const { return target; }
+
+    // Vectorcall with up to MAX_VECTORCALL_ARGS positional args (borrowed).
+    // The stack keeps a spare leading slot so bound methods can prepend self
+    // without allocating (PY_VECTORCALL_ARGUMENTS_OFFSET).
+    static constexpr size_t MAX_VECTORCALL_ARGS = 4;
+    static PyObject* vectorcall(PyObject* callable, std::initializer_list<PyObject*> args);
+
+    // Vector argument for a callback, as a NEW reference. The object is
+    // recycled when the previous callback kept no reference to it, so steady
+    // mouse dispatch does not allocate a Vector per event.
+    static PyObject* positionArg(sf::Vector2f pos);
 };
 
 class PyClickCallable: public PyCallable
@@ -68,7 +68,11 @@ static int PyDrawable_set_visible(PyDrawableObject* self, PyObject* value, void*
         return -1;
     }
 
-    self->data->visible = (value == Py_True);
+    bool visible = (value == Py_True);
+    if (self->data->visible != visible) {
+        self->data->visible = visible;
+        self->data->markCompositeDirty();  // parent re-composites without it
+    }
     return 0;
 }
 
@@ -95,7 +99,10 @@ static int PyDrawable_set_opacity(PyDrawableObject* self, PyObject* value, void*
     if (val < 0.0f) val = 0.0f;
     if (val > 1.0f) val = 1.0f;
 
-    self->data->opacity = val;
+    if (self->data->opacity != val) {
+        self->data->opacity = val;
+        self->data->markContentDirty();  // opacity is baked into cached pixels
+    }
     return 0;
 }
 
@@ -1,5 +1,6 @@
 #include "PyFOV.h"
 #include "McRFPy_API.h"
+#include "FOVEngine.h"
 
 // Static storage for cached enum class reference
 PyObject* PyFOV::fov_enum_class = nullptr;
@@ -43,6 +44,9 @@ PyObject* PyFOV::create_enum_class(PyObject* module) {
         {"PERMISSIVE_8", FOV_PERMISSIVE_8},
         {"RESTRICTIVE", FOV_RESTRICTIVE},
         {"SYMMETRIC_SHADOWCAST", FOV_SYMMETRIC_SHADOWCAST},
+        // Native shadowcasting over the grid's transparency plane (FOVEngine)
+        {"NATIVE_SYMMETRIC", FOVEngine::NATIVE_SYMMETRIC},
+        {"NATIVE_FAST", FOVEngine::NATIVE_FAST},
     };
 
     for (const auto& m : fov_members) {
@@ -132,10 +136,10 @@ int PyFOV::from_arg(PyObject* arg, TCOD_fov_algorithm_t* out_algo, bool* was_non
         if (val == -1 && PyErr_Occurred()) {
             return 0;
         }
-        if (val < 0 || val >= NB_FOV_ALGORITHMS) {
+        if (val < 0 || val >= FOVEngine::ALGORITHM_COUNT) {
             PyErr_Format(PyExc_ValueError,
                 "Invalid FOV algorithm value: %ld. Must be 0-%d or use mcrfpy.FOV enum.",
-                val, NB_FOV_ALGORITHMS - 1);
+                val, FOVEngine::ALGORITHM_COUNT - 1);
             return 0;
         }
         *out_algo = (TCOD_fov_algorithm_t)val;
@@ -68,9 +68,19 @@ struct PyGridData
     static int set_fov(PyGridDataObject* self, PyObject* value, void* closure);
     static PyObject* get_fov_radius(PyGridDataObject* self, void* closure);
     static int set_fov_radius(PyGridDataObject* self, PyObject* value, void* closure);
+
+    // Dijkstra map cache budget / counters
+    static PyObject* get_dijkstra_cache_budget(PyGridDataObject* self, void* closure);
+    static int set_dijkstra_cache_budget(PyGridDataObject* self, PyObject* value, void* closure);
+    static PyObject* get_dijkstra_cache_stats(PyGridDataObject* self, void* closure);
+    // HPA* graph counters (Heuristic.HIERARCHICAL)
+    static PyObject* get_hpa_stats(PyGridDataObject* self, void* closure);
     static PyObject* py_at(PyGridDataObject* self, PyObject* args, PyObject* kwds);
     static PyObject* py_compute_fov(PyGridDataObject* self, PyObject* args, PyObject* kwds);
     static PyObject* py_is_in_fov(PyGridDataObject* self, PyObject* args, PyObject* kwds);
+    static PyObject* py_update_visibility(PyGridDataObject* self, PyObject* args, PyObject* kwds);
+    static PyObject* py_update_faction(PyGridDataObject* self, PyObject* args, PyObject* kwds);
+    static PyObject* py_faction_perspective(PyGridDataObject* self, PyObject* args, PyObject* kwds);
     static PyObject* py_entities_in_radius(PyGridDataObject* self, PyObject* args, PyObject* kwds);
     static PyObject* py_apply_threshold(PyGridDataObject* self, PyObject* args, PyObject* kwds);
     static PyObject* py_apply_ranges(PyGridDataObject* self, PyObject* args);
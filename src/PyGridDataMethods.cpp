@@ -13,10 +13,17 @@
 #include "PyVector.h"
 #include "PyHeightMap.h"
 #include "EntityBehavior.h"
+#include "PathProvider.h"
 #include "PyTrigger.h"
+#include "PyCallable.h"
+#include "PyStepEvents.h"
 #include "UIBase.h"
 #include "PyFOV.h"
+#include "PyDiscreteMap.h"
+#include "PyPerspective.h"
 #include "McRFPy_Doc.h"
+#include "WorkerPool.h"
+#include <unordered_map>
 
 // =========================================================================
 // Cell access: py_at, subscript, mpmethods
@@ -340,6 +347,147 @@ PyObject* PyGridData::py_layer(PyGridDataObject* self, PyObject* args) {
 // Spatial queries
 // =========================================================================
 
+// Batched entity.update_visibility(): every observer's FOV is computed by
+// FOVEngine on the worker pool with the GIL released, then applied to the
+// perspective maps in order on the main thread.
+PyObject* PyGridData::py_update_visibility(PyGridDataObject* self, PyObject* args, PyObject* kwds)
+{
+    static const char* kwlist[] = {"entities", NULL};
+    PyObject* entities_obj = Py_None;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|O", const_cast<char**>(kwlist), &entities_obj)) {
+        return NULL;
+    }
+
+    auto& grid = self->data;
+    std::vector<std::shared_ptr<UIEntity>> observers;
+    if (entities_obj == Py_None) {
+        if (grid->entities) observers = *grid->entities;
+    } else {
+        PyObject* seq = PySequence_Fast(entities_obj, "entities must be a sequence of Entity");
+        if (!seq) return NULL;
+        Py_ssize_t n = PySequence_Fast_GET_SIZE(seq);
+        observers.reserve(n);
+        for (Py_ssize_t i = 0; i < n; i++) {
+            PyObject* item = PySequence_Fast_GET_ITEM(seq, i);
+            if (!PyObject_IsInstance(item, (PyObject*)&mcrfpydef::PyUIEntityType)) {
+                Py_DECREF(seq);
+                PyErr_SetString(PyExc_TypeError, "entities must be a sequence of Entity");
+                return NULL;
+            }
+            auto& entity = ((PyUIEntityObject*)item)->data;
+            if (!entity || entity->grid != grid) {
+                Py_DECREF(seq);
+                PyErr_SetString(PyExc_ValueError, "every entity must belong to this grid");
+                return NULL;
+            }
+            observers.push_back(entity);
+        }
+        Py_DECREF(seq);
+    }
+    if (observers.empty()) Py_RETURN_NONE;
+
+    std::vector<FOVEngine::Origin> origins(observers.size());
+    for (size_t i = 0; i < observers.size(); i++) {
+        origins[i].x = observers[i]->cell_position.x;
+        origins[i].y = observers[i]->cell_position.y;
+        origins[i].radius = grid->fov_radius;
+        origins[i].algorithm = grid->fov_algorithm;
+    }
+    std::vector<FOVEngine::VisibilityMask> masks(observers.size());
+
+    std::string error;
+    Py_BEGIN_ALLOW_THREADS
+    try {
+        FOVEngine::computeBatch(*grid, origins.data(), origins.size(), masks.data());
+    } catch (const std::exception& e) {
+        error = e.what();
+        if (error.empty()) error = "unknown error";
+    }
+    Py_END_ALLOW_THREADS
+
+    if (!error.empty()) {
+        PyErr_Format(PyExc_RuntimeError, "update_visibility: %s", error.c_str());
+        return NULL;
+    }
+
+    for (size_t i = 0; i < observers.size(); i++) {
+        observers[i]->applyVisibility(masks[i]);
+    }
+    Py_RETURN_NONE;
+}
+
+// Faction perspective: the stale members' FOVs are computed with the GIL
+// released, as in py_update_visibility, then merged on the main thread.
+PyObject* PyGridData::py_update_faction(PyGridDataObject* self, PyObject* args, PyObject* kwds)
+{
+    static const char* kwlist[] = {"label", NULL};
+    const char* label;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "s", const_cast<char**>(kwlist), &label)) {
+        return NULL;
+    }
+    if (!*label) {
+        PyErr_SetString(PyExc_ValueError, "faction label must not be empty");
+        return NULL;
+    }
+
+    auto& grid = self->data;
+    auto& faction = grid->faction(label);
+    faction.prepare(*grid);
+
+    std::string error;
+    Py_BEGIN_ALLOW_THREADS
+    try {
+        faction.computeStale(*grid);
+    } catch (const std::exception& e) {
+        error = e.what();
+        if (error.empty()) error = "unknown error";
+    }
+    Py_END_ALLOW_THREADS
+
+    if (!error.empty()) {
+        PyErr_Format(PyExc_RuntimeError, "update_faction: %s", error.c_str());
+        return NULL;
+    }
+
+    if (!faction.merge()) Py_RETURN_FALSE;
+    grid->refreshFactionLayers(faction);
+    Py_RETURN_TRUE;
+}
+
+PyObject* PyGridData::py_faction_perspective(PyGridDataObject* self, PyObject* args, PyObject* kwds)
+{
+    static const char* kwlist[] = {"label", NULL};
+    const char* label;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "s", const_cast<char**>(kwlist), &label)) {
+        return NULL;
+    }
+
+    auto& grid = self->data;
+    if (grid->grid_w <= 0 || grid->grid_h <= 0) {
+        PyErr_SetString(PyExc_RuntimeError, "Grid has no cells");
+        return NULL;
+    }
+
+    // Snapshot; a faction not yet updated (or unknown) reads as all unknown.
+    auto map = std::make_shared<DiscreteMap>(grid->grid_w, grid->grid_h, 0);
+    auto it = grid->factions.find(label);
+    const PerspectiveBits* bits = it != grid->factions.end() ? it->second->bits() : nullptr;
+    if (bits && bits->width() == grid->grid_w && bits->height() == grid->grid_h) {
+        bits->toBytes(map->data());
+    }
+
+    auto type = &mcrfpydef::PyDiscreteMapType;
+    auto obj = (PyDiscreteMapObject*)type->tp_alloc(type, 0);
+    if (!obj) return NULL;
+    new (&obj->data) std::shared_ptr<DiscreteMap>(std::move(map));
+    obj->values = obj->data->data();
+    obj->w = obj->data->width();
+    obj->h = obj->data->height();
+    obj->enum_type = PyPerspective::perspective_enum_class;
+    if (obj->enum_type) Py_INCREF(obj->enum_type);
+    return (PyObject*)obj;
+}
+
 PyObject* PyGridData::py_entities_in_radius(PyGridDataObject* self, PyObject* args, PyObject* kwds)
 {
     static const char* kwlist[] = {"pos", "radius", NULL};
@@ -589,58 +737,165 @@ PyObject* PyGridData::py_apply_ranges(PyGridDataObject* self, PyObject* args) {
 
 static void fireStepCallback(std::shared_ptr<UIEntity>& entity, int trigger_int, PyObject* data) {
     PyObject* callback = entity->step_callback;
+    PyObject* step_attr = nullptr;
 
     if (!callback && entity->pyobject) {
-        PyObject* step_attr = PyObject_GetAttrString(entity->pyobject, "on_step");
-        if (step_attr && PyCallable_Check(step_attr)) {
-            callback = step_attr;
-        } else {
+        static PyObject* on_step_name = PyUnicode_InternFromString("on_step");
+        step_attr = PyObject_GetAttr(entity->pyobject, on_step_name);
+        if (!step_attr || !PyCallable_Check(step_attr)) {
             PyErr_Clear();
             Py_XDECREF(step_attr);
             return;
         }
-        PyObject* trigger_obj = nullptr;
-        if (PyTrigger::trigger_enum_class) {
-            trigger_obj = PyObject_CallFunction(PyTrigger::trigger_enum_class, "i", trigger_int);
-        }
-        if (!trigger_obj) {
-            PyErr_Clear();
-            trigger_obj = PyLong_FromLong(trigger_int);
-        }
-        if (!data) data = Py_None;
-        PyObject* result = PyObject_CallFunction(callback, "OO", trigger_obj, data);
-        Py_XDECREF(result);
-        if (PyErr_Occurred()) PyErr_Print();
-        Py_DECREF(trigger_obj);
-        Py_DECREF(step_attr);
-        return;
+        callback = step_attr;
     }
 
     if (!callback) return;
 
-    PyObject* trigger_obj = nullptr;
-    if (PyTrigger::trigger_enum_class) {
-        trigger_obj = PyObject_CallFunction(PyTrigger::trigger_enum_class, "i", trigger_int);
-    }
+    PyObject* trigger_obj = PyTrigger::get_enum_member(trigger_int);
     if (!trigger_obj) {
         PyErr_Clear();
         trigger_obj = PyLong_FromLong(trigger_int);
     }
 
     if (!data) data = Py_None;
-    PyObject* result = PyObject_CallFunction(callback, "OO", trigger_obj, data);
+    PyObject* result = PyCallable::vectorcall(callback, {trigger_obj, data});
     Py_XDECREF(result);
     if (PyErr_Occurred()) PyErr_Print();
     Py_DECREF(trigger_obj);
+    Py_XDECREF(step_attr);
+}
+
+// grid.step(batch_callbacks=handler): a round's triggers are recorded here
+// instead of calling each entity's step callback, then handed to the handler
+// in one call. Indices refer to grid.entities as it was when the round began;
+// no Python runs during the round, so they stay valid until delivery.
+struct StepEventBatch {
+    std::unordered_map<const UIEntity*, int32_t> index;
+    std::vector<StepEvent> events;
+
+    void beginRound(const std::vector<std::shared_ptr<UIEntity>>& entities) {
+        index.clear();
+        index.reserve(entities.size());
+        for (size_t i = 0; i < entities.size(); i++) {
+            index.emplace(entities[i].get(), static_cast<int32_t>(i));
+        }
+    }
+
+    int32_t indexOf(const UIEntity* entity) const {
+        auto it = entity ? index.find(entity) : index.end();
+        return it != index.end() ? it->second : -1;
+    }
+
+    void add(const UIEntity& entity, int trigger, const UIEntity* partner) {
+        events.push_back({indexOf(&entity), trigger, indexOf(partner)});
+    }
+
+    void deliver(PyObject* handler, int round) {
+        if (events.empty()) return;
+        PyObject* batch = PyStepEvents::create(events, round);
+        PyObject* result = batch ? PyCallable::vectorcall(handler, {batch}) : nullptr;
+        Py_XDECREF(result);
+        if (PyErr_Occurred()) PyErr_Print();
+        Py_XDECREF(batch);
+        events.clear();
+    }
+};
+
+// #303 - Fill an entity's TARGET visibility cache with the FOV at its cell and
+// sight_radius. FOVEngine reads only the cell planes, so this is safe on a
+// worker thread and takes no lock.
+static void fillTargetFOVCache(UIEntity& entity, const GridData& grid) {
+    auto& cache = entity.target_fov_cache;
+    FOVEngine::Origin origin;
+    origin.x = entity.cell_position.x;
+    origin.y = entity.cell_position.y;
+    origin.radius = entity.sight_radius;
+    origin.algorithm = grid.fov_algorithm;
+    FOVEngine::compute(grid, origin, cache.visibility);
+    cache.origin = entity.cell_position;
+    cache.radius = entity.sight_radius;
+    cache.transparency_gen = grid.transparency_generation;
+    cache.filled = true;
+}
+
+// Plan-phase half of the TARGET check: precompute the visibility cache for an
+// entity that has a labeled candidate in range right now. The commit phase
+// still re-queries candidates against live positions and re-validates the
+// cache, so this only moves the FOV cost off the main thread.
+static void precomputeTargetFOV(UIEntity& entity, const GridData& grid) {
+    auto& cache = entity.target_fov_cache;
+    if (cache.isValid(entity.cell_position, entity.sight_radius, grid.transparency_generation)) return;
+
+    bool any_target = false;
+    grid.spatial_hash.forEachInRadius(
+        static_cast<float>(entity.cell_position.x),
+        static_cast<float>(entity.cell_position.y),
+        static_cast<float>(entity.sight_radius),
+        [&](UIEntity& candidate) {
+            any_target = &candidate != &entity && candidate.labels.count(entity.target_label);
+            return !any_target;
+        });
+    if (!any_target) return;
+
+    fillTargetFOVCache(entity, grid);
+}
+
+// Parallel plan phase of grid.step(parallel=True). Runs with the GIL released:
+// nothing here may touch a PyObject. Each index writes only its own plan and
+// its own entity's TARGET cache. As with any call that drops the GIL, another
+// Python thread must not mutate this grid while step() is running.
+static bool planStepParallel(GridData& grid, const std::vector<std::shared_ptr<UIEntity>>& snapshot,
+                             std::vector<BehaviorPlan>& plans) {
+    plans.clear();
+    plans.resize(snapshot.size());
+    auto& pool = WorkerPool::instance();
+
+    std::string error;
+    Py_BEGIN_ALLOW_THREADS
+    try {
+        pool.parallelFor(snapshot.size(), 64, [&](size_t begin, size_t end, unsigned) {
+            for (size_t i = begin; i < end; i++) {
+                UIEntity& entity = *snapshot[i];
+                if (!entity.grid) continue;
+                if (entity.behavior.type == BehaviorType::IDLE) continue;
+                if (!entity.target_label.empty()) {
+                    precomputeTargetFOV(entity, grid);
+                }
+                plans[i] = planBehavior(entity, grid);
+            }
+        });
+    } catch (const std::exception& e) {
+        error = e.what();
+        if (error.empty()) error = "unknown error";
+    }
+    Py_END_ALLOW_THREADS
+
+    if (!error.empty()) {
+        PyErr_Format(PyExc_RuntimeError, "grid.step(parallel=True): plan phase failed: %s", error.c_str());
+        return false;
+    }
+    return true;
 }
 
 PyObject* PyGridData::py_step(PyGridDataObject* self, PyObject* args, PyObject* kwds) {
-    static const char* kwlist[] = {"n", "turn_order", nullptr};
+    static const char* kwlist[] = {"n", "turn_order", "parallel", "batch_callbacks", nullptr};
     int n = 1;
     PyObject* turn_order_filter = nullptr;
+    int parallel = 0;
+    PyObject* batch_handler = nullptr;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|iOpO", const_cast<char**>(kwlist),
+                                     &n, &turn_order_filter, &parallel, &batch_handler)) {
+        return NULL;
+    }
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|iO", const_cast<char**>(kwlist),
-                                     &n, &turn_order_filter)) {
+    // A map holds no Python callbacks (#361), so the grid-level handler is
+    // passed to step() rather than stored on the grid.
+    if (batch_handler == Py_None || batch_handler == Py_False) batch_handler = nullptr;
+    if (batch_handler && !PyCallable_Check(batch_handler)) {
+        PyErr_SetString(PyExc_TypeError,
+                        "batch_callbacks must be a callable taking the round's events, or None");
         return NULL;
     }
 
@@ -658,7 +913,19 @@ PyObject* PyGridData::py_step(PyGridDataObject* self, PyObject* args, PyObject*
     // so we can invalidate the view's render cache once after all rounds.
     bool content_changed = false;
 
+    // Parallel mode: every round is planned across the worker pool first, then
+    // committed below in exactly the serial order. A plan is only used if it is
+    // still current when the entity's turn comes (see BehaviorPlan::isCurrent);
+    // otherwise the entity is re-executed serially, so callbacks that move
+    // entities, reset behaviors or edit walkability mid-round see identical
+    // results. Plans are pure, so a plan preempted by TARGET is just dropped.
+    std::vector<BehaviorPlan> plans;
+    std::vector<UIEntity*> matching_targets;  // reused; filled without allocating per query
+    StepEventBatch batch;
+
     for (int round = 0; round < n; round++) {
+        if (batch_handler) batch.beginRound(*grid->entities);
+
         std::vector<std::shared_ptr<UIEntity>> snapshot;
         for (auto& entity : *grid->entities) {
             if (entity->turn_order == 0) continue;
@@ -669,51 +936,51 @@ PyObject* PyGridData::py_step(PyGridDataObject* self, PyObject* args, PyObject*
         std::sort(snapshot.begin(), snapshot.end(),
             [](const auto& a, const auto& b) { return a->turn_order < b->turn_order; });
 
-        for (auto& entity : snapshot) {
+        if (parallel) {
+            // Dijkstra maps are repaired here, on the main thread: planning
+            // only reads them.
+            for (auto& entity : snapshot) {
+                if (entity->behavior.path_provider) {
+                    entity->behavior.path_provider->refresh(entity->cell_position, *grid);
+                }
+            }
+            if (!planStepParallel(*grid, snapshot, plans)) return NULL;
+        }
+
+        for (size_t i = 0; i < snapshot.size(); i++) {
+            auto& entity = snapshot[i];
             if (!entity->grid) continue;
             if (entity->behavior.type == BehaviorType::IDLE) continue;
 
             if (!entity->target_label.empty()) {
-                auto nearby = grid->spatial_hash.queryRadius(
+                matching_targets.clear();
+                grid->spatial_hash.forEachInRadius(
                     static_cast<float>(entity->cell_position.x),
                     static_cast<float>(entity->cell_position.y),
-                    static_cast<float>(entity->sight_radius));
-
-                std::vector<std::shared_ptr<UIEntity>> matching_targets;
-                for (auto& candidate : nearby) {
-                    if (candidate.get() != entity.get() &&
-                        candidate->labels.count(entity->target_label)) {
-                        matching_targets.push_back(candidate);
-                    }
-                }
+                    static_cast<float>(entity->sight_radius),
+                    [&](UIEntity& candidate) {
+                        if (&candidate != entity.get() &&
+                            candidate.labels.count(entity->target_label)) {
+                            matching_targets.push_back(&candidate);
+                        }
+                    });
 
                 if (!matching_targets.empty()) {
                     auto& cache = entity->target_fov_cache;
 
                     if (!cache.isValid(entity->cell_position, entity->sight_radius,
                                        grid->transparency_generation)) {
-                        grid->computeFOV(entity->cell_position.x, entity->cell_position.y,
-                                        entity->sight_radius, true, grid->fov_algorithm);
-
-                        int r = entity->sight_radius;
-                        int side = 2 * r + 1;
-                        cache.origin = entity->cell_position;
-                        cache.radius = r;
-                        cache.transparency_gen = grid->transparency_generation;
-                        cache.vis_side = side;
-                        cache.visibility.resize(side * side);
-                        for (int dy = -r; dy <= r; dy++) {
-                            for (int dx = -r; dx <= r; dx++) {
-                                cache.visibility[(dy + r) * side + (dx + r)] =
-                                    grid->isInFOV(entity->cell_position.x + dx,
-                                                  entity->cell_position.y + dy);
-                            }
-                        }
+                        fillTargetFOVCache(*entity, *grid);
                     }
 
-                    for (auto& target : matching_targets) {
+                    for (UIEntity* target : matching_targets) {
                         if (cache.isVisible(target->cell_position.x,
                                            target->cell_position.y)) {
+                            if (batch_handler) {
+                                batch.add(*entity, 2 /* TARGET */, target);
+                                goto next_entity;
+                            }
+                            auto keep_alive = target->shared_from_this();  // across the callback
                             PyObject* target_pyobj = Py_None;
                             if (target->pyobject) {
                                 target_pyobj = target->pyobject;
@@ -726,32 +993,51 @@ PyObject* PyGridData::py_step(PyGridDataObject* self, PyObject* args, PyObject*
             }
 
             {
-                BehaviorOutput output = executeBehavior(*entity, *grid);
+                BehaviorOutput output;
+                if (parallel && plans[i].isCurrent(*entity, *grid)) {
+                    output = commitBehavior(*entity, plans[i]);
+                } else {
+                    output = executeBehavior(*entity, *grid);
+                }
 
                 switch (output.result) {
                     case BehaviorResult::MOVED: {
                         int old_x = entity->cell_position.x;
                         int old_y = entity->cell_position.y;
+                        sf::Vector2f old_pos = entity->position;
                         entity->cell_position = output.target_cell;
-                        grid->spatial_hash.updateCell(entity, old_x, old_y);
-
                         entity->position = sf::Vector2f(
                             static_cast<float>(output.target_cell.x),
                             static_cast<float>(output.target_cell.y));
-                        content_changed = true;  // #351 - view render cache is now stale
+                        // After the draw position too: it re-buckets both
+                        grid->spatial_hash.updateCell(entity, old_x, old_y);
+                        // #351 - view render cache is stale where it was and is
+                        grid->damageEntity(*entity, old_pos);
+                        grid->damageEntity(*entity, entity->position);
+                        content_changed = true;
                         break;
                     }
                     case BehaviorResult::DONE: {
-                        fireStepCallback(entity, 0 /* DONE */, Py_None);
+                        if (batch_handler) batch.add(*entity, 0 /* DONE */, nullptr);
+                        else fireStepCallback(entity, 0 /* DONE */, Py_None);
                         entity->behavior.type = static_cast<BehaviorType>(entity->default_behavior);
                         break;
                     }
                     case BehaviorResult::BLOCKED: {
                         PyObject* blocker = Py_None;
-                        auto blockers = grid->spatial_hash.queryCell(
-                            output.target_cell.x, output.target_cell.y);
-                        if (!blockers.empty() && blockers[0]->pyobject) {
-                            blocker = blockers[0]->pyobject;
+                        std::shared_ptr<UIEntity> first_blocker;
+                        grid->spatial_hash.forEachInCell(
+                            output.target_cell.x, output.target_cell.y,
+                            [&](UIEntity& e) {
+                                first_blocker = e.shared_from_this();
+                                return false;
+                            });
+                        if (batch_handler) {
+                            batch.add(*entity, 1 /* BLOCKED */, first_blocker.get());
+                            break;
+                        }
+                        if (first_blocker && first_blocker->pyobject) {
+                            blocker = first_blocker->pyobject;
                         }
                         fireStepCallback(entity, 1 /* BLOCKED */, blocker);
                         break;
@@ -762,10 +1048,12 @@ PyObject* PyGridData::py_step(PyGridDataObject* self, PyObject* args, PyObject*
             }
             next_entity:;
         }
+
+        if (batch_handler) batch.deliver(batch_handler, round);
     }
 
     // #351 - invalidate the view's render early-out once if anything moved.
-    if (content_changed) grid->markCompositeDirty();
+    if (content_changed) grid->notifyCompositeDirty();  // generations bumped by damageEntity
 
     Py_RETURN_NONE;
 }
@@ -796,7 +1084,7 @@ PyMethodDef PyGridData_all_methods[] = {
          MCRF_ARG("pos", "Position as (x, y) tuple, list, or Vector")
          MCRF_ARG("radius", "Maximum view distance (0 = unlimited)")
          MCRF_ARG("light_walls", "Whether walls are lit when visible")
-         MCRF_ARG("algorithm", "FOV algorithm to use (FOV.BASIC, FOV.DIAMOND, FOV.SHADOW, FOV.PERMISSIVE_0-8)")
+         MCRF_ARG("algorithm", "FOV algorithm to use (FOV.BASIC, FOV.DIAMOND, FOV.SHADOW, FOV.PERMISSIVE_0-8, FOV.SYMMETRIC_SHADOWCAST, or the native FOV.NATIVE_SYMMETRIC / FOV.NATIVE_FAST)")
          MCRF_RETURNS("None")
      )},
     {"is_in_fov", (PyCFunction)PyGridData::py_is_in_fov, METH_VARARGS | METH_KEYWORDS,
@@ -809,34 +1097,65 @@ PyMethodDef PyGridData_all_methods[] = {
          MCRF_RETURNS("True if the cell is visible, False otherwise")
          MCRF_NOTE("Also accepts a single positional tuple/list/Vector: is_in_fov((x, y)) or is_in_fov(vec), or keyword form: is_in_fov(pos=(x, y)).")
      )},
+    {"update_visibility", (PyCFunction)PyGridData::py_update_visibility, METH_VARARGS | METH_KEYWORDS,
+     MCRF_METHOD(GridData, update_visibility,
+         MCRF_SIG("(entities: list = None)", "None"),
+         MCRF_DESC("Update the perspective maps of many entities at once. Equivalent to calling update_visibility() on each entity, but every field of view is computed in parallel with the GIL released."),
+         MCRF_ARGS_START
+         MCRF_ARG("entities", "Entities on this grid to update (default: all of the grid's entities)")
+         MCRF_RETURNS("None")
+         MCRF_RAISES("TypeError", "If entities contains a non-Entity")
+         MCRF_RAISES("ValueError", "If an entity belongs to a different grid")
+         MCRF_NOTE("Uses the grid's fov_radius and fov algorithm. Unlike Entity.update_visibility(), this does not change the state read by is_in_fov().")
+     )},
+    {"update_faction", (PyCFunction)PyGridData::py_update_faction, METH_VARARGS | METH_KEYWORDS,
+     MCRF_METHOD(GridData, update_faction,
+         MCRF_SIG("(label: str)", "bool"),
+         MCRF_DESC("Update the shared perspective of every entity carrying label. Only members that moved (or whose view the grid's transparency, fov or fov_radius changed) recompute their FOV, in parallel with the GIL released; the union is then rebuilt with bitwise OR. ColorLayers bound with apply_perspective(faction=label) are repainted where it changed."),
+         MCRF_ARGS_START
+         MCRF_ARG("label", "Entity label that defines the faction")
+         MCRF_RETURNS("True if the faction's perspective changed, False if nothing needed recomputing")
+         MCRF_RAISES("ValueError", "If label is empty")
+         MCRF_NOTE("Call once per turn after moving units. Members are whichever entities hold the label at the time of the call.")
+     )},
+    {"faction_perspective", (PyCFunction)PyGridData::py_faction_perspective, METH_VARARGS | METH_KEYWORDS,
+     MCRF_METHOD(GridData, faction_perspective,
+         MCRF_SIG("(label: str)", "DiscreteMap"),
+         MCRF_DESC("Snapshot of a faction's shared perspective, with the same Perspective values as Entity.perspective_map (0=unknown, 1=discovered, 2=visible)."),
+         MCRF_ARGS_START
+         MCRF_ARG("label", "Entity label that defines the faction")
+         MCRF_RETURNS("DiscreteMap: a copy; all unknown until update_faction(label) has run")
+     )},
     {"find_path", (PyCFunction)UIGridPathfinding::Grid_find_path, METH_VARARGS | METH_KEYWORDS,
      MCRF_METHOD(GridData, find_path,
-         MCRF_SIG("(start, end, diagonal_cost: float = 1.41, collide: str = None, heuristic = None, weight: float = 1.0)", "AStarPath | None"),
+         MCRF_SIG("(start, end, diagonal_cost: float = 1.41, collide: str = None, heuristic = None, weight: float = 1.0, weights: DiscreteMap = None)", "AStarPath | None"),
          MCRF_DESC("Compute A* path between two points. The returned AStarPath can be iterated or walked step-by-step."),
          MCRF_ARGS_START
          MCRF_ARG("start", "Starting position as Vector, Entity, or (x, y) tuple")
          MCRF_ARG("end", "Target position as Vector, Entity, or (x, y) tuple")
          MCRF_ARG("diagonal_cost", "Cost of diagonal movement (default: 1.41)")
          MCRF_ARG("collide", "Label string. Entities with this label block pathfinding.")
-         MCRF_ARG("heuristic", "Heuristic enum member, string name, or int (EUCLIDEAN=0, MANHATTAN=1, CHEBYSHEV=2). None uses default (Euclidean).")
-         MCRF_ARG("weight", "Heuristic weight multiplier. Values > 1.0 trade optimality for speed (weighted A*).")
+         MCRF_ARG("heuristic", "Heuristic enum member, string name, or int (EUCLIDEAN=0, MANHATTAN=1, CHEBYSHEV=2). None uses default (Euclidean). HIERARCHICAL searches a cached cluster graph (see hpa_stats): far faster across large maps, paths may be slightly longer than optimal.")
+         MCRF_ARG("weight", "Heuristic weight multiplier. Values > 1.0 trade optimality for speed (weighted A*). Ignored by HIERARCHICAL.")
+         MCRF_ARG("weights", "Optional per-cell cost DiscreteMap (same size as the grid). Entering a cell costs its value times the step cost; 0 blocks the cell.")
          MCRF_RETURNS("AStarPath object if path exists, None otherwise")
      )},
     {"get_dijkstra_map", (PyCFunction)UIGridPathfinding::Grid_get_dijkstra_map, METH_VARARGS | METH_KEYWORDS,
      MCRF_METHOD(GridData, get_dijkstra_map,
-         MCRF_SIG("(root=None, diagonal_cost: float = 1.41, collide: str = None, roots=None)", "DijkstraMap"),
-         MCRF_DESC("Get or create a cached Dijkstra distance map for a root position. Call clear_dijkstra_maps() after changing grid walkability to invalidate."),
+         MCRF_SIG("(root=None, diagonal_cost: float = 1.41, collide: str = None, roots=None, weights: DiscreteMap = None)", "DijkstraMap"),
+         MCRF_DESC("Get or create a cached Dijkstra distance map for a root position. Maps stay current: walkability edits and moves of collide-labelled entities are repaired incrementally on the next query; the cache is LRU-bounded by dijkstra_cache_budget."),
          MCRF_ARGS_START
          MCRF_ARG("root", "Root position as Vector, Entity, or (x, y) tuple. Use 'root' for single-source maps (cached by position).")
          MCRF_ARG("diagonal_cost", "Cost of diagonal movement (default: 1.41)")
          MCRF_ARG("collide", "Label string. Entities with this label block pathfinding.")
          MCRF_ARG("roots", "Sequence of root positions or a DiscreteMap mask for multi-source Dijkstra. Pass 'roots' instead of 'root' for multi-source maps (not cached).")
+         MCRF_ARG("weights", "Optional per-cell cost DiscreteMap (same size as the grid). Entering a cell costs its value times the step cost; 0 blocks the cell. Weighted maps are not cached.")
          MCRF_RETURNS("DijkstraMap object for querying distances and paths")
      )},
     {"clear_dijkstra_maps", (PyCFunction)UIGridPathfinding::Grid_clear_dijkstra_maps, METH_NOARGS,
      MCRF_METHOD(GridData, clear_dijkstra_maps,
          MCRF_SIG("()", "None"),
-         MCRF_DESC("Clear all cached Dijkstra maps. Call this after modifying grid cell walkability to ensure pathfinding uses updated walkability data.")
+         MCRF_DESC("Clear all cached Dijkstra maps and release their memory. Not needed for correctness: cached maps follow grid edits automatically. Statistics in dijkstra_cache_stats are kept.")
      )},
     {"add_layer", (PyCFunction)PyGridData::py_add_layer, METH_VARARGS,
      MCRF_METHOD(GridData, add_layer,
@@ -897,11 +1216,14 @@ PyMethodDef PyGridData_all_methods[] = {
      )},
     {"step", (PyCFunction)PyGridData::py_step, METH_VARARGS | METH_KEYWORDS,
      MCRF_METHOD(GridData, step,
-         MCRF_SIG("(n: int = 1, turn_order: int = None)", "None"),
+         MCRF_SIG("(n: int = 1, turn_order: int = None, parallel: bool = False, batch_callbacks: Callable = None)", "None"),
          MCRF_DESC("Execute n rounds of turn-based entity behavior. Each round: entities grouped by turn_order (ascending), behaviors executed, triggers fired (TARGET, DONE, BLOCKED), movement animated."),
          MCRF_ARGS_START
          MCRF_ARG("n", "Number of rounds to execute (default: 1)")
          MCRF_ARG("turn_order", "If provided, only process entities with this turn_order value")
+         MCRF_ARG("parallel", "Plan every entity's behavior and TARGET visibility on worker threads with the GIL released, then commit in turn order on the main thread. Produces the same moves and callbacks as a serial step; plans invalidated by an earlier callback are re-run serially.")
+         MCRF_ARG("batch_callbacks", "Handler called once per round with that round's DONE/BLOCKED/TARGET events instead of each entity's step callback. The events object exports a read-only (n, 3) int32 buffer of (entity, trigger, partner) rows for numpy; entity and partner index grid.entities at the start of the round, partner is -1 if none. The handler runs after the round's moves, and is not called for rounds without events.")
+         MCRF_NOTE("TARGET checks do not update the grid's shared compute_fov()/is_in_fov() state.")
      )},
     {NULL}
 };
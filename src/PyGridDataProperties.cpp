@@ -99,6 +99,63 @@ int PyGridData::set_fov_radius(PyGridDataObject* self, PyObject* value, void* cl
     return 0;
 }
 
+// =========================================================================
+// Dijkstra map cache
+// =========================================================================
+
+PyObject* PyGridData::get_dijkstra_cache_budget(PyGridDataObject* self, void* closure)
+{
+    return PyLong_FromSize_t(self->data->dijkstra_maps.budget());
+}
+
+int PyGridData::set_dijkstra_cache_budget(PyGridDataObject* self, PyObject* value, void* closure)
+{
+    if (!PyLong_Check(value)) {
+        PyErr_SetString(PyExc_TypeError, "dijkstra_cache_budget must be an integer");
+        return -1;
+    }
+    long long bytes = PyLong_AsLongLong(value);
+    if (bytes == -1 && PyErr_Occurred()) {
+        return -1;
+    }
+    if (bytes < 0) {
+        PyErr_SetString(PyExc_ValueError, "dijkstra_cache_budget must be non-negative");
+        return -1;
+    }
+    self->data->dijkstra_maps.setBudget(static_cast<size_t>(bytes));
+    return 0;
+}
+
+PyObject* PyGridData::get_dijkstra_cache_stats(PyGridDataObject* self, void* closure)
+{
+    const auto& cache = self->data->dijkstra_maps;
+    const auto& st = cache.stats();
+    return Py_BuildValue("{s:K,s:K,s:K,s:K,s:K,s:n,s:n,s:n}",
+        "hits", (unsigned long long)st.hits,
+        "misses", (unsigned long long)st.misses,
+        "evictions", (unsigned long long)st.evictions,
+        "invalidations", (unsigned long long)st.invalidations,
+        "repairs", (unsigned long long)st.repairs,
+        "entries", (Py_ssize_t)cache.size(),
+        "bytes", (Py_ssize_t)cache.bytes(),
+        "budget", (Py_ssize_t)cache.budget());
+}
+
+PyObject* PyGridData::get_hpa_stats(PyGridDataObject* self, void* closure)
+{
+    const auto& graph = self->data->hpa_graph;
+    const auto& st = graph.stats();
+    return Py_BuildValue("{s:O,s:K,s:K,s:K,s:K,s:n,s:n,s:n}",
+        "built", graph.built() ? Py_True : Py_False,
+        "full_builds", (unsigned long long)st.full_builds,
+        "cluster_rebuilds", (unsigned long long)st.cluster_rebuilds,
+        "queries", (unsigned long long)st.queries,
+        "fallbacks", (unsigned long long)st.fallbacks,
+        "clusters", (Py_ssize_t)graph.clusterCount(),
+        "nodes", (Py_ssize_t)graph.nodeCount(),
+        "edges", (Py_ssize_t)graph.edgeCount());
+}
+
 // =========================================================================
 // Collection getters
 // =========================================================================
@@ -210,5 +267,23 @@ PyGetSetDef PyGridData::getsetters[] = {
      ), NULL},
     {"fov_radius", (getter)PyGridData::get_fov_radius, (setter)PyGridData::set_fov_radius,
      MCRF_PROPERTY(fov_radius, "Default FOV radius for this map (int). Used when radius is not specified."), NULL},
+    {"dijkstra_cache_budget", (getter)PyGridData::get_dijkstra_cache_budget, (setter)PyGridData::set_dijkstra_cache_budget,
+     MCRF_PROPERTY(dijkstra_cache_budget,
+         "Memory budget in bytes for cached get_dijkstra_map() results (int). "
+         "Least-recently-used maps are evicted beyond it; 0 disables caching. Default 64 MiB."
+     ), NULL},
+    {"dijkstra_cache_stats", (getter)PyGridData::get_dijkstra_cache_stats, NULL,
+     MCRF_PROPERTY(dijkstra_cache_stats,
+         "Dijkstra cache counters (dict, read-only): hits, misses, evictions, "
+         "invalidations (maps recomputed in full because the grid changed), "
+         "repairs (maps patched locally after walkability edits), entries, bytes, budget."
+     ), NULL},
+    {"hpa_stats", (getter)PyGridData::get_hpa_stats, NULL,
+     MCRF_PROPERTY(hpa_stats,
+         "Hierarchical pathfinding counters (dict, read-only): built, full_builds, "
+         "cluster_rebuilds (clusters rebuilt, including those of full builds), queries, "
+         "fallbacks (queries answered by plain A*), clusters, nodes, edges. "
+         "The graph is built by the first find_path(heuristic=Heuristic.HIERARCHICAL)."
+     ), NULL},
     {NULL}
 };
@@ -15,6 +15,7 @@ static const HeuristicEntry heuristic_table[] = {
     {"CHEBYSHEV", 2},
     {"DIAGONAL",  3},
     {"ZERO",      4},
+    {"HIERARCHICAL", 5},
 };
 
 static const int NUM_HEURISTIC_ENTRIES =
@@ -32,6 +33,8 @@ PyObject* PyHeuristic::create_enum_class(PyObject* module) {
     code << "        CHEBYSHEV: max(|dx|, |dy|). Admissible on 8-connected (diag=1).\n";
     code << "        DIAGONAL: Octile distance. Admissible on 8-connected (diag=sqrt(2)).\n";
     code << "        ZERO: Always returns 0. A* degenerates to Dijkstra.\n";
+    code << "        HIERARCHICAL: HPA* over cached cluster entrances. Much faster on large\n";
+    code << "            maps; paths may be a few percent longer than optimal. weight is ignored.\n";
     code << "    \"\"\"\n";
     for (int i = 0; i < NUM_HEURISTIC_ENTRIES; i++) {
         code << "    " << heuristic_table[i].name
@@ -104,7 +107,7 @@ int PyHeuristic::from_arg(PyObject* arg, int* out_value) {
         if (val == -1 && PyErr_Occurred()) return 0;
         if (val < 0 || val >= NUM_HEURISTIC_VALUES) {
             PyErr_Format(PyExc_ValueError,
-                "Invalid Heuristic value: %ld. Must be 0..4.", val);
+                "Invalid Heuristic value: %ld. Must be 0..5.", val);
             return 0;
         }
         *out_value = static_cast<int>(val);
@@ -121,7 +124,7 @@ int PyHeuristic::from_arg(PyObject* arg, int* out_value) {
             }
         }
         PyErr_Format(PyExc_ValueError,
-            "Unknown Heuristic: '%s'. Use EUCLIDEAN, MANHATTAN, CHEBYSHEV, DIAGONAL, or ZERO.", name);
+            "Unknown Heuristic: '%s'. Use EUCLIDEAN, MANHATTAN, CHEBYSHEV, DIAGONAL, ZERO, or HIERARCHICAL.", name);
         return 0;
     }
 
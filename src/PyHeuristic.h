@@ -13,27 +13,31 @@
 //   CHEBYSHEV = 2   (admissible on 8-connected, diag cost 1)
 //   DIAGONAL  = 3   (octile, admissible on 8-connected, diag cost sqrt(2))
 //   ZERO      = 4   (A* degenerates to Dijkstra)
+//   HIERARCHICAL = 5 (HPA* over cluster entrances; see HPAGraph.h. Not a
+//                     libtcod / PathEngine heuristic: callers route it to
+//                     GridData::hpa_graph instead)
 class PyHeuristic {
 public:
     // Create the Heuristic enum class and add to module.
     static PyObject* create_enum_class(PyObject* module);
 
     // Helper to extract a Heuristic value from a Python arg.
-    // Accepts Heuristic enum member, string (enum name), or int 0..4.
+    // Accepts Heuristic enum member, string (enum name), or int 0..5.
     // Returns 1 on success, 0 on error (with exception set).
     static int from_arg(PyObject* arg, int* out_value);
 
     // Returns the libtcod built-in heuristic function pointer for a given value.
-    // Returns nullptr if value is invalid.
+    // Returns nullptr if value is invalid or has no libtcod form (HIERARCHICAL).
     static TCOD_heuristic_func_t get_function(int heuristic_value);
 
     // Cached reference to the Heuristic enum class for fast type checking.
     static PyObject* heuristic_enum_class;
 
-    static const int NUM_HEURISTIC_VALUES = 5;
+    static const int NUM_HEURISTIC_VALUES = 6;
     static const int EUCLIDEAN = 0;
     static const int MANHATTAN = 1;
     static const int CHEBYSHEV = 2;
     static const int DIAGONAL  = 3;
     static const int ZERO      = 4;
+    static const int HIERARCHICAL = 5;
 };
@@ -1,9 +1,30 @@
 #include "PyMouseButton.h"
 #include <sstream>
+#include <unordered_map>
 
 // Static storage for cached enum class reference
 PyObject* PyMouseButton::mouse_button_enum_class = nullptr;
 
+// #344 - memoized enum members (value -> strong ref to MouseButton member).
+static std::unordered_map<int, PyObject*> mouse_button_member_cache;
+
+PyObject* PyMouseButton::get_enum_member(int value) {
+    if (!mouse_button_enum_class) {
+        PyErr_SetString(PyExc_RuntimeError, "MouseButton enum class not initialized");
+        return nullptr;
+    }
+    auto it = mouse_button_member_cache.find(value);
+    if (it != mouse_button_member_cache.end()) {
+        Py_INCREF(it->second);
+        return it->second;
+    }
+    PyObject* member = PyObject_CallFunction(mouse_button_enum_class, "i", value);
+    if (!member) return nullptr;
+    Py_INCREF(member);                          // strong ref held by the cache
+    mouse_button_member_cache[value] = member;
+    return member;                              // caller owns the other ref
+}
+
 // MouseButton entries - maps enum name to value
 struct MouseButtonEntry {
     const char* name;       // Python enum name (UPPER_SNAKE_CASE)
@@ -26,6 +26,11 @@ public:
     // Cached reference to the MouseButton enum class for fast type checking
     static PyObject* mouse_button_enum_class;
 
+    // Return the MouseButton member for an integer value as a NEW reference.
+    // Members are memoized (#344 pattern) so click dispatch avoids
+    // EnumMeta.__call__. Returns nullptr with an exception set on failure.
+    static PyObject* get_enum_member(int value);
+
     // Number of mouse buttons
     static const int NUM_MOUSE_BUTTONS = 5;
 };
@@ -77,10 +77,7 @@ static bool tryCallPythonMethod(UIDrawable* drawable, const char* method_name,
         else if (strcmp(button, "wheel_down") == 0) button_val = 11; // SCROLL_DOWN
         // For hover events, button might be "enter", "exit", "move" - use LEFT as default
 
-        PyObject* button_enum = nullptr;
-        if (PyMouseButton::mouse_button_enum_class) {
-            button_enum = PyObject_CallFunction(PyMouseButton::mouse_button_enum_class, "i", button_val);
-        }
+        PyObject* button_enum = PyMouseButton::get_enum_member(button_val);
         if (!button_enum) {
             PyErr_Clear();
             button_enum = PyLong_FromLong(button_val);  // Fallback to int
@@ -89,10 +86,7 @@ static bool tryCallPythonMethod(UIDrawable* drawable, const char* method_name,
         // Convert action string to InputState enum
         int action_val = (strcmp(action, "start") == 0) ? 0 : 1;  // PRESSED=0, RELEASED=1
 
-        PyObject* action_enum = nullptr;
-        if (PyInputState::input_state_enum_class) {
-            action_enum = PyObject_CallFunction(PyInputState::input_state_enum_class, "i", action_val);
-        }
+        PyObject* action_enum = PyInputState::get_enum_member(action_val);
         if (!action_enum) {
             PyErr_Clear();
             action_enum = PyLong_FromLong(action_val);  // Fallback to int
@@ -441,33 +435,19 @@ void PyScene::render()
         ui_elements_need_sort = false;
     }
 
-    // Render in sorted order with scene-level transformations
-    for (auto e: *ui_elements)
-    {
-        if (e) {
-            // Track metrics
-            game->metrics.uiElements++;
-            if (e->visible) {
-                game->metrics.visibleElements++;
-                // Count this as a draw call (each visible element = 1+ draw calls)
-                game->metrics.drawCalls++;
-            }
-
-            // #118: Apply scene-level opacity to element
-            float original_opacity = e->opacity;
-            if (opacity < 1.0f) {
-                e->opacity = original_opacity * opacity;
-            }
-
-            // #118: Render with scene position offset
-            e->render(position, game->getRenderTarget());
-
-            // #118: Restore original opacity
-            if (opacity < 1.0f) {
-                e->opacity = original_opacity;
-            }
-        }
+    // Render in sorted order with scene-level transformations (#118: scene
+    // position offset and opacity), culling what cannot show
+    if (retained) {
+        commands.render(*ui_elements, position, opacity, game->getRenderTarget());
+    } else {
+        UIDrawable::renderList(*ui_elements, position, game->getRenderTarget(), ui_batch, opacity);
     }
 
     // Display is handled by GameEngine
 }
+
+void PyScene::setRetained(bool on)
+{
+    retained = on;
+    if (!on) commands.clear();  // free the layer textures
+}
@@ -3,6 +3,8 @@
 #include "Common.h"
 #include "Scene.h"
 #include "GameEngine.h"
+#include "SpriteBatch.h"
+#include "RenderCommandList.h"
 
 class PyScene: public Scene
 {
@@ -20,6 +22,10 @@ public:
     // Dirty flag for z_index sorting optimization
     bool ui_elements_need_sort = true;
 
+    // Retained mode: replay cached layers while nothing is marked dirty
+    void setRetained(bool on);
+    bool isRetained() const { return retained; }
+
 private:
     // #363 - Shared hover walk. in_window=false makes it an exit-only sweep (no
     // drawable may become hovered), which is what a window-leave means.
@@ -28,4 +34,10 @@ private:
     // #363 - Last cursor position seen by do_mouse_hover, reported to the exit
     // callbacks fired by do_mouse_leave (MouseLeft carries no coordinates).
     sf::Vector2f last_mouse_pos{0.f, 0.f};
+
+    // Runs of top-level drawables sharing a texture, one draw each
+    SpriteBatch ui_batch;
+
+    bool retained = false;
+    RenderCommandList commands;  // compiled scene, retained mode only
 };
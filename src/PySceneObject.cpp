@@ -274,6 +274,33 @@ static int PySceneClass_set_visible(PySceneObject* self, PyObject* value, void*
     return 0;
 }
 
+// Retained mode getter
+static PyObject* PySceneClass_get_retained(PySceneObject* self, void* closure)
+{
+    if (!self->scene) {
+        Py_RETURN_FALSE;
+    }
+
+    return PyBool_FromLong(self->scene->isRetained());
+}
+
+// Retained mode setter
+static int PySceneClass_set_retained(PySceneObject* self, PyObject* value, void* closure)
+{
+    if (!self->scene) {
+        PyErr_SetString(PyExc_RuntimeError, "Scene not initialized");
+        return -1;
+    }
+
+    if (!PyBool_Check(value)) {
+        PyErr_SetString(PyExc_TypeError, "retained must be a boolean");
+        return -1;
+    }
+
+    self->scene->setRetained(PyObject_IsTrue(value));
+    return 0;
+}
+
 // #118: Scene opacity getter
 static PyObject* PySceneClass_get_opacity(PySceneObject* self, void* closure)
 {
@@ -486,6 +513,10 @@ PyGetSetDef PySceneClass::getsetters[] = {
      MCRF_PROPERTY(visible, "Scene visibility (bool). If False, scene is not rendered."), NULL},
     {"opacity", (getter)PySceneClass_get_opacity, (setter)PySceneClass_set_opacity,
      MCRF_PROPERTY(opacity, "Scene opacity (0.0-1.0). Applied to all UI elements during rendering."), NULL},
+    {"retained", (getter)PySceneClass_get_retained, (setter)PySceneClass_set_retained,
+     MCRF_PROPERTY(retained, "Retained rendering (bool, default False). Runs of children are cached as "
+         "screen-sized layers and re-blitted until one of them is changed; Grids, 3D viewports and "
+         "shaded drawables are still drawn every frame."), NULL},
     // #151: Consistent Scene API
     {"children", (getter)PySceneClass_get_children, NULL,
      MCRF_PROPERTY(children, "UI element collection for this scene (UICollection, read-only). "
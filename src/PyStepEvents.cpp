@@ -0,0 +1,85 @@
+#include "PyStepEvents.h"
+#include "McRFPy_Doc.h"
+#include <new>
+#include <sstream>
+
+static_assert(sizeof(StepEvent) == 3 * sizeof(int32_t), "StepEvent rows must be packed int32 triples");
+
+PyObject* PyStepEvents::create(std::vector<StepEvent>& events, int round)
+{
+    PyTypeObject* type = &mcrfpydef::PyStepEventsType;
+    auto* self = (PyStepEventsObject*)type->tp_alloc(type, 0);
+    if (!self) return nullptr;
+    new (&self->events) std::vector<StepEvent>();
+    self->events.swap(events);
+    self->round = round;
+    return (PyObject*)self;
+}
+
+void PyStepEvents::dealloc(PyObject* self)
+{
+    auto* obj = (PyStepEventsObject*)self;
+    obj->events.~vector();
+    Py_TYPE(self)->tp_free(self);
+}
+
+PyObject* PyStepEvents::repr(PyObject* self)
+{
+    auto* obj = (PyStepEventsObject*)self;
+    std::ostringstream ss;
+    ss << "<StepEvents round=" << obj->round << ", " << obj->events.size() << " events>";
+    std::string repr_str = ss.str();
+    return PyUnicode_DecodeUTF8(repr_str.c_str(), repr_str.size(), "replace");
+}
+
+Py_ssize_t PyStepEvents::length(PyObject* self)
+{
+    return (Py_ssize_t)((PyStepEventsObject*)self)->events.size();
+}
+
+int PyStepEvents::getbuffer(PyObject* exporter, Py_buffer* view, int flags)
+{
+    auto* self = (PyStepEventsObject*)exporter;
+    if (flags & PyBUF_WRITABLE) {
+        PyErr_SetString(PyExc_BufferError, "step events are read-only");
+        view->obj = nullptr;
+        return -1;
+    }
+    static StepEvent empty{};  // valid address for a zero-length view
+    const Py_ssize_t n = (Py_ssize_t)self->events.size();
+    view->buf = n ? self->events.data() : &empty;
+    view->len = n * (Py_ssize_t)sizeof(StepEvent);
+    view->itemsize = sizeof(int32_t);
+    view->format = (flags & PyBUF_FORMAT) ? const_cast<char*>("i") : nullptr;  // int32
+    view->ndim = 2;
+    self->shape[0] = n; self->shape[1] = 3;
+    self->strides[0] = sizeof(StepEvent); self->strides[1] = sizeof(int32_t);
+    view->obj = exporter;
+    Py_INCREF(exporter);
+    view->readonly = 1;
+    view->shape = self->shape;
+    view->strides = (flags & PyBUF_STRIDES) ? self->strides : nullptr;
+    view->suboffsets = nullptr;
+    view->internal = nullptr;
+    return 0;
+}
+
+PyObject* PyStepEvents::get_round(PyObject* self, void* closure)
+{
+    return PyLong_FromLong(((PyStepEventsObject*)self)->round);
+}
+
+PySequenceMethods PyStepEvents::sequence_methods = {
+    .sq_length = PyStepEvents::length,
+};
+
+PyBufferProcs PyStepEvents::buffer_procs = {
+    .bf_getbuffer = PyStepEvents::getbuffer,
+    .bf_releasebuffer = nullptr,
+};
+
+PyGetSetDef PyStepEvents::getsetters[] = {
+    {"round", (getter)PyStepEvents::get_round, NULL,
+     MCRF_PROPERTY(round, "Index of this round within the step() call (int, read-only)."), NULL},
+    {NULL}
+};
@@ -0,0 +1,65 @@
+#pragma once
+#include "Common.h"
+#include "Python.h"
+#include <cstdint>
+#include <vector>
+
+// One grid.step() trigger, recorded instead of calling the entity's step
+// callback. Entities are indices into grid.entities at the start of the
+// round; partner is the TARGET or BLOCKED entity, or -1.
+struct StepEvent {
+    int32_t entity;
+    int32_t trigger;   // Trigger value: 0 DONE, 1 BLOCKED, 2 TARGET
+    int32_t partner;
+};
+
+// The events of one grid.step(batch_callbacks=...) round, handed to the
+// handler. Exports a read-only (n, 3) int32 buffer (columns entity, trigger,
+// partner) so numpy can view it without copying. Not directly instantiable.
+typedef struct {
+    PyObject_HEAD
+    std::vector<StepEvent> events;
+    int round;
+    Py_ssize_t shape[2];
+    Py_ssize_t strides[2];
+} PyStepEventsObject;
+
+class PyStepEvents {
+public:
+    // New events object taking over the contents of events (left empty)
+    static PyObject* create(std::vector<StepEvent>& events, int round);
+
+    static void dealloc(PyObject* self);
+    static PyObject* repr(PyObject* self);
+    static Py_ssize_t length(PyObject* self);
+    static int getbuffer(PyObject* exporter, Py_buffer* view, int flags);
+    static PyObject* get_round(PyObject* self, void* closure);
+
+    static PySequenceMethods sequence_methods;
+    static PyBufferProcs buffer_procs;
+    static PyGetSetDef getsetters[];
+};
+
+namespace mcrfpydef {
+    inline PyTypeObject PyStepEventsType = {
+        .ob_base = {.ob_base = {.ob_refcnt = 1, .ob_type = NULL}, .ob_size = 0},
+        .tp_name = "mcrfpy._StepEvents",
+        .tp_basicsize = sizeof(PyStepEventsObject),
+        .tp_itemsize = 0,
+        .tp_dealloc = (destructor)PyStepEvents::dealloc,
+        .tp_repr = (reprfunc)PyStepEvents::repr,
+        .tp_as_sequence = &PyStepEvents::sequence_methods,
+        .tp_as_buffer = &PyStepEvents::buffer_procs,
+        .tp_flags = Py_TPFLAGS_DEFAULT,
+        .tp_doc = PyDoc_STR(
+            "Events of one grid.step(batch_callbacks=handler) round.\n\n"
+            "Exports a read-only (n, 3) int32 buffer; each row is\n"
+            "(entity, trigger, partner). entity and partner index grid.entities\n"
+            "as it was at the start of the round (partner is -1 when there is\n"
+            "none); trigger is a Trigger value. Use np.asarray(events) or\n"
+            "memoryview(events). Not directly instantiable."
+        ),
+        .tp_getset = PyStepEvents::getsetters,
+        .tp_new = NULL,  // internal only
+    };
+}
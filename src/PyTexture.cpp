@@ -83,19 +83,57 @@ sf::Sprite PyTexture::sprite(int index, sf::Vector2f pos,  sf::Vector2f s)
         return sf::Sprite();
     }
 
-    int tx = index % sheet_width, ty = index / sheet_width;
-    // #235: Apply display bounds within the cell
-    int dw = getDisplayWidth();
-    int dh = getDisplayHeight();
-    auto ir = sf::IntRect(tx * sprite_width + display_offset_x,
-                          ty * sprite_height + display_offset_y,
-                          dw, dh);
-    auto sprite = sf::Sprite(texture, ir);
+    auto sprite = sf::Sprite(texture, spriteRect(index));
     sprite.setPosition(pos);
     sprite.setScale(s);
     return sprite;
 }
 
+sf::IntRect PyTexture::spriteRect(int index) const
+{
+    if (sheet_width == 0 || sheet_height == 0) return sf::IntRect();
+
+    int tx = index % sheet_width, ty = index / sheet_width;
+    // #235: Apply display bounds within the cell
+    return sf::IntRect(tx * sprite_width + display_offset_x,
+                       ty * sprite_height + display_offset_y,
+                       getDisplayWidth(), getDisplayHeight());
+}
+
+sf::Color PyTexture::spriteAverageColor(int index) const
+{
+    int count = sheet_width * sheet_height;
+    if (index < 0 || index >= count) return sf::Color::Transparent;
+
+    if (average_colors.empty()) {
+        // One readback for the whole sheet; the texture is fixed after load
+        sf::Image img = texture.copyToImage();
+        sf::Vector2u size = img.getSize();
+        average_colors.assign(count, sf::Color::Transparent);
+        for (int i = 0; i < count; ++i) {
+            sf::IntRect r = spriteRect(i);
+            unsigned long long sum_r = 0, sum_g = 0, sum_b = 0, sum_a = 0, n = 0;
+            for (int y = std::max(0, r.top); y < std::min<int>(size.y, r.top + r.height); ++y) {
+                for (int x = std::max(0, r.left); x < std::min<int>(size.x, r.left + r.width); ++x) {
+                    sf::Color c = img.getPixel(x, y);
+                    sum_r += c.r * c.a;
+                    sum_g += c.g * c.a;
+                    sum_b += c.b * c.a;
+                    sum_a += c.a;
+                    ++n;
+                }
+            }
+            if (sum_a > 0) {
+                average_colors[i] = sf::Color(static_cast<sf::Uint8>(sum_r / sum_a),
+                                              static_cast<sf::Uint8>(sum_g / sum_a),
+                                              static_cast<sf::Uint8>(sum_b / sum_a),
+                                              static_cast<sf::Uint8>(sum_a / n));
+            }
+        }
+    }
+    return average_colors[index];
+}
+
 PyObject* PyTexture::pyObject()
 {
     PyTypeObject* type = &mcrfpydef::PyTextureType;
@@ -15,6 +15,7 @@ private:
     sf::Texture texture;
     std::string source;
     int sheet_width, sheet_height;
+    mutable std::vector<sf::Color> average_colors;  // Per sprite, filled on first spriteAverageColor()
 
     // Private default constructor for factory methods
     PyTexture() : source("<uninitialized>"), sprite_width(0), sprite_height(0), sheet_width(0), sheet_height(0),
@@ -35,7 +36,13 @@ public:
         const sf::Image& img, int sprite_w, int sprite_h,
         const std::string& name = "<generated>");
     sf::Sprite sprite(int index, sf::Vector2f pos = sf::Vector2f(0, 0), sf::Vector2f s = sf::Vector2f(1.0, 1.0));
+    // Source rect of sprite `index` (display bounds applied), as sprite() uses.
+    // Empty if the texture failed to load.
+    sf::IntRect spriteRect(int index) const;
     int getSpriteCount() const { return sheet_width * sheet_height; }
+    // Mean color of sprite `index` (RGB weighted by alpha), for views too far
+    // out to show the sprite itself. Transparent if out of range.
+    sf::Color spriteAverageColor(int index) const;
 
     // Get the underlying sf::Texture for 3D rendering
     const sf::Texture* getSFMLTexture() const { return &texture; }
@@ -114,7 +114,7 @@ int PyTimer::init(PyTimerObject* self, PyObject* args, PyObject* kwds) {
         if (it != Resources::game->timers.end() && it->second != self->data) {
             it->second->stop();
         }
-        Resources::game->timers[self->name] = self->data;
+        Resources::game->timers.add(self->name, self->data);
         // Prevent Python GC while timer is active (#251)
         self->data->retainPyWrapper((PyObject*)self);
     }
@@ -159,7 +159,7 @@ PyObject* PyTimer::start(PyTimerObject* self, PyObject* Py_UNUSED(ignored)) {
         }
 
         // Add to engine map
-        Resources::game->timers[self->name] = self->data;
+        Resources::game->timers.add(self->name, self->data);
     }
 
     self->data->start(current_time);
@@ -174,10 +174,10 @@ PyObject* PyTimer::stop(PyTimerObject* self, PyObject* Py_UNUSED(ignored)) {
         return nullptr;
     }
 
-    // Just mark as stopped - do NOT erase from map here!
-    // Removing from the map during iteration (e.g., from a timer callback)
-    // would invalidate iterators in testTimers(). The stopped flag tells
-    // testTimers() to safely remove this timer on its next pass.
+    // Just mark as stopped - do NOT erase from the map here!
+    // This may run inside another timer's callback while the scheduler is
+    // firing; Timer::stop() retires the name and the scheduler removes it
+    // at the end of its pass.
     self->data->stop();
     // NOTE: We do NOT reset self->data here - the timer can be restarted
     Py_RETURN_NONE;
@@ -227,11 +227,11 @@ PyObject* PyTimer::restart(PyTimerObject* self, PyObject* Py_UNUSED(ignored)) {
         auto it = Resources::game->timers.find(self->name);
         if (it == Resources::game->timers.end()) {
             // Timer was stopped, re-add it
-            Resources::game->timers[self->name] = self->data;
+            Resources::game->timers.add(self->name, self->data);
         } else if (it->second != self->data) {
             // Another timer has this name, stop it and replace
             it->second->stop();
-            Resources::game->timers[self->name] = self->data;
+            Resources::game->timers.add(self->name, self->data);
         }
     }
 
@@ -333,7 +333,7 @@ int PyTimer::set_active(PyTimerObject* self, PyObject* value, void* closure) {
                 if (it != Resources::game->timers.end() && it->second != self->data) {
                     it->second->stop();
                 }
-                Resources::game->timers[self->name] = self->data;
+                Resources::game->timers.add(self->name, self->data);
             }
             self->data->start(current_time);
             // Prevent Python GC while timer is active (#251)
@@ -1,9 +1,30 @@
 #include "PyTrigger.h"
 #include <sstream>
+#include <unordered_map>
 
 // Static storage for cached enum class reference
 PyObject* PyTrigger::trigger_enum_class = nullptr;
 
+// #344 - memoized enum members (value -> strong ref to Trigger member).
+static std::unordered_map<int, PyObject*> trigger_member_cache;
+
+PyObject* PyTrigger::get_enum_member(int value) {
+    if (!trigger_enum_class) {
+        PyErr_SetString(PyExc_RuntimeError, "Trigger enum class not initialized");
+        return nullptr;
+    }
+    auto it = trigger_member_cache.find(value);
+    if (it != trigger_member_cache.end()) {
+        Py_INCREF(it->second);
+        return it->second;
+    }
+    PyObject* member = PyObject_CallFunction(trigger_enum_class, "i", value);
+    if (!member) return nullptr;
+    Py_INCREF(member);                          // strong ref held by the cache
+    trigger_member_cache[value] = member;
+    return member;                              // caller owns the other ref
+}
+
 struct TriggerEntry {
     const char* name;
     int value;
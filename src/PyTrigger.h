@@ -16,6 +16,11 @@ public:
     // Cached reference to the Trigger enum class for fast type checking
     static PyObject* trigger_enum_class;
 
+    // Return the Trigger member for an integer value as a NEW reference.
+    // Members are memoized (#344 pattern) so step callbacks avoid
+    // EnumMeta.__call__. Returns nullptr with an exception set on failure.
+    static PyObject* get_enum_member(int value);
+
     // Number of trigger types
     static const int NUM_TRIGGERS = 3;
 };
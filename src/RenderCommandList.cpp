@@ -0,0 +1,142 @@
+#include "RenderCommandList.h"
+#include "UIDrawable.h"
+#include "GameEngine.h"
+
+bool RenderCommandList::unchanged(const std::vector<std::shared_ptr<UIDrawable>>& drawables,
+                                  sf::Vector2f offset, float opacity,
+                                  const sf::RenderTarget& target) const
+{
+    if (drawables.size() != members.size() || offset != compiled_offset ||
+        opacity != compiled_opacity || target.getSize() != compiled_size ||
+        target.getView().getCenter() != compiled_view_center ||
+        target.getView().getSize() != compiled_view_size) {
+        return false;
+    }
+    for (size_t i = 0; i < drawables.size(); ++i) {
+        const UIDrawable* d = drawables[i].get();
+        if (d != members[i] || (d && d->revision != revisions[i])) return false;
+    }
+    return true;
+}
+
+void RenderCommandList::compile(const std::vector<std::shared_ptr<UIDrawable>>& drawables,
+                                sf::Vector2f offset, float opacity, sf::RenderTarget& target)
+{
+    // Old layers can be reused only if everything but the list is as it was
+    bool same_frame = offset == compiled_offset && opacity == compiled_opacity &&
+                      target.getSize() == compiled_size &&
+                      target.getView().getCenter() == compiled_view_center &&
+                      target.getView().getSize() == compiled_view_size;
+
+    std::vector<Command> compiled;
+    size_t layers = 0;
+    for (size_t i = 0; i < drawables.size(); ++i) {
+        const UIDrawable* d = drawables[i].get();
+        bool live = d && (!d->retainable() || layers >= MAX_LAYERS);
+        if (!compiled.empty() && compiled.back().live == live) {
+            ++compiled.back().count;
+            continue;
+        }
+        Command cmd;
+        cmd.first = i;
+        cmd.count = 1;
+        cmd.live = live;
+        if (!live) ++layers;
+        compiled.push_back(std::move(cmd));
+    }
+
+    // Carry over rasters of layers whose members and revisions are unchanged
+    for (auto& cmd : compiled) {
+        if (cmd.live || !same_frame) continue;
+        for (auto& old : commands) {
+            if (old.live || !old.raster || old.count != cmd.count) continue;
+            bool same = true;
+            for (size_t k = 0; k < cmd.count && same; ++k) {
+                const UIDrawable* d = drawables[cmd.first + k].get();
+                same = d == members[old.first + k] &&
+                       (!d || d->revision == revisions[old.first + k]);
+            }
+            if (same) {
+                cmd.raster = std::move(old.raster);
+                break;
+            }
+        }
+    }
+
+    commands = std::move(compiled);
+    members.resize(drawables.size());
+    revisions.resize(drawables.size());
+    for (size_t i = 0; i < drawables.size(); ++i) {
+        members[i] = drawables[i].get();
+        revisions[i] = drawables[i] ? drawables[i]->revision : 0;
+    }
+    compiled_offset = offset;
+    compiled_opacity = opacity;
+    compiled_size = target.getSize();
+    compiled_view_center = target.getView().getCenter();
+    compiled_view_size = target.getView().getSize();
+
+    // Rasterize the layers that could not be carried over
+    auto& metrics = Resources::game->metrics;
+    for (auto& cmd : commands) {
+        if (cmd.live || cmd.raster) continue;
+        cmd.raster = std::make_unique<sf::RenderTexture>();
+        if (!cmd.raster->create(compiled_size.x, compiled_size.y)) {
+            cmd.raster.reset();
+            cmd.live = true;  // no texture: draw it live instead
+            continue;
+        }
+        cmd.raster->clear(sf::Color::Transparent);
+        cmd.raster->setView(target.getView());
+        UIDrawable::renderList(drawables.data() + cmd.first, cmd.count, offset,
+                               *cmd.raster, batch, opacity);
+        cmd.raster->display();
+        ++metrics.retainedRebuilds;
+    }
+}
+
+void RenderCommandList::render(const std::vector<std::shared_ptr<UIDrawable>>& drawables,
+                               sf::Vector2f offset, float opacity, sf::RenderTarget& target)
+{
+    if (!unchanged(drawables, offset, opacity, target)) {
+        compile(drawables, offset, opacity, target);
+    }
+
+    auto& metrics = Resources::game->metrics;
+    for (const auto& cmd : commands) {
+        if (cmd.live) {
+            UIDrawable::renderList(drawables.data() + cmd.first, cmd.count, offset,
+                                   target, batch, opacity);
+            continue;
+        }
+
+        // The raster is in target pixels: blit it through the default view
+        sf::Sprite layer(cmd.raster->getTexture());
+        sf::View view = target.getView();
+        target.setView(target.getDefaultView());
+#if !defined(MCRF_HEADLESS) && !defined(MCRF_SDL2)
+        target.draw(layer, sf::BlendMode(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha));
+#else
+        target.draw(layer);
+#endif
+        target.setView(view);
+        ++metrics.drawCalls;
+        ++metrics.retainedBlits;
+    }
+}
+
+void RenderCommandList::clear()
+{
+    commands.clear();
+    members.clear();
+    revisions.clear();
+}
+
+size_t RenderCommandList::layerCount() const
+{
+    size_t n = 0;
+    for (const auto& cmd : commands) {
+        if (!cmd.live) ++n;
+    }
+    return n;
+}
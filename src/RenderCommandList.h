@@ -0,0 +1,59 @@
+#pragma once
+// RenderCommandList.h - Retained-mode rendering for a scene's drawable list.
+//
+// The list is compiled into commands: runs of consecutive retainable
+// drawables become layers, each rasterized once into a target-sized texture,
+// and everything else (grids, 3D viewports, shaded drawables) is drawn live.
+// A frame in which no drawable's revision changed replays the commands: one
+// blit per layer plus the live drawables, without walking the layers'
+// subtrees. When something changed, the list is recompiled and only layers
+// whose members or revisions differ are rasterized again.
+//
+// Layers hold premultiplied color (what alpha blending into a transparent
+// texture produces) and are blitted with a matching blend, so a replayed
+// frame matches an immediate-mode one.
+
+#include "Common.h"
+#include "SpriteBatch.h"
+#include <memory>
+#include <vector>
+
+class UIDrawable;
+
+class RenderCommandList {
+public:
+    // Draw drawables at offset with the scene's opacity into target
+    void render(const std::vector<std::shared_ptr<UIDrawable>>& drawables,
+                sf::Vector2f offset, float opacity, sf::RenderTarget& target);
+
+    // Drop the compiled commands and their textures
+    void clear();
+
+    size_t layerCount() const;
+
+    static constexpr size_t MAX_LAYERS = 4;  // full-target textures per scene
+
+private:
+    struct Command {
+        size_t first = 0;  // range in the drawable list
+        size_t count = 0;
+        bool live = false;
+        std::unique_ptr<sf::RenderTexture> raster;  // layers only
+    };
+
+    // Compiled-from inputs; any difference means recompiling
+    bool unchanged(const std::vector<std::shared_ptr<UIDrawable>>& drawables,
+                   sf::Vector2f offset, float opacity, const sf::RenderTarget& target) const;
+    void compile(const std::vector<std::shared_ptr<UIDrawable>>& drawables,
+                 sf::Vector2f offset, float opacity, sf::RenderTarget& target);
+
+    std::vector<Command> commands;
+    std::vector<const UIDrawable*> members;  // the list as compiled
+    std::vector<uint32_t> revisions;         // each member's revision then
+    sf::Vector2f compiled_offset;
+    float compiled_opacity = 1.0f;
+    sf::Vector2u compiled_size;
+    sf::Vector2f compiled_view_center;
+    sf::Vector2f compiled_view_size;
+    SpriteBatch batch;
+};
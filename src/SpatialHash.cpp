@@ -4,177 +4,231 @@
 
 SpatialHash::SpatialHash(int bucket_size)
     : bucket_size(bucket_size)
+    , buckets(1)
+    , draw_buckets(1)
 {
 }
 
-void SpatialHash::insert(std::shared_ptr<UIEntity> entity)
+SpatialHash::~SpatialHash()
 {
-    if (!entity) return;
-
-    auto bucket_coord = getBucket(entity->position.x, entity->position.y);
-    buckets[bucket_coord].push_back(entity);
+    clear();
 }
 
-void SpatialHash::remove(std::shared_ptr<UIEntity> entity)
+void SpatialHash::resize(int grid_w, int grid_h)
 {
-    if (!entity) return;
+    int bw = std::max(1, (grid_w + bucket_size - 1) / bucket_size);
+    int bh = std::max(1, (grid_h + bucket_size - 1) / bucket_size);
+    int dw = std::max(1, (grid_w + DRAW_BUCKET_SIZE - 1) / DRAW_BUCKET_SIZE);
+    int dh = std::max(1, (grid_h + DRAW_BUCKET_SIZE - 1) / DRAW_BUCKET_SIZE);
+    if (bw == buckets_w && bh == buckets_h && dw == draw_buckets_w && dh == draw_buckets_h) return;
+
+    std::vector<UIEntity*> all;
+    all.reserve(entity_count);
+    for (auto& bucket : buckets) {
+        all.insert(all.end(), bucket.begin(), bucket.end());
+    }
 
-    auto bucket_coord = getBucket(entity->position.x, entity->position.y);
-    auto it = buckets.find(bucket_coord);
-    if (it == buckets.end()) return;
-
-    auto& bucket = it->second;
-
-    // Remove the entity from the bucket
-    bucket.erase(
-        std::remove_if(bucket.begin(), bucket.end(),
-            [&entity](const std::weak_ptr<UIEntity>& wp) {
-                auto sp = wp.lock();
-                return !sp || sp == entity;
-            }),
-        bucket.end()
-    );
-
-    // Remove empty buckets to save memory
-    if (bucket.empty()) {
-        buckets.erase(it);
+    buckets_w = bw;
+    buckets_h = bh;
+    buckets.assign(static_cast<size_t>(bw) * bh, {});
+    draw_buckets_w = dw;
+    draw_buckets_h = dh;
+    draw_buckets.assign(static_cast<size_t>(dw) * dh, {});
+    occupancy_generation++;
+    for (UIEntity* e : all) {
+        place(e, bucketIndex(e->position.x, e->position.y));
+        placeDraw(e);
     }
 }
 
-void SpatialHash::update(std::shared_ptr<UIEntity> entity, float old_x, float old_y)
+void SpatialHash::place(UIEntity* entity, int bucket)
 {
-    if (!entity) return;
+    auto& b = buckets[bucket];
+    entity->spatial_owner = this;
+    entity->spatial_bucket = bucket;
+    entity->spatial_slot = static_cast<uint32_t>(b.size());
+    b.push_back(entity);
+}
 
-    auto old_bucket = getBucket(old_x, old_y);
-    auto new_bucket = getBucket(entity->position.x, entity->position.y);
-
-    // Only update if bucket changed
-    if (old_bucket == new_bucket) return;
-
-    // Remove from old bucket
-    auto it = buckets.find(old_bucket);
-    if (it != buckets.end()) {
-        auto& bucket = it->second;
-        bucket.erase(
-            std::remove_if(bucket.begin(), bucket.end(),
-                [&entity](const std::weak_ptr<UIEntity>& wp) {
-                    auto sp = wp.lock();
-                    return !sp || sp == entity;
-                }),
-            bucket.end()
-        );
-        if (bucket.empty()) {
-            buckets.erase(it);
-        }
-    }
+void SpatialHash::unplace(UIEntity* entity)
+{
+    // O(1) swap-remove: the last entity in the bucket takes this slot.
+    auto& b = buckets[entity->spatial_bucket];
+    uint32_t slot = entity->spatial_slot;
+    UIEntity* last = b.back();
+    b[slot] = last;
+    last->spatial_slot = slot;
+    b.pop_back();
+    entity->spatial_owner = nullptr;
+    entity->spatial_bucket = -1;
+}
+
+void SpatialHash::moveTo(UIEntity* entity, int bucket)
+{
+    if (entity->spatial_owner != this) return;  // not inserted here
+    moveDraw(entity);
+    if (entity->spatial_bucket == bucket) return;
+    unplace(entity);
+    place(entity, bucket);
+}
+
+void SpatialHash::placeDraw(UIEntity* entity)
+{
+    int bucket = drawBucketIndex(entity->position.x, entity->position.y);
+    auto& b = draw_buckets[bucket];
+    entity->draw_bucket = bucket;
+    entity->draw_slot = static_cast<uint32_t>(b.size());
+    b.push_back(entity);
+}
+
+void SpatialHash::unplaceDraw(UIEntity* entity)
+{
+    auto& b = draw_buckets[entity->draw_bucket];
+    uint32_t slot = entity->draw_slot;
+    UIEntity* last = b.back();
+    b[slot] = last;
+    last->draw_slot = slot;
+    b.pop_back();
+    entity->draw_bucket = -1;
+}
 
-    // Add to new bucket
-    buckets[new_bucket].push_back(entity);
+void SpatialHash::moveDraw(UIEntity* entity)
+{
+    if (entity->draw_bucket == drawBucketIndex(entity->position.x, entity->position.y)) return;
+    unplaceDraw(entity);
+    placeDraw(entity);
 }
 
-void SpatialHash::updateCell(std::shared_ptr<UIEntity> entity, int old_x, int old_y)
+void SpatialHash::insert(std::shared_ptr<UIEntity> entity)
 {
     if (!entity) return;
+    occupancy_generation++;
 
-    auto old_bucket = getBucket(static_cast<float>(old_x), static_cast<float>(old_y));
-    auto new_bucket = getBucket(static_cast<float>(entity->cell_position.x),
-                                 static_cast<float>(entity->cell_position.y));
-
-    if (old_bucket == new_bucket) return;
-
-    // Remove from old bucket
-    auto it = buckets.find(old_bucket);
-    if (it != buckets.end()) {
-        auto& bucket = it->second;
-        bucket.erase(
-            std::remove_if(bucket.begin(), bucket.end(),
-                [&entity](const std::weak_ptr<UIEntity>& wp) {
-                    auto sp = wp.lock();
-                    return !sp || sp == entity;
-                }),
-            bucket.end()
-        );
-        if (bucket.empty()) {
-            buckets.erase(it);
-        }
+    int bucket = bucketIndex(entity->position.x, entity->position.y);
+    if (entity->spatial_owner == this) {
+        moveTo(entity.get(), bucket);
+        return;
     }
+    // An entity lives in one grid at a time.
+    if (entity->spatial_owner) entity->spatial_owner->remove(entity.get());
+    place(entity.get(), bucket);
+    placeDraw(entity.get());
+    entity_count++;
+}
 
-    // Add to new bucket
-    buckets[new_bucket].push_back(entity);
+void SpatialHash::remove(std::shared_ptr<UIEntity> entity)
+{
+    remove(entity.get());
 }
 
-std::vector<std::shared_ptr<UIEntity>> SpatialHash::queryCell(int x, int y) const
+void SpatialHash::remove(UIEntity* entity)
 {
-    std::vector<std::shared_ptr<UIEntity>> result;
+    if (!entity) return;
+    occupancy_generation++;
+    if (entity->spatial_owner != this) return;
+    unplace(entity);
+    unplaceDraw(entity);
+    entity_count--;
+}
 
-    auto bucket_coord = getBucket(static_cast<float>(x), static_cast<float>(y));
-    auto it = buckets.find(bucket_coord);
-    if (it == buckets.end()) return result;
+void SpatialHash::update(std::shared_ptr<UIEntity> entity, float /*old_x*/, float /*old_y*/)
+{
+    if (!entity) return;
+    occupancy_generation++;
+    moveTo(entity.get(), bucketIndex(entity->position.x, entity->position.y));
+}
 
-    for (const auto& wp : it->second) {
-        auto entity = wp.lock();
-        if (!entity) continue;
+void SpatialHash::updateCell(std::shared_ptr<UIEntity> entity, int /*old_x*/, int /*old_y*/)
+{
+    if (!entity) return;
+    occupancy_generation++;
+    moveTo(entity.get(), bucketIndex(static_cast<float>(entity->cell_position.x),
+                                     static_cast<float>(entity->cell_position.y)));
+}
 
+void SpatialHash::forEachInCell(int x, int y, const Visitor& visit) const
+{
+    const auto& bucket = buckets[bucketIndex(static_cast<float>(x), static_cast<float>(y))];
+    for (UIEntity* entity : bucket) {
         // #236: Match on cell_position footprint for multi-tile entities
         if (x >= entity->cell_position.x &&
             x < entity->cell_position.x + entity->tile_width &&
             y >= entity->cell_position.y &&
             y < entity->cell_position.y + entity->tile_height) {
-            result.push_back(entity);
+            if (!visit(*entity)) return;
         }
     }
-
-    return result;
 }
 
-std::vector<std::pair<int, int>> SpatialHash::getBucketsInRadius(float x, float y, float radius) const
+void SpatialHash::forEachInRadius(float x, float y, float radius, const Visitor& visit) const
 {
-    std::vector<std::pair<int, int>> result;
+    float radius_sq = radius * radius;
 
-    // Get bounding box in bucket coordinates
-    int min_bx = static_cast<int>(std::floor((x - radius) / bucket_size));
-    int max_bx = static_cast<int>(std::floor((x + radius) / bucket_size));
-    int min_by = static_cast<int>(std::floor((y - radius) / bucket_size));
-    int max_by = static_cast<int>(std::floor((y + radius) / bucket_size));
+    // Bounding box in bucket coordinates, clamped like entity placement
+    int min_bx = bucketAxis(x - radius, buckets_w);
+    int max_bx = bucketAxis(x + radius, buckets_w);
+    int min_by = bucketAxis(y - radius, buckets_h);
+    int max_by = bucketAxis(y + radius, buckets_h);
+
+    for (int by = min_by; by <= max_by; ++by) {
+        const auto* row = &buckets[static_cast<size_t>(by) * buckets_w];
+        for (int bx = min_bx; bx <= max_bx; ++bx) {
+            for (UIEntity* entity : row[bx]) {
+                // Check if entity is actually within the circular radius
+                float dx = entity->position.x - x;
+                float dy = entity->position.y - y;
+                if (dx * dx + dy * dy <= radius_sq) {
+                    if (!visit(*entity)) return;
+                }
+            }
+        }
+    }
+}
 
-    // Iterate all buckets in the bounding box
-    for (int bx = min_bx; bx <= max_bx; ++bx) {
-        for (int by = min_by; by <= max_by; ++by) {
-            result.emplace_back(bx, by);
+void SpatialHash::forEachInDrawRect(float x0, float y0, float x1, float y1, const Visitor& visit) const
+{
+    int min_bx = bucketAxis(x0, DRAW_BUCKET_SIZE, draw_buckets_w);
+    int max_bx = bucketAxis(x1, DRAW_BUCKET_SIZE, draw_buckets_w);
+    int min_by = bucketAxis(y0, DRAW_BUCKET_SIZE, draw_buckets_h);
+    int max_by = bucketAxis(y1, DRAW_BUCKET_SIZE, draw_buckets_h);
+
+    for (int by = min_by; by <= max_by; ++by) {
+        const auto* row = &draw_buckets[static_cast<size_t>(by) * draw_buckets_w];
+        for (int bx = min_bx; bx <= max_bx; ++bx) {
+            for (UIEntity* entity : row[bx]) {
+                if (!visit(*entity)) return;
+            }
         }
     }
+}
 
+std::vector<std::shared_ptr<UIEntity>> SpatialHash::queryCell(int x, int y) const
+{
+    std::vector<std::shared_ptr<UIEntity>> result;
+    forEachInCell(x, y, [&](UIEntity& e) { result.push_back(e.shared_from_this()); });
     return result;
 }
 
 std::vector<std::shared_ptr<UIEntity>> SpatialHash::queryRadius(float x, float y, float radius) const
 {
     std::vector<std::shared_ptr<UIEntity>> result;
-    float radius_sq = radius * radius;
-
-    auto bucket_coords = getBucketsInRadius(x, y, radius);
-
-    for (const auto& coord : bucket_coords) {
-        auto it = buckets.find(coord);
-        if (it == buckets.end()) continue;
-
-        for (const auto& wp : it->second) {
-            auto entity = wp.lock();
-            if (!entity) continue;
-
-            // Check if entity is actually within the circular radius
-            float dx = entity->position.x - x;
-            float dy = entity->position.y - y;
-            if (dx * dx + dy * dy <= radius_sq) {
-                result.push_back(entity);
-            }
-        }
-    }
-
+    forEachInRadius(x, y, radius, [&](UIEntity& e) { result.push_back(e.shared_from_this()); });
     return result;
 }
 
 void SpatialHash::clear()
 {
-    buckets.clear();
+    occupancy_generation++;
+    for (auto& bucket : buckets) {
+        for (UIEntity* entity : bucket) {
+            entity->spatial_owner = nullptr;
+            entity->spatial_bucket = -1;
+        }
+        bucket.clear();
+    }
+    for (auto& bucket : draw_buckets) {
+        for (UIEntity* entity : bucket) entity->draw_bucket = -1;
+        bucket.clear();
+    }
+    entity_count = 0;
 }
@@ -1,42 +1,101 @@
 #pragma once
-#include <unordered_map>
 #include <vector>
 #include <memory>
 #include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
 
 class UIEntity;
 
 /**
- * SpatialHash - O(1) average spatial queries for entities (#115)
+ * SpatialHash - O(1) spatial queries for entities (#115)
  *
  * Divides the grid into buckets and tracks which entities are in each bucket.
  * Queries only check entities in nearby buckets instead of all entities.
  *
+ * Buckets are a dense row-major array sized from the grid dimensions
+ * (resize()), holding raw entity pointers. Each entity records its own bucket
+ * and slot (UIEntity::spatial_*), so remove and re-bucket are O(1)
+ * swap-removes. Positions outside the grid clamp into the edge buckets, and
+ * query ranges clamp the same way, so off-grid entities are still found.
+ *
+ * The buckets above follow whichever coordinate last moved an entity
+ * (update() uses the draw position, updateCell() the logical cell). A second,
+ * finer set of draw buckets is keyed only on the draw position (`position`)
+ * and kept current by the same calls; renderers use forEachInDrawRect() to
+ * cull to the viewport without visiting every entity.
+ *
  * Performance characteristics:
- * - Insert: O(1)
- * - Remove: O(n) where n = entities in bucket (typically small)
- * - Update position: O(n) where n = entities in bucket
+ * - Insert / Remove / Update: O(1)
  * - Query radius: O(k) where k = entities in checked buckets (vs O(N) for all entities)
+ * - forEachInRadius / forEachInCell allocate nothing; queryRadius / queryCell
+ *   build a shared_ptr vector for callers that need to keep the results.
  */
 class SpatialHash {
 public:
+    // Non-owning reference to a callable taking UIEntity&. The callable may
+    // return bool: false stops the query early. Never stored, so a lambda
+    // temporary at the call site is fine.
+    class Visitor {
+    public:
+        template <typename F,
+                  typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Visitor>>>
+        Visitor(F&& fn)
+            : target(const_cast<void*>(static_cast<const void*>(std::addressof(fn))))
+            , invoke([](void* t, UIEntity& e) -> bool {
+                  auto& f = *static_cast<std::remove_reference_t<F>*>(t);
+                  if constexpr (std::is_void_v<decltype(f(e))>) {
+                      f(e);
+                      return true;
+                  } else {
+                      return static_cast<bool>(f(e));
+                  }
+              }) {}
+        bool operator()(UIEntity& e) const { return invoke(target, e); }
+
+    private:
+        void* target;
+        bool (*invoke)(void*, UIEntity&);
+    };
+
     // Default bucket size of 32 cells balances memory and query performance
     explicit SpatialHash(int bucket_size = 32);
+    ~SpatialHash();
+
+    SpatialHash(const SpatialHash&) = delete;
+    SpatialHash& operator=(const SpatialHash&) = delete;
+
+    // Size the bucket array for a grid_w x grid_h grid (GridData::initStorage).
+    // Entities already inserted are re-bucketed.
+    void resize(int grid_w, int grid_h);
 
     // Insert entity into spatial hash based on current position
     void insert(std::shared_ptr<UIEntity> entity);
 
     // Remove entity from spatial hash
     void remove(std::shared_ptr<UIEntity> entity);
+    void remove(UIEntity* entity);
 
-    // Update entity position - call when entity moves
-    // This removes from old bucket and inserts into new bucket if needed
+    // Update entity position - call when entity moves. The old coordinates
+    // are no longer needed (the entity remembers its bucket); kept for API
+    // compatibility.
     void update(std::shared_ptr<UIEntity> entity, float old_x, float old_y);
 
     // Update entity position using integer cell coordinates (#295)
-    // Removes from old bucket and inserts into new based on cell_position
+    // Re-buckets based on cell_position
     void updateCell(std::shared_ptr<UIEntity> entity, int old_x, int old_y);
 
+    // Visit all entities at a specific cell (uses cell_position footprint)
+    void forEachInCell(int x, int y, const Visitor& visit) const;
+
+    // Visit all entities whose positions are within the circular radius
+    void forEachInRadius(float x, float y, float radius, const Visitor& visit) const;
+
+    // Visit entities whose draw buckets overlap [x0, x1) x [y0, y1) (tile
+    // coordinates). Candidates only: callers test the exact position.
+    void forEachInDrawRect(float x0, float y0, float x1, float y1, const Visitor& visit) const;
+
     // Query all entities at a specific cell (uses cell_position for matching)
     // O(n) where n = entities in the bucket containing this cell
     std::vector<std::shared_ptr<UIEntity>> queryCell(int x, int y) const;
@@ -50,30 +109,50 @@ public:
 
     // Get statistics for debugging
     size_t bucketCount() const { return buckets.size(); }
+    size_t size() const { return entity_count; }
+
+    // Bumped by every insert/remove/update, whether or not the bucket changed.
+    // Lets caches built from entity positions (e.g. collide-label Dijkstra
+    // maps) detect that any entity may have moved.
+    uint32_t generation() const { return occupancy_generation; }
+
+    // Draw buckets are smaller than logical ones: a viewport query wants few
+    // off-screen candidates, while radius queries favour fewer buckets.
+    static constexpr int DRAW_BUCKET_SIZE = 8;
 
 private:
     int bucket_size;
+    int buckets_w = 1;
+    int buckets_h = 1;
+    int draw_buckets_w = 1;
+    int draw_buckets_h = 1;
+    size_t entity_count = 0;
+    uint32_t occupancy_generation = 0;
 
-    // Hash function for bucket coordinates
-    struct PairHash {
-        size_t operator()(const std::pair<int, int>& p) const {
-            // Combine hash of both coordinates
-            return std::hash<int>()(p.first) ^ (std::hash<int>()(p.second) << 16);
-        }
-    };
-
-    // Map from bucket coordinates to list of entities in that bucket
-    // Using weak_ptr to avoid preventing entity deletion
-    std::unordered_map<std::pair<int, int>, std::vector<std::weak_ptr<UIEntity>>, PairHash> buckets;
+    // buckets[by * buckets_w + bx]; never empty (at least 1x1)
+    std::vector<std::vector<UIEntity*>> buckets;
+    // draw_buckets[by * draw_buckets_w + bx], keyed on UIEntity::position
+    std::vector<std::vector<UIEntity*>> draw_buckets;
 
-    // Get bucket coordinates for a world position
-    std::pair<int, int> getBucket(float x, float y) const {
-        return {
-            static_cast<int>(std::floor(x / bucket_size)),
-            static_cast<int>(std::floor(y / bucket_size))
-        };
+    // Clamped in float so far-off (or NaN) positions cannot overflow the cast.
+    static int bucketAxis(float v, int size, int count) {
+        float b = std::floor(v / size);
+        if (!(b > 0.0f)) return 0;
+        return b >= static_cast<float>(count) ? count - 1 : static_cast<int>(b);
+    }
+    int bucketAxis(float v, int count) const { return bucketAxis(v, bucket_size, count); }
+    int bucketIndex(float x, float y) const {
+        return bucketAxis(y, buckets_h) * buckets_w + bucketAxis(x, buckets_w);
+    }
+    int drawBucketIndex(float x, float y) const {
+        return bucketAxis(y, DRAW_BUCKET_SIZE, draw_buckets_h) * draw_buckets_w +
+               bucketAxis(x, DRAW_BUCKET_SIZE, draw_buckets_w);
     }
 
-    // Get all bucket coordinates that overlap with a radius query
-    std::vector<std::pair<int, int>> getBucketsInRadius(float x, float y, float radius) const;
+    void place(UIEntity* entity, int bucket);
+    void unplace(UIEntity* entity);
+    void moveTo(UIEntity* entity, int bucket);
+    void placeDraw(UIEntity* entity);
+    void unplaceDraw(UIEntity* entity);
+    void moveDraw(UIEntity* entity);
 };
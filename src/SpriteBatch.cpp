@@ -0,0 +1,58 @@
+#include "SpriteBatch.h"
+
+void SpriteBatch::begin(sf::RenderTarget& t, const sf::RenderStates& states)
+{
+    target = &t;
+    base_states = states;
+    texture = nullptr;
+    vertices.clear();
+    draw_calls = 0;
+    quads = 0;
+}
+
+void SpriteBatch::add(const sf::Texture* tex, const sf::Transform& transform,
+                      const sf::FloatRect& local_rect, const sf::IntRect& tex_rect, sf::Color color)
+{
+    if (!target || !tex) return;
+    if (tex != texture) {
+        flush();
+        texture = tex;
+    }
+
+    float l = local_rect.left, t = local_rect.top;
+    float r = l + local_rect.width, b = t + local_rect.height;
+    float u0 = static_cast<float>(tex_rect.left), v0 = static_cast<float>(tex_rect.top);
+    float u1 = u0 + tex_rect.width, v1 = v0 + tex_rect.height;
+
+    vertices.push_back(sf::Vertex(transform.transformPoint(l, t), color, sf::Vector2f(u0, v0)));
+    vertices.push_back(sf::Vertex(transform.transformPoint(r, t), color, sf::Vector2f(u1, v0)));
+    vertices.push_back(sf::Vertex(transform.transformPoint(r, b), color, sf::Vector2f(u1, v1)));
+    vertices.push_back(sf::Vertex(transform.transformPoint(l, b), color, sf::Vector2f(u0, v1)));
+    ++quads;
+}
+
+void SpriteBatch::addQuads(const sf::Texture* tex, const sf::Transform& transform,
+                           const sf::Vertex* local, size_t vertex_count, sf::Color color)
+{
+    if (!target || !tex || vertex_count == 0) return;
+    if (tex != texture) {
+        flush();
+        texture = tex;
+    }
+
+    for (size_t i = 0; i < vertex_count; ++i) {
+        vertices.push_back(sf::Vertex(transform.transformPoint(local[i].position), color,
+                                      local[i].texCoords));
+    }
+    quads += vertex_count / 4;
+}
+
+void SpriteBatch::flush()
+{
+    if (!target || vertices.empty()) return;
+    sf::RenderStates states = base_states;
+    states.texture = texture;
+    target->draw(vertices.data(), vertices.size(), sf::Quads, states);
+    vertices.clear();
+    ++draw_calls;
+}
@@ -0,0 +1,46 @@
+#pragma once
+// SpriteBatch.h - Accumulates textured quads and draws each run that shares
+// a texture with one draw call.
+//
+// Quads are drawn in the order they were added. A texture change flushes the
+// pending run first, so overlapping sprites from different atlases keep their
+// relative order; the common case of one atlas per grid is a single draw.
+// Opacity and tint travel in the vertex color, so sprites that differ only in
+// those still batch. Caption glyph runs are queued the same way, one run per
+// font page. The vertex buffer is kept between frames.
+
+#include "Common.h"
+#include <vector>
+
+class SpriteBatch {
+public:
+    // Start a batch drawing into target with the given base states (its
+    // texture is replaced per run). Discards anything not yet flushed.
+    void begin(sf::RenderTarget& target, const sf::RenderStates& states = sf::RenderStates::Default);
+
+    // Queue one quad: local_rect (sprite-local pixels) mapped through
+    // transform, sampling tex_rect from texture, tinted by color.
+    void add(const sf::Texture* texture, const sf::Transform& transform,
+             const sf::FloatRect& local_rect, const sf::IntRect& tex_rect, sf::Color color);
+
+    // Queue quads already laid out in local space (4 vertices each, in
+    // sf::Quads order) mapped through transform and recolored to color.
+    // Texture coordinates are used as given.
+    void addQuads(const sf::Texture* texture, const sf::Transform& transform,
+                  const sf::Vertex* quads, size_t vertex_count, sf::Color color);
+
+    // Draw the pending run, if any. Call before drawing anything else to the
+    // target so it lands on top of the batch, and at the end.
+    void flush();
+
+    int drawCalls() const { return draw_calls; }
+    size_t quadCount() const { return quads; }
+
+private:
+    sf::RenderTarget* target = nullptr;
+    sf::RenderStates base_states;
+    const sf::Texture* texture = nullptr;
+    std::vector<sf::Vertex> vertices;  // pending run, 4 per quad
+    int draw_calls = 0;
+    size_t quads = 0;
+};
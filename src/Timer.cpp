@@ -33,6 +33,11 @@ void Timer::releasePyWrapper() {
     py_wrapper = nullptr;
 }
 
+void Timer::reschedule()
+{
+    if (McRFPy_API::game) McRFPy_API::game->timers.schedule(*this);
+}
+
 bool Timer::hasElapsed(int now) const
 {
     if (paused || stopped) return false;
@@ -47,23 +52,29 @@ bool Timer::test(int now)
     {
         last_ran = now;
 
+        // Timers due on the same frame share one (immutable) runtime int
+        static PyObject* runtime = nullptr;
+        static int runtime_value = 0;
+        if (!runtime || runtime_value != now) {
+            Py_XSETREF(runtime, PyLong_FromLong(now));
+            runtime_value = now;
+            if (!runtime) {
+                PyErr_Print();
+                PyErr_Clear();
+                return true;
+            }
+        }
+
         // Get the PyTimer wrapper from cache to pass to callback
         PyObject* timer_obj = nullptr;
         if (serial_number != 0) {
             timer_obj = PythonObjectCache::getInstance().lookup(serial_number);
         }
 
-        // Build args: (timer, runtime) or just (runtime) if no wrapper found
-        PyObject* args;
-        if (timer_obj) {
-            args = Py_BuildValue("(Oi)", timer_obj, now);
-        } else {
-            // Fallback to old behavior if no wrapper found
-            args = Py_BuildValue("(i)", now);
-        }
-
-        PyObject* retval = callback->call(args, NULL);
-        Py_DECREF(args);
+        // Call with (timer, runtime) or just (runtime) if no wrapper found
+        PyObject* retval = timer_obj ? callback->call({timer_obj, runtime})
+                                     : callback->call({runtime});
+        Py_XDECREF(timer_obj);
 
         if (!retval)
         {
@@ -78,8 +89,8 @@ bool Timer::test(int now)
         } else if (retval != Py_None)
         {
             std::cout << "Timer returned a non-None value. It's not an error, it's just not being saved or used." << std::endl;
-            Py_DECREF(retval);
         }
+        Py_XDECREF(retval);
 
         // Handle one-shot timers: stop but preserve callback for potential restart
         if (once) {
@@ -108,6 +119,7 @@ void Timer::resume(int current_time)
         total_paused_time += paused_duration;
         // Adjust last_ran to account for the pause
         last_ran += paused_duration;
+        reschedule();
     }
 }
 
@@ -118,6 +130,7 @@ void Timer::restart(int current_time)
     stopped = false;  // Ensure timer is running
     pause_start_time = 0;
     total_paused_time = 0;
+    reschedule();
 }
 
 void Timer::start(int current_time)
@@ -128,6 +141,7 @@ void Timer::start(int current_time)
     last_ran = current_time;
     pause_start_time = 0;
     total_paused_time = 0;
+    reschedule();
 }
 
 void Timer::stop()
@@ -138,6 +152,13 @@ void Timer::stop()
     pause_start_time = 0;
     total_paused_time = 0;
     releasePyWrapper();  // Allow Python GC now that timer is inactive (#251)
+    if (McRFPy_API::game) McRFPy_API::game->timers.retire(name);
+}
+
+void Timer::setInterval(int new_interval)
+{
+    interval = new_interval;
+    reschedule();
 }
 
 bool Timer::isActive() const
@@ -181,4 +202,5 @@ PyObject* Timer::getCallback()
 void Timer::setCallback(PyObject* new_callback)
 {
     callback = std::make_shared<PyCallable>(new_callback);
+    reschedule();
 }
\ No newline at end of file
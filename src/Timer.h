@@ -28,6 +28,7 @@ private:
 public:
     uint64_t serial_number = 0;  // For Python object cache
     std::string name;  // Store name for creating Python wrappers (#180)
+    uint64_t schedule_seq = 0;  // newest TimerScheduler entry; older ones are stale
 
     // Strong reference to Python wrapper prevents GC while timer is active (#251)
     PyObject* py_wrapper = nullptr;
@@ -54,13 +55,18 @@ public:
     bool isStopped() const { return stopped; }
     bool isActive() const;  // Running: not paused AND not stopped AND has callback
     int getInterval() const { return interval; }
-    void setInterval(int new_interval) { interval = new_interval; }
+    void setInterval(int new_interval);
     int getRemaining(int current_time) const;
     int getElapsed(int current_time) const;
+    int nextFire() const { return last_ran + interval; }
     bool isOnce() const { return once; }
     void setOnce(bool value) { once = value; }
 
     // Callback management
     PyObject* getCallback();
     void setCallback(PyObject* new_callback);
+
+private:
+    // Tell the engine's scheduler the next fire time may have moved
+    void reschedule();
 };
@@ -0,0 +1,126 @@
+#include "TimerScheduler.h"
+#include "Timer.h"
+#include <algorithm>
+#include <functional>
+
+void TimerScheduler::add(const std::string& name, std::shared_ptr<Timer> timer)
+{
+    Timer& t = *timer;
+    index[name] = std::move(timer);
+    schedule(t);
+}
+
+void TimerScheduler::clear()
+{
+    index.clear();
+    heap.clear();
+    retired.clear();
+}
+
+void TimerScheduler::schedule(Timer& timer)
+{
+    timer.schedule_seq = ++next_seq;
+    pushEntry({timer.nextFire(), timer.schedule_seq, timer.name});
+}
+
+void TimerScheduler::retire(const std::string& name)
+{
+    retired.push_back(name);
+}
+
+std::shared_ptr<Timer> TimerScheduler::resolve(const Entry& e) const
+{
+    auto it = index.find(e.name);
+    if (it == index.end() || !it->second) return nullptr;
+    const auto& timer = it->second;
+    if (timer->schedule_seq != e.seq || !timer->isActive()) return nullptr;
+    return timer;
+}
+
+void TimerScheduler::pushEntry(Entry e)
+{
+    heap.push_back(std::move(e));
+    std::push_heap(heap.begin(), heap.end(), std::greater<Entry>());
+    compact();
+}
+
+TimerScheduler::Entry TimerScheduler::popEntry()
+{
+    std::pop_heap(heap.begin(), heap.end(), std::greater<Entry>());
+    Entry e = std::move(heap.back());
+    heap.pop_back();
+    return e;
+}
+
+void TimerScheduler::compact()
+{
+    // Superseded entries normally drain as they surface; a timer whose
+    // interval keeps being pushed out could pile them up, so prune them here
+    if (heap.size() < 64 || heap.size() < 4 * index.size()) return;
+    heap.erase(std::remove_if(heap.begin(), heap.end(),
+                              [this](const Entry& e) { return !resolve(e); }),
+               heap.end());
+    std::make_heap(heap.begin(), heap.end(), std::greater<Entry>());
+}
+
+void TimerScheduler::fire(int now)
+{
+    // Due this pass, in name order
+    std::map<std::string, std::shared_ptr<Timer>> pass;
+    while (!heap.empty() && heap.front().time <= now) {
+        Entry e = popEntry();
+        if (auto timer = resolve(e)) pass.emplace(e.name, std::move(timer));
+    }
+
+    std::vector<Entry> deferred;
+    while (!pass.empty()) {
+        auto first = pass.begin();
+        std::string name = first->first;
+        // Keep a local reference: the callback may stop or replace this timer
+        auto timer = std::move(first->second);
+        pass.erase(first);
+
+        if (!timer->isStopped() && timer->test(now) && !timer->isStopped()) {
+            schedule(*timer);
+        }
+        if (timer->isStopped()) retired.push_back(name);
+
+        // Timers a callback made due: later names still fire this pass
+        while (!heap.empty() && heap.front().time <= now) {
+            Entry e = popEntry();
+            if (auto due = resolve(e)) {
+                if (e.name > name) pass.emplace(e.name, std::move(due));
+                else deferred.push_back(std::move(e));
+            }
+        }
+    }
+    for (auto& e : deferred) pushEntry(std::move(e));
+
+    // Drop stopped timers (including one-shots that fired) from the index
+    for (const auto& name : retired) {
+        auto it = index.find(name);
+        if (it != index.end() && (!it->second || it->second->isStopped())) {
+            index.erase(it);
+        }
+    }
+    retired.clear();
+}
+
+int TimerScheduler::untilNext(int now)
+{
+    // Overdue entries fire on the coming pass anyway; look past them
+    std::vector<Entry> overdue;
+    int result = -1;
+    while (!heap.empty()) {
+        if (!resolve(heap.front())) {
+            popEntry();
+        } else if (heap.front().time <= now) {
+            overdue.push_back(popEntry());
+        } else {
+            result = heap.front().time - now;
+            break;
+        }
+    }
+    for (auto& e : overdue) pushEntry(std::move(e));
+    return result;
+}
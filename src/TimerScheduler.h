@@ -0,0 +1,75 @@
+#pragma once
+// TimerScheduler.h - The engine's timers: a by-name index plus a min-heap of
+// next-fire times, so a frame costs O(timers due) instead of a scan of every
+// registered timer.
+//
+// Heap entries are lazy: a Timer records the sequence number of its newest
+// entry, and any entry that no longer matches (the timer was rescheduled,
+// paused, stopped, or replaced under its name) is dropped when it surfaces.
+// Timers reschedule themselves through Timer::reschedule() whenever their
+// next fire time can move (start, restart, resume, interval or callback
+// changes), and after each firing.
+//
+// Stopped timers leave the index at the end of the next pass, as they did
+// when the scan erased them.
+//
+// Due timers fire in name order, exactly as the old std::map scan did: a
+// timer that a callback makes due later in the same pass still fires in that
+// pass if its name sorts after the one firing, and waits a frame otherwise.
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+class Timer;
+
+class TimerScheduler {
+public:
+    using Index = std::map<std::string, std::shared_ptr<Timer>>;
+
+    // Name lookup (read-only iteration; register and retire through add/fire)
+    Index::const_iterator begin() const { return index.begin(); }
+    Index::const_iterator end() const { return index.end(); }
+    Index::const_iterator find(const std::string& name) const { return index.find(name); }
+    bool empty() const { return index.empty(); }
+    size_t size() const { return index.size(); }
+
+    // Register timer under name (replacing any previous holder) and schedule it
+    void add(const std::string& name, std::shared_ptr<Timer> timer);
+    void clear();
+
+    // Queue an entry at timer's current next-fire time, superseding older ones
+    void schedule(Timer& timer);
+
+    // Note that the timer under name stopped; fire() drops it from the index
+    void retire(const std::string& name);
+
+    // Fire every timer due at now in name order, then drop stopped timers
+    void fire(int now);
+
+    // Milliseconds until the earliest active timer fires after now, or -1
+    int untilNext(int now);
+
+private:
+    struct Entry {
+        int time;
+        uint64_t seq;
+        std::string name;
+        bool operator>(const Entry& o) const {
+            return time != o.time ? time > o.time : seq > o.seq;
+        }
+    };
+
+    // The timer an entry still speaks for, or nullptr if it is stale
+    std::shared_ptr<Timer> resolve(const Entry& e) const;
+    void pushEntry(Entry e);
+    Entry popEntry();
+    void compact();
+
+    Index index;
+    std::vector<Entry> heap;   // min-heap on (time, seq)
+    std::vector<std::string> retired;
+    uint64_t next_seq = 0;
+};
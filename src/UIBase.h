@@ -198,7 +198,11 @@ static int UIDrawable_set_visible(T* self, PyObject* value, void* closure)
         PyErr_SetString(PyExc_TypeError, "visible must be a boolean");
         return -1;
     }
-    self->data->visible = PyObject_IsTrue(value);
+    bool visible = PyObject_IsTrue(value);
+    if (self->data->visible != visible) {
+        self->data->visible = visible;
+        self->data->markCompositeDirty();  // parent re-composites without it
+    }
     return 0;
 }
 
@@ -225,7 +229,10 @@ static int UIDrawable_set_opacity(T* self, PyObject* value, void* closure)
     if (opacity < 0.0f) opacity = 0.0f;
     if (opacity > 1.0f) opacity = 1.0f;
     
-    self->data->opacity = opacity;
+    if (self->data->opacity != opacity) {
+        self->data->opacity = opacity;
+        self->data->markContentDirty();  // opacity is baked into cached pixels
+    }
     return 0;
 }
 
@@ -123,6 +123,28 @@ void UICaption::render(sf::Vector2f offset, sf::RenderTarget& target)
     text.setFillColor(color);
 }
 
+bool UICaption::addToBatch(sf::Vector2f offset, SpriteBatch& batch)
+{
+    if (!visible) return true;
+    if ((shader && shader->shader) || !GlyphRun::batchable(text)) return false;
+
+    if (glyph_run.stale(text)) {
+        glyph_run.build(text);
+        ++Resources::game->metrics.glyphRunBuilds;
+    }
+
+    // Same state render() applies, folded into the vertices
+    text.setOrigin(origin);
+    text.setRotation(rotation);
+    sf::Color fill = text.getFillColor();
+    fill.a = static_cast<sf::Uint8>(fill.a * opacity);
+    sf::Transform transform;
+    transform.translate(offset);
+    transform = transform * text.getTransform();
+    glyph_run.addTo(batch, transform, fill, text.getOutlineColor());
+    return true;
+}
+
 PyObjectsEnum UICaption::derived_type()
 {
     return PyObjectsEnum::UICAPTION;
@@ -664,110 +686,8 @@ int UICaption::init(PyUICaptionObject* self, PyObject* args, PyObject* kwds)
 
 // Property system implementation for animations
 bool UICaption::setProperty(const std::string& name, float value) {
-    if (name == "x") {
-        position.x = value;
-        text.setPosition(position);  // Keep text in sync
-        markCompositeDirty();  // #144 - Position change, texture still valid
-        return true;
-    }
-    else if (name == "y") {
-        position.y = value;
-        text.setPosition(position);  // Keep text in sync
-        markCompositeDirty();  // #144 - Position change, texture still valid
-        return true;
-    }
-    else if (name == "font_size" || name == "size") { // Support both for backward compatibility
-        text.setCharacterSize(static_cast<unsigned int>(value));
-        markDirty();  // #144 - Content change
-        return true;
-    }
-    else if (name == "outline") {
-        text.setOutlineThickness(value);
-        markDirty();  // #144 - Content change
-        return true;
-    }
-    else if (name == "opacity") {
-        opacity = std::clamp(value, 0.0f, 1.0f);
-        markDirty();  // #144 - Visual change
-        return true;
-    }
-    else if (name == "fill_color.r") {
-        auto color = text.getFillColor();
-        color.r = static_cast<sf::Uint8>(std::clamp(value, 0.0f, 255.0f));
-        text.setFillColor(color);
-        markDirty();  // #144 - Content change
-        return true;
-    }
-    else if (name == "fill_color.g") {
-        auto color = text.getFillColor();
-        color.g = static_cast<sf::Uint8>(std::clamp(value, 0.0f, 255.0f));
-        text.setFillColor(color);
-        markDirty();  // #144 - Content change
-        return true;
-    }
-    else if (name == "fill_color.b") {
-        auto color = text.getFillColor();
-        color.b = static_cast<sf::Uint8>(std::clamp(value, 0.0f, 255.0f));
-        text.setFillColor(color);
-        markDirty();  // #144 - Content change
-        return true;
-    }
-    else if (name == "fill_color.a") {
-        auto color = text.getFillColor();
-        color.a = static_cast<sf::Uint8>(std::clamp(value, 0.0f, 255.0f));
-        text.setFillColor(color);
-        markDirty();  // #144 - Content change
-        return true;
-    }
-    else if (name == "outline_color.r") {
-        auto color = text.getOutlineColor();
-        color.r = static_cast<sf::Uint8>(std::clamp(value, 0.0f, 255.0f));
-        text.setOutlineColor(color);
-        markDirty();  // #144 - Content change
-        return true;
-    }
-    else if (name == "outline_color.g") {
-        auto color = text.getOutlineColor();
-        color.g = static_cast<sf::Uint8>(std::clamp(value, 0.0f, 255.0f));
-        text.setOutlineColor(color);
-        markDirty();  // #144 - Content change
-        return true;
-    }
-    else if (name == "outline_color.b") {
-        auto color = text.getOutlineColor();
-        color.b = static_cast<sf::Uint8>(std::clamp(value, 0.0f, 255.0f));
-        text.setOutlineColor(color);
-        markDirty();  // #144 - Content change
-        return true;
-    }
-    else if (name == "outline_color.a") {
-        auto color = text.getOutlineColor();
-        color.a = static_cast<sf::Uint8>(std::clamp(value, 0.0f, 255.0f));
-        text.setOutlineColor(color);
-        markDirty();  // #144 - Content change
-        return true;
-    }
-    else if (name == "z_index") {
-        z_index = static_cast<int>(value);
-        markDirty();  // #144 - Z-order change affects parent
-        return true;
-    }
-    else if (name == "rotation") {
-        rotation = value;
-        text.setRotation(rotation);
-        markDirty();
-        return true;
-    }
-    else if (name == "origin_x") {
-        origin.x = value;
-        text.setOrigin(origin);
-        markDirty();
-        return true;
-    }
-    else if (name == "origin_y") {
-        origin.y = value;
-        text.setOrigin(origin);
-        markDirty();
+    if (auto set = floatSetter(AnimationProperty::lookup(name))) {
+        set(*this, value);
         return true;
     }
     // #106: Check for shader uniform properties
@@ -777,6 +697,120 @@ bool UICaption::setProperty(const std::string& name, float value) {
     return false;
 }
 
+AnimationProperty::FloatSetter<UIDrawable> UICaption::floatSetter(AnimationProperty::Id prop) const {
+    using namespace AnimationProperty;
+    static const SetterTable<UIDrawable> table = [] {
+        SetterTable<UIDrawable> t;
+        t[X] = [](UIDrawable& d, float value) {
+            auto& c = static_cast<UICaption&>(d);
+            c.position.x = value;
+            c.text.setPosition(c.position);  // Keep text in sync
+            c.markCompositeDirty();  // #144 - Position change, texture still valid
+        };
+        t[Y] = [](UIDrawable& d, float value) {
+            auto& c = static_cast<UICaption&>(d);
+            c.position.y = value;
+            c.text.setPosition(c.position);  // Keep text in sync
+            c.markCompositeDirty();  // #144 - Position change, texture still valid
+        };
+        t[FONT_SIZE] = [](UIDrawable& d, float value) {
+            auto& c = static_cast<UICaption&>(d);
+            c.text.setCharacterSize(static_cast<unsigned int>(value));
+            c.markDirty();  // #144 - Content change
+        };
+        t[SIZE] = t[FONT_SIZE];  // Support both for backward compatibility
+        t[OUTLINE] = [](UIDrawable& d, float value) {
+            auto& c = static_cast<UICaption&>(d);
+            c.text.setOutlineThickness(value);
+            c.markDirty();  // #144 - Content change
+        };
+        t[OPACITY] = [](UIDrawable& d, float value) {
+            d.opacity = std::clamp(value, 0.0f, 1.0f);
+            d.markDirty();  // #144 - Visual change
+        };
+        t[FILL_COLOR_R] = [](UIDrawable& d, float value) {
+            auto& c = static_cast<UICaption&>(d);
+            auto color = c.text.getFillColor();
+            color.r = static_cast<sf::Uint8>(std::clamp(value, 0.0f, 255.0f));
+            c.text.setFillColor(color);
+            c.markDirty();  // #144 - Content change
+        };
+        t[FILL_COLOR_G] = [](UIDrawable& d, float value) {
+            auto& c = static_cast<UICaption&>(d);
+            auto color = c.text.getFillColor();
+            color.g = static_cast<sf::Uint8>(std::clamp(value, 0.0f, 255.0f));
+            c.text.setFillColor(color);
+            c.markDirty();  // #144 - Content change
+        };
+        t[FILL_COLOR_B] = [](UIDrawable& d, float value) {
+            auto& c = static_cast<UICaption&>(d);
+            auto color = c.text.getFillColor();
+            color.b = static_cast<sf::Uint8>(std::clamp(value, 0.0f, 255.0f));
+            c.text.setFillColor(color);
+            c.markDirty();  // #144 - Content change
+        };
+        t[FILL_COLOR_A] = [](UIDrawable& d, float value) {
+            auto& c = static_cast<UICaption&>(d);
+            auto color = c.text.getFillColor();
+            color.a = static_cast<sf::Uint8>(std::clamp(value, 0.0f, 255.0f));
+            c.text.setFillColor(color);
+            c.markDirty();  // #144 - Content change
+        };
+        t[OUTLINE_COLOR_R] = [](UIDrawable& d, float value) {
+            auto& c = static_cast<UICaption&>(d);
+            auto color = c.text.getOutlineColor();
+            color.r = static_cast<sf::Uint8>(std::clamp(value, 0.0f, 255.0f));
+            c.text.setOutlineColor(color);
+            c.markDirty();  // #144 - Content change
+        };
+        t[OUTLINE_COLOR_G] = [](UIDrawable& d, float value) {
+            auto& c = static_cast<UICaption&>(d);
+            auto color = c.text.getOutlineColor();
+            color.g = static_cast<sf::Uint8>(std::clamp(value, 0.0f, 255.0f));
+            c.text.setOutlineColor(color);
+            c.markDirty();  // #144 - Content change
+        };
+        t[OUTLINE_COLOR_B] = [](UIDrawable& d, float value) {
+            auto& c = static_cast<UICaption&>(d);
+            auto color = c.text.getOutlineColor();
+            color.b = static_cast<sf::Uint8>(std::clamp(value, 0.0f, 255.0f));
+            c.text.setOutlineColor(color);
+            c.markDirty();  // #144 - Content change
+        };
+        t[OUTLINE_COLOR_A] = [](UIDrawable& d, float value) {
+            auto& c = static_cast<UICaption&>(d);
+            auto color = c.text.getOutlineColor();
+            color.a = static_cast<sf::Uint8>(std::clamp(value, 0.0f, 255.0f));
+            c.text.setOutlineColor(color);
+            c.markDirty();  // #144 - Content change
+        };
+        t[Z_INDEX] = [](UIDrawable& d, float value) {
+            d.z_index = static_cast<int>(value);
+            d.markDirty();  // #144 - Z-order change affects parent
+        };
+        t[ROTATION] = [](UIDrawable& d, float value) {
+            auto& c = static_cast<UICaption&>(d);
+            c.rotation = value;
+            c.text.setRotation(c.rotation);
+            c.markDirty();
+        };
+        t[ORIGIN_X] = [](UIDrawable& d, float value) {
+            auto& c = static_cast<UICaption&>(d);
+            c.origin.x = value;
+            c.text.setOrigin(c.origin);
+            c.markDirty();
+        };
+        t[ORIGIN_Y] = [](UIDrawable& d, float value) {
+            auto& c = static_cast<UICaption&>(d);
+            c.origin.y = value;
+            c.text.setOrigin(c.origin);
+            c.markDirty();
+        };
+        return t;
+    }();
+    return table.get(prop);
+}
+
 bool UICaption::setProperty(const std::string& name, const sf::Color& value) {
     if (name == "fill_color") {
         text.setFillColor(value);
@@ -3,6 +3,7 @@
 #include "Python.h"
 #include "UIDrawable.h"
 #include "PyDrawable.h"
+#include "GlyphRun.h"
 
 class UICaption: public UIDrawable
 {
@@ -10,6 +11,7 @@ public:
     sf::Text text;
     UICaption(); // Default constructor with safe initialization
     void render(sf::Vector2f, sf::RenderTarget&) override final;
+    bool addToBatch(sf::Vector2f offset, SpriteBatch& batch) override final;
     PyObjectsEnum derived_type() override final;
     virtual UIDrawable* click_at(sf::Vector2f point) override final;
     
@@ -21,6 +23,7 @@ public:
     
     // Property system for animations
     bool setProperty(const std::string& name, float value) override;
+    AnimationProperty::FloatSetter<UIDrawable> floatSetter(AnimationProperty::Id prop) const override;
     bool setProperty(const std::string& name, const sf::Color& value) override;
     bool setProperty(const std::string& name, const sf::Vector2f& value) override;
     bool setProperty(const std::string& name, const std::string& value) override;
@@ -48,6 +51,8 @@ public:
     static PyObject* repr(PyUICaptionObject* self);
     static int init(PyUICaptionObject* self, PyObject* args, PyObject* kwds);
 
+private:
+    GlyphRun glyph_run;  // text laid out for batching; rebuilt when the layout key changes
 };
 
 extern PyMethodDef UICaption_methods[];
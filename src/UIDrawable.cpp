@@ -1,5 +1,7 @@
 #include "UIDrawable.h"
 #include <iostream>
+#include <algorithm>
+#include <array>
 #include "UIFrame.h"
 #include "UICaption.h"
 #include "UISprite.h"
@@ -464,6 +466,7 @@ void UIDrawable::enableRenderTexture(unsigned int width, unsigned int height) {
 
     use_render_texture = true;
     render_dirty = true;
+    cache_needs_full = true;
 }
 
 void UIDrawable::disableRenderTexture() {
@@ -473,6 +476,7 @@ void UIDrawable::disableRenderTexture() {
     render_sprite = sf::Sprite();  // Clear stale texture reference
     use_render_texture = false;
     render_dirty = true;
+    cache_needs_full = true;
 }
 
 void UIDrawable::updateRenderTexture() {
@@ -1118,28 +1122,45 @@ bool UIDrawable::contains_point(float x, float y) const {
 // more than the walk it saves: parent chains are shallow, and this is exactly the cost
 // markCompositeDirty has always paid on every move without anyone noticing.
 void UIDrawable::markContentDirty() {
+    ++revision;
     render_dirty = true;
     composite_dirty = true;  // If content changed, composite also needs update
+    cache_needs_full = true;
 
     // Propagate to parent - parent's composite is dirty (child content changed)
-    auto p = parent.lock();
-    if (p) {
-        p->markContentDirty();  // Parent also needs to rebuild to include our changes
-    }
+    notifyParentOfChange();
 }
 
 // #144: Composite dirty - position changed, texture still valid
 void UIDrawable::markCompositeDirty() {
     // Don't set render_dirty - our cached texture is still valid
-    // Only mark composite_dirty so parent knows to re-blit us
+    // Only notify the parent so it re-composites (re-blits) us
+    ++revision;
+    notifyParentOfChange();
+}
 
-    // Propagate to parent - parent needs to re-composite
+void UIDrawable::notifyParentOfChange() {
     auto p = parent.lock();
     if (p) {
-        p->composite_dirty = true;
-        p->render_dirty = true;  // Parent needs to re-render (re-composite children)
-        p->markCompositeDirty();  // Continue propagating up
+        p->childChanged(this);
+    }
+}
+
+// The parent's raster is stale only where this child was and now is, so it
+// records the child rather than rebuilding everything. Each ancestor in turn
+// sees its own child (this drawable's ancestor) as the damaged one.
+void UIDrawable::childChanged(UIDrawable* child) {
+    ++revision;
+    render_dirty = true;
+    composite_dirty = true;
+    if (std::find(damaged_children.begin(), damaged_children.end(), child) == damaged_children.end()) {
+        if (damaged_children.size() < MAX_DAMAGED_CHILDREN) {
+            damaged_children.push_back(child);
+        } else {
+            cache_needs_full = true;
+        }
     }
+    notifyParentOfChange();  // Continue propagating up
 }
 
 // Legacy method - calls markContentDirty for backwards compatibility
@@ -2493,3 +2514,90 @@ int UIDrawable::set_vert_margin(PyObject* self, PyObject* value, void* closure)
     }
     return 0;
 }
+
+bool UIDrawable::retainable() const
+{
+    return !(shader && shader->shader);
+}
+
+bool UIDrawable::occlusion_culling = true;
+
+void UIDrawable::renderList(const std::shared_ptr<UIDrawable>* drawables, size_t count,
+                            sf::Vector2f offset, sf::RenderTarget& target,
+                            SpriteBatch& batch, float opacity)
+{
+    auto& metrics = Resources::game->metrics;
+
+    // What the target can show, in the coordinates drawables are placed in
+    const sf::View& view = target.getView();
+    bool cull = view.getRotation() == 0.0f;
+    sf::FloatRect visible_area(view.getCenter() - view.getSize() / 2.0f, view.getSize());
+
+    // Topmost opaque frames; a drawable is hidden by one drawn after it that
+    // contains its bounds. A fading scene has no opaque frames.
+    static constexpr size_t MAX_OCCLUDERS = 16;
+    struct Occluder { size_t index; sf::FloatRect rect; };
+    std::array<Occluder, MAX_OCCLUDERS> occluders;
+    size_t n_occluders = 0;
+    if (cull && occlusion_culling && opacity >= 1.0f) {
+        for (size_t i = count; i-- > 0 && n_occluders < MAX_OCCLUDERS;) {
+            sf::FloatRect rect;
+            if (drawables[i] && drawables[i]->occluder_bounds(rect)) {
+                rect.left += offset.x;
+                rect.top += offset.y;
+                occluders[n_occluders++] = {i, rect};
+            }
+        }
+    }
+
+    batch.begin(target);
+    for (size_t i = 0; i < count; ++i) {
+        UIDrawable* d = drawables[i].get();
+        if (!d) continue;
+        ++metrics.uiElements;
+        if (!d->visible) continue;
+
+        // Rotated drawables' bounds lag their rotation; never cull those.
+        // Empty bounds mean the size is unknown (headless text), not nothing.
+        if (cull && d->rotation == 0.0f && d->bounded()) {
+            sf::FloatRect b = d->damage_bounds();
+            if (b.width > 0 && b.height > 0) {
+                b.left += offset.x;
+                b.top += offset.y;
+                if (!b.intersects(visible_area)) {
+                    ++metrics.culledElements;
+                    continue;
+                }
+                bool covered = false;
+                for (size_t k = 0; k < n_occluders && !covered; ++k) {
+                    const sf::FloatRect& o = occluders[k].rect;
+                    covered = occluders[k].index > i &&
+                              o.left <= b.left && o.top <= b.top &&
+                              o.left + o.width >= b.left + b.width &&
+                              o.top + o.height >= b.top + b.height;
+                }
+                if (covered) {
+                    ++metrics.occludedElements;
+                    continue;
+                }
+            }
+        }
+
+        ++metrics.visibleElements;
+        float original_opacity = d->opacity;
+        if (opacity < 1.0f) {
+            d->opacity = original_opacity * opacity;
+        }
+        if (!d->addToBatch(offset, batch)) {
+            batch.flush();
+            ++metrics.drawCalls;
+            d->render(offset, target);
+        }
+        if (opacity < 1.0f) {
+            d->opacity = original_opacity;
+        }
+    }
+    batch.flush();
+    metrics.uiBatchDrawCalls += batch.drawCalls();
+    metrics.drawCalls += batch.drawCalls();
+}
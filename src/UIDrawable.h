@@ -16,6 +16,8 @@
 
 #include "Resources.h"
 #include "UIBase.h"
+#include "SpriteBatch.h"
+#include "AnimationProperty.h"
 
 // Forward declarations for shader support (#106)
 class UniformCollection;
@@ -46,6 +48,44 @@ public:
     virtual void render(sf::Vector2f, sf::RenderTarget&) = 0;
     virtual PyObjectsEnum derived_type() = 0;
 
+    // Queue what render(offset, target) would draw into batch, so a run of
+    // siblings sharing a texture draws in one call. Returns false, queuing
+    // nothing, when this drawable needs its own draw: the caller flushes the
+    // batch and calls render() instead.
+    virtual bool addToBatch(sf::Vector2f offset, SpriteBatch& batch)
+    { (void)offset; (void)batch; return false; }
+
+    // Draw a child list in order at offset, skipping what cannot show: hidden
+    // drawables, those entirely outside the target's view (the window, or a
+    // clipping parent's texture) and, with occlusion_culling, those entirely
+    // under an opaque frame later in the list. Runs go through batch.
+    // opacity scales every drawable's own for this draw (scene fades).
+    static void renderList(const std::shared_ptr<UIDrawable>* drawables, size_t count,
+                           sf::Vector2f offset, sf::RenderTarget& target,
+                           SpriteBatch& batch, float opacity = 1.0f);
+    static void renderList(const std::vector<std::shared_ptr<UIDrawable>>& drawables,
+                           sf::Vector2f offset, sf::RenderTarget& target,
+                           SpriteBatch& batch, float opacity = 1.0f)
+    { renderList(drawables.data(), drawables.size(), offset, target, batch, opacity); }
+    static bool occlusion_culling;  // mcrfpy.occlusion_culling
+
+    // True when damage_bounds() encloses everything render() draws, so the
+    // drawable can be culled on it. A frame that lets children overflow is not.
+    virtual bool bounded() const { return true; }
+
+    // Area this drawable paints fully opaque, in parent coordinates. False
+    // when there is none it can vouch for.
+    virtual bool occluder_bounds(sf::FloatRect& rect) const { (void)rect; return false; }
+
+    // True when this subtree draws the same pixels until its revision changes,
+    // so a retained scene may keep it in a cached layer. Shaders (time
+    // uniforms) and drawables fed by state outside the dirty flags (grids,
+    // 3D viewports) must be drawn live.
+    virtual bool retainable() const;
+
+    // Bumped whenever this drawable or anything below it is marked dirty
+    uint32_t revision = 0;
+
     // Mouse input handling - callable objects for click, enter, exit, move events
     std::unique_ptr<PyClickCallable> click_callable;
     std::unique_ptr<PyHoverCallable> on_enter_callable;   // #140, #230 - position-only
@@ -283,6 +323,10 @@ public:
     virtual bool setProperty(const std::string& name, const sf::Color& value) { return false; }
     virtual bool setProperty(const std::string& name, const sf::Vector2f& value) { return false; }
     virtual bool setProperty(const std::string& name, const std::string& value) { return false; }
+
+    // Float setter for an interned property, resolved once when an animation
+    // starts; nullptr sends the animation through setProperty() by name
+    virtual AnimationProperty::FloatSetter<UIDrawable> floatSetter(AnimationProperty::Id prop) const { return nullptr; }
     
     virtual bool getProperty(const std::string& name, float& value) const { return false; }
     virtual bool getProperty(const std::string& name, int& value) const { return false; }
@@ -383,8 +427,28 @@ public:
     // Clear dirty flags (called after rendering)
     void clearDirty() { render_dirty = false; composite_dirty = false; }
 
+    // A child's content or position changed: invalidate this raster, note the
+    // child so a cached UIFrame can redraw just its area, and pass it up.
+    void childChanged(UIDrawable* child);
+
+    // Area this drawable paints, in its parent's coordinates: get_bounds()
+    // plus anything drawn outside it (outlines). Damage rects are built from it.
+    virtual sf::FloatRect damage_bounds() const { return get_bounds(); }
+
+    // damage_bounds() as of the last time a caching parent drew this drawable
+    // into its raster (the area to repaint when it changes or moves)
+    sf::FloatRect composited_bounds;
+    bool has_composited_bounds = false;
+
 protected:
     bool composite_dirty = true;  // #144: Needs re-composite (child positions changed)
+
+    // #144 partial recomposition, for drawables that cache a raster
+    bool cache_needs_full = true;              // Own content changed: rebuild everything
+    std::vector<UIDrawable*> damaged_children; // Changed since the raster; compared, never dereferenced
+    static constexpr size_t MAX_DAMAGED_CHILDREN = 32;
+
+    void notifyParentOfChange();
 };
 
 typedef struct {
@@ -36,6 +36,7 @@ UIEntity::UIEntity()
 }
 
 UIEntity::~UIEntity() {
+    if (spatial_owner) spatial_owner->remove(this);
     releasePyIdentity();
     if (serial_number != 0) {
         PythonObjectCache::getInstance().remove(serial_number);
@@ -48,42 +49,52 @@ void UIEntity::updateVisibility()
 {
     if (!grid) return;
 
+    // Compute FOV from entity's cell position (#114, #295) with the grid's
+    // configured algorithm and radius. An entity off the grid sees nothing.
+    int x = cell_position.x;
+    int y = cell_position.y;
+    if (x >= 0 && x < grid->grid_w && y >= 0 && y < grid->grid_h) {
+        grid->computeFOV(x, y, grid->fov_radius, true, grid->fov_algorithm);
+        applyVisibility(grid->fovMask());
+    } else {
+        applyVisibility(FOVEngine::VisibilityMask());
+    }
+}
+
+void UIEntity::applyVisibility(const FOVEngine::VisibilityMask& fov)
+{
+    if (!grid) return;
+
     // Lazy-allocate or resize perspective_map if grid dimensions changed.
     // Dimension mismatch wipes prior state -- the entity's memory has no
     // identity with a differently-sized grid, so starting fresh is correct.
     // On (re)allocation, reset the cached previous-FOV window (#316) so we never
     // demote a stale rect against a freshly-sized buffer (would be wrong/OOB).
-    size_t expected = static_cast<size_t>(grid->grid_w) * grid->grid_h;
+    // Compact entities keep the same memory in perspective_bits instead.
     bool fresh = false;
-    if (!perspective_map || perspective_map->size() != expected) {
+    if (compact_perspective) {
+        if (!perspective_bits || perspective_bits->width() != grid->grid_w ||
+            perspective_bits->height() != grid->grid_h) {
+            perspective_bits = std::make_shared<PerspectiveBits>(grid->grid_w, grid->grid_h);
+            fresh = true;
+        }
+    } else if (!perspective_map || perspective_map->width() != grid->grid_w ||
+               perspective_map->height() != grid->grid_h) {
         perspective_map = std::make_shared<DiscreteMap>(grid->grid_w, grid->grid_h, 0);
         fresh = true;
+    }
+    if (fresh) {
         prev_fov_x0 = prev_fov_y0 = prev_fov_x1 = prev_fov_y1 = 0;
         // A fresh buffer is all-zero: nothing to demote, and any pending
         // external-assignment demote is moot (the assigned map was discarded).
         perspective_full_demote_pending = false;
     }
 
-    // Compute FOV from entity's cell position (#114, #295)
-    int x = cell_position.x;
-    int y = cell_position.y;
-    int r = grid->fov_radius;
-
     // #316: Clip both the demote and promote passes to an AABB sized to the FOV
     // radius around the entity, instead of walking the whole W*H buffer twice.
-    // Margins of +/-1 (with half-open +1) cover light_walls lighting a wall one
-    // cell beyond the radius. r <= 0 means unlimited == full grid (matches TCOD
-    // radius 0); store the full-grid window so the next tick demotes correctly.
-    int cx0, cy0, cx1, cy1;
-    if (r > 0) {
-        cx0 = std::max(0, x - r - 1);
-        cy0 = std::max(0, y - r - 1);
-        cx1 = std::min(grid->grid_w, x + r + 2);
-        cy1 = std::min(grid->grid_h, y + r + 2);
-    } else {
-        cx0 = 0; cy0 = 0;
-        cx1 = grid->grid_w; cy1 = grid->grid_h;
-    }
+    // That AABB is the FOV mask's window: the radius box plus a one-cell margin
+    // (light_walls may light a wall one cell beyond the radius), clamped to the
+    // grid, or the full grid for radius <= 0 (unlimited, as in TCOD).
 
     // Demote visible (2) -> discovered (1) from the LAST tick's promoted window
     // (NOT the current one). Demoting the current window would leave cells the
@@ -101,60 +112,69 @@ void UIEntity::updateVisibility()
     if (fresh) {
         // nothing to demote
     } else if (perspective_full_demote_pending) {
-        perspective_map->demoteVisible();
+        if (compact_perspective) perspective_bits->demoteVisible();
+        else perspective_map->demoteVisible();
         perspective_full_demote_pending = false;
     } else if (prev_fov_x1 > prev_fov_x0 && prev_fov_y1 > prev_fov_y0) {
-        perspective_map->demoteVisibleRect(prev_fov_x0, prev_fov_y0,
-                                           prev_fov_x1, prev_fov_y1);
-    }
-
-    // Use grid's configured FOV algorithm and radius
-    grid->computeFOV(x, y, grid->fov_radius, true, grid->fov_algorithm);
-
-    // Promote visible cells to 2 (VISIBLE), clipped to the current window.
-    // Cells going 0 -> 2 are freshly discovered; cells going 1 -> 2 were
-    // already discovered.
-    uint8_t* buf = perspective_map->data();
-    int W = grid->grid_w;
-    for (int gy = cy0; gy < cy1; ++gy) {
-        for (int gx = cx0; gx < cx1; ++gx) {
-            if (grid->isInFOV(gx, gy)) {
-                buf[gy * W + gx] = PyPerspective::VISIBLE;
-            }
+        if (compact_perspective) {
+            perspective_bits->demoteVisibleRect(prev_fov_x0, prev_fov_y0,
+                                                prev_fov_x1, prev_fov_y1);
+        } else {
+            perspective_map->demoteVisibleRect(prev_fov_x0, prev_fov_y0,
+                                               prev_fov_x1, prev_fov_y1);
         }
     }
 
-    // Cache this tick's promoted window so the next call demotes exactly it.
-    prev_fov_x0 = cx0; prev_fov_y0 = cy0;
-    prev_fov_x1 = cx1; prev_fov_y1 = cy1;
+    // Promote visible cells to 2 (VISIBLE). Cells going 0 -> 2 are freshly
+    // discovered; cells going 1 -> 2 were already discovered. The compact
+    // form ORs the mask in a word at a time; the byte map visits set bits.
+    if (compact_perspective) {
+        perspective_bits->promote(fov);
+    } else {
+        uint8_t* buf = perspective_map->data();
+        int W = grid->grid_w;
+        fov.forEachVisible([&](int gx, int gy) {
+            buf[gy * W + gx] = PyPerspective::VISIBLE;
+        });
+    }
 
-    // #113 - Update any ColorLayers bound to this entity via perspective
-    // Get shared_ptr to self for comparison
-    std::shared_ptr<UIEntity> self_ptr = nullptr;
-    if (grid->entities) {
-        for (auto& entity : *grid->entities) {
-            if (entity.get() == this) {
-                self_ptr = entity;
-                break;
-            }
-        }
+    // Cache this tick's promoted window so the next call demotes exactly it.
+    if (fov.covers()) {
+        prev_fov_x0 = fov.x0(); prev_fov_y0 = fov.y0();
+        prev_fov_x1 = fov.x1(); prev_fov_y1 = fov.y1();
+    } else {
+        prev_fov_x0 = prev_fov_y0 = prev_fov_x1 = prev_fov_y1 = 0;
     }
 
-    if (self_ptr) {
-        for (auto& layer : grid->layers) {
-            if (layer->type == GridLayerType::Color) {
-                auto color_layer = std::static_pointer_cast<ColorLayer>(layer);
-                if (color_layer->has_perspective) {
-                    auto bound_entity = color_layer->perspective_entity.lock();
-                    if (bound_entity && bound_entity.get() == this) {
-                        color_layer->updatePerspective();
-                    }
+    // #113 - Update any ColorLayers bound to this entity via perspective.
+    // The layer holds a weak_ptr to its entity, so comparing the locked
+    // pointer against `this` needs no scan of grid->entities.
+    for (auto& layer : grid->layers) {
+        if (layer->type == GridLayerType::Color) {
+            auto color_layer = std::static_pointer_cast<ColorLayer>(layer);
+            if (color_layer->has_perspective) {
+                auto bound_entity = color_layer->perspective_entity.lock();
+                if (bound_entity && bound_entity.get() == this) {
+                    color_layer->updatePerspective();
                 }
             }
         }
     }
 }
 
+uint8_t UIEntity::perspectiveState(int x, int y) const
+{
+    if (!grid || x < 0 || y < 0 || x >= grid->grid_w || y >= grid->grid_h) return 0;
+    if (compact_perspective) {
+        if (!perspective_bits || perspective_bits->width() != grid->grid_w ||
+            perspective_bits->height() != grid->grid_h) return 0;
+        return perspective_bits->get(x, y);
+    }
+    if (!perspective_map || perspective_map->width() != grid->grid_w ||
+        perspective_map->height() != grid->grid_h) return 0;
+    return perspective_map->data()[static_cast<size_t>(y) * grid->grid_w + x];
+}
+
 PyObject* UIEntity::at(PyUIEntityObject* self, PyObject* args, PyObject* kwds) {
     // #294: at(x, y) returns grid.at(x, y) when the cell is currently VISIBLE
     // to this entity, None otherwise. Equivalent to:
@@ -178,9 +198,7 @@ PyObject* UIEntity::at(PyUIEntityObject* self, PyObject* args, PyObject* kwds) {
     }
 
     // No perspective yet or cell not visible -> None
-    if (!entity->perspective_map) Py_RETURN_NONE;
-    uint8_t state = entity->perspective_map->data()[y * entity->grid->grid_w + x];
-    if (state != PyPerspective::VISIBLE) Py_RETURN_NONE;
+    if (entity->perspectiveState(x, y) != PyPerspective::VISIBLE) Py_RETURN_NONE;
 
     // Construct a GridPoint wrapper (same pattern as grid.at(x, y)).
     auto type = &mcrfpydef::PyUIGridPointType;
@@ -457,10 +475,9 @@ int UIEntity::set_position(PyUIEntityObject* self, PyObject* value, void* closur
                                             static_cast<float>(vec.y));
     }
 
-    // Update spatial hash if grid exists (#115)
+    // Update spatial hash and damage the view rasters (#115, #351)
     if (self->data->grid) {
-        self->data->grid->spatial_hash.update(self->data, old_x, old_y);
-        self->data->grid->markCompositeDirty();  // #351 - entity moved; re-raster view
+        self->data->grid->entityMoved(*self->data, sf::Vector2f(old_x, old_y));
     }
 
     return 0;
@@ -468,19 +485,32 @@ int UIEntity::set_position(PyUIEntityObject* self, PyObject* value, void* closur
 
 // #294: perspective_map property. Returns a live DiscreteMap reference
 // (not a snapshot); lazy-allocates on first access when a grid is set.
+// A compact entity has no byte map to share, so it gets a snapshot copy.
 PyObject* UIEntity::get_perspective_map(PyUIEntityObject* self, void* closure) {
     auto& entity = self->data;
     if (!entity->grid) Py_RETURN_NONE;
-    if (!entity->perspective_map) {
-        entity->perspective_map = std::make_shared<DiscreteMap>(
-            entity->grid->grid_w, entity->grid->grid_h, 0);
+    std::shared_ptr<DiscreteMap> map;
+    if (entity->compact_perspective) {
+        if (!entity->perspective_bits) {
+            entity->perspective_bits = std::make_shared<PerspectiveBits>(
+                entity->grid->grid_w, entity->grid->grid_h);
+        }
+        map = std::make_shared<DiscreteMap>(entity->perspective_bits->width(),
+                                            entity->perspective_bits->height(), 0);
+        entity->perspective_bits->toBytes(map->data());
+    } else {
+        if (!entity->perspective_map) {
+            entity->perspective_map = std::make_shared<DiscreteMap>(
+                entity->grid->grid_w, entity->grid->grid_h, 0);
+        }
+        map = entity->perspective_map;
     }
 
     // Wrap in PyDiscreteMapObject sharing the same shared_ptr.
     auto type = &mcrfpydef::PyDiscreteMapType;
     auto obj = (PyDiscreteMapObject*)type->tp_alloc(type, 0);
     if (!obj) return NULL;
-    new (&obj->data) std::shared_ptr<DiscreteMap>(entity->perspective_map);
+    new (&obj->data) std::shared_ptr<DiscreteMap>(std::move(map));
     obj->values = obj->data->data();
     obj->w = obj->data->width();
     obj->h = obj->data->height();
@@ -498,6 +528,7 @@ int UIEntity::set_perspective_map(PyUIEntityObject* self, PyObject* value, void*
 
     if (value == NULL || value == Py_None) {
         entity->perspective_map.reset();
+        entity->perspective_bits.reset();
         // Lazy realloc on next access produces an all-zero buffer (handled by
         // the fresh path in updateVisibility), so no pending full demote.
         entity->perspective_full_demote_pending = false;
@@ -532,7 +563,18 @@ int UIEntity::set_perspective_map(PyUIEntityObject* self, PyObject* value, void*
         return -1;
     }
 
-    entity->perspective_map = incoming->data;  // share ownership
+    if (entity->compact_perspective) {
+        // Copied into the bitplanes; later writes to `value` are not seen.
+        auto bits = std::make_shared<PerspectiveBits>(entity->grid->grid_w, entity->grid->grid_h);
+        if (!bits->fromBytes(incoming->data->data())) {
+            PyErr_SetString(PyExc_ValueError,
+                "compact perspective values must be 0, 1 or 2 (Perspective)");
+            return -1;
+        }
+        entity->perspective_bits = std::move(bits);
+    } else {
+        entity->perspective_map = incoming->data;  // share ownership
+    }
     // #316: an externally-assigned map may hold VISIBLE=2 cells anywhere, so the
     // cached prev_fov window can no longer bound the demote. Force a one-shot
     // full demote on the next updateVisibility() (load/resume correctness).
@@ -540,6 +582,44 @@ int UIEntity::set_perspective_map(PyUIEntityObject* self, PyObject* value, void*
     return 0;
 }
 
+PyObject* UIEntity::get_compact_perspective(PyUIEntityObject* self, void* closure) {
+    return PyBool_FromLong(self->data->compact_perspective);
+}
+
+// Switching forms converts the existing memory losslessly; the demote
+// bookkeeping (prev_fov_*, perspective_full_demote_pending) carries over.
+int UIEntity::set_compact_perspective(PyUIEntityObject* self, PyObject* value, void* closure) {
+    if (!value) {
+        PyErr_SetString(PyExc_TypeError, "compact_perspective cannot be deleted");
+        return -1;
+    }
+    int compact = PyObject_IsTrue(value);
+    if (compact < 0) return -1;
+    auto& entity = self->data;
+    if (static_cast<bool>(compact) == entity->compact_perspective) return 0;
+
+    if (compact) {
+        if (entity->perspective_map) {
+            auto& map = entity->perspective_map;
+            auto bits = std::make_shared<PerspectiveBits>(map->width(), map->height());
+            if (!bits->fromBytes(map->data())) {
+                PyErr_SetString(PyExc_ValueError,
+                    "perspective_map holds values other than 0, 1 or 2; cannot compact it");
+                return -1;
+            }
+            entity->perspective_bits = std::move(bits);
+            entity->perspective_map.reset();
+        }
+    } else if (entity->perspective_bits) {
+        auto& bits = entity->perspective_bits;
+        entity->perspective_map = std::make_shared<DiscreteMap>(bits->width(), bits->height(), 0);
+        bits->toBytes(entity->perspective_map->data());
+        entity->perspective_bits.reset();
+    }
+    entity->compact_perspective = compact;
+    return 0;
+}
+
 int UIEntity::set_spritenumber(PyUIEntityObject* self, PyObject* value, void* closure) {
     int val;
     if (PyLong_Check(value))
@@ -644,9 +724,9 @@ int UIEntity::set_float_member(PyUIEntityObject* self, PyObject* value, void* cl
         self->data->position.y = val;
     }
 
-    // Update spatial hash if grid exists (#115)
+    // Update spatial hash and damage the view rasters (#115, #351)
     if (self->data->grid) {
-        self->data->grid->spatial_hash.update(self->data, old_x, old_y);
+        self->data->grid->entityMoved(*self->data, sf::Vector2f(old_x, old_y));
     }
 
     return 0;
@@ -708,8 +788,8 @@ int UIEntity::set_pixel_pos(PyUIEntityObject* self, PyObject* value, void* closu
     self->data->position.x = pixel_vec.x / cell_width;
     self->data->position.y = pixel_vec.y / cell_height;
 
-    // Update spatial hash
-    self->data->grid->spatial_hash.update(self->data, old_x, old_y);
+    // Update spatial hash and damage the view rasters
+    self->data->grid->entityMoved(*self->data, sf::Vector2f(old_x, old_y));
 
     return 0;
 }
@@ -760,8 +840,8 @@ int UIEntity::set_pixel_member(PyUIEntityObject* self, PyObject* value, void* cl
     else // y
         self->data->position.y = val / cell_height;
 
-    // Update spatial hash
-    self->data->grid->spatial_hash.update(self->data, old_x, old_y);
+    // Update spatial hash and damage the view rasters
+    self->data->grid->entityMoved(*self->data, sf::Vector2f(old_x, old_y));
 
     return 0;
 }
@@ -796,9 +876,9 @@ int UIEntity::set_grid_int_member(PyUIEntityObject* self, PyObject* value, void*
     else // grid_y
         self->data->position.y = static_cast<float>(val);
 
-    // Update spatial hash if grid exists
+    // Update spatial hash and damage the view rasters
     if (self->data->grid) {
-        self->data->grid->spatial_hash.update(self->data, old_x, old_y);
+        self->data->grid->entityMoved(*self->data, sf::Vector2f(old_x, old_y));
     }
 
     return 0;
@@ -1157,29 +1237,28 @@ PyObject* UIEntity::path_to(PyUIEntityObject* self, PyObject* args, PyObject* kw
         return NULL;
     }
 
-    // Use A* pathfinding via temporary TCODPath
-    TCODPath tcod_path(grid->getTCODMap(), 1.41f);
-    if (!tcod_path.compute(current_x, current_y, target_x, target_y)) {
+    // A* over the grid's walkable plane
+    std::vector<sf::Vector2i> steps;
+    if (!PathEngine::findPath(PathEngine::Terrain::fromGrid(*grid), PathEngine::StepCosts::fromDiagonal(1.41f),
+                              sf::Vector2i(current_x, current_y), sf::Vector2i(target_x, target_y),
+                              PathEngine::Heuristic::EUCLIDEAN, 1.0f, steps)) {
         // No path found - return empty list
         return PyList_New(0);
     }
 
     // Convert path to Python list of tuples
-    PyObject* path_list = PyList_New(tcod_path.size());
+    PyObject* path_list = PyList_New(steps.size());
     if (!path_list) return PyErr_NoMemory();
 
-    for (int i = 0; i < tcod_path.size(); ++i) {
-        int px, py;
-        tcod_path.get(i, &px, &py);
-
+    for (size_t i = 0; i < steps.size(); ++i) {
         PyObject* coord_tuple = PyTuple_New(2);
         if (!coord_tuple) {
             Py_DECREF(path_list);
             return PyErr_NoMemory();
         }
 
-        PyTuple_SetItem(coord_tuple, 0, PyLong_FromLong(px));
-        PyTuple_SetItem(coord_tuple, 1, PyLong_FromLong(py));
+        PyTuple_SetItem(coord_tuple, 0, PyLong_FromLong(steps[i].x));
+        PyTuple_SetItem(coord_tuple, 1, PyLong_FromLong(steps[i].y));
         PyList_SetItem(path_list, i, coord_tuple);
     }
 
@@ -1309,6 +1388,7 @@ PyObject* UIEntity::visible_entities(PyUIEntityObject* self, PyObject* args, PyO
 
     // Compute FOV from this entity's cell position
     grid->computeFOV(x, y, radius, true, algorithm);
+    const auto& fov = grid->fovMask();
 
     // Create result list
     PyObject* result = PyList_New(0);
@@ -1329,7 +1409,7 @@ PyObject* UIEntity::visible_entities(PyUIEntityObject* self, PyObject* args, PyO
             int ex = entity->cell_position.x;
             int ey = entity->cell_position.y;
 
-            if (grid->isInFOV(ex, ey)) {
+            if (fov.test(ex, ey)) {
                 // Create Python Entity object for this entity
                 auto pyEntity = (PyUIEntityObject*)entity_type->tp_alloc(entity_type, 0);
                 if (!pyEntity) {
@@ -1590,16 +1670,18 @@ int UIEntity::set_sight_radius(PyUIEntityObject* self, PyObject* value, void* cl
 }
 
 PyObject* UIEntity::py_set_behavior(PyUIEntityObject* self, PyObject* args, PyObject* kwds) {
-    static const char* kwlist[] = {"type", "waypoints", "turns", "path", "pathfinder", nullptr};
+    static const char* kwlist[] = {"type", "waypoints", "turns", "path", "pathfinder",
+                                   "hierarchical", nullptr};
     int type_val = 0;
     PyObject* waypoints_obj = nullptr;
     int turns = 0;
     PyObject* path_obj = nullptr;
     PyObject* pathfinder_obj = nullptr;
+    int hierarchical = 0;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwds, "i|OiOO", const_cast<char**>(kwlist),
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "i|OiOOp", const_cast<char**>(kwlist),
                                      &type_val, &waypoints_obj, &turns, &path_obj,
-                                     &pathfinder_obj)) {
+                                     &pathfinder_obj, &hierarchical)) {
         return NULL;
     }
 
@@ -1682,8 +1764,12 @@ PyObject* UIEntity::py_set_behavior(PyUIEntityObject* self, PyObject* args, PyOb
             long tx = PyLong_AsLong(PyTuple_GetItem(pathfinder_obj, 0));
             long ty = PyLong_AsLong(PyTuple_GetItem(pathfinder_obj, 1));
             if (PyErr_Occurred()) return NULL;
-            behavior.path_provider = std::make_unique<TargetProvider>(
-                sf::Vector2i(static_cast<int>(tx), static_cast<int>(ty)));
+            sf::Vector2i target(static_cast<int>(tx), static_cast<int>(ty));
+            if (hierarchical) {
+                behavior.path_provider = std::make_unique<HPAProvider>(target);
+            } else {
+                behavior.path_provider = std::make_unique<TargetProvider>(target);
+            }
         } else {
             PyErr_SetString(PyExc_TypeError,
                 "pathfinder must be a DijkstraMap, AStarPath, or (x, y) tuple");
@@ -1855,7 +1941,7 @@ PyMethodDef UIEntity_all_methods[] = {
     // #300 - Behavior system
     {"set_behavior", (PyCFunction)UIEntity::py_set_behavior, METH_VARARGS | METH_KEYWORDS,
      MCRF_METHOD(Entity, set_behavior,
-         MCRF_SIG("(type, waypoints=None, turns: int = 0, path=None, pathfinder=None)", "None"),
+         MCRF_SIG("(type, waypoints=None, turns: int = 0, path=None, pathfinder=None, hierarchical: bool = False)", "None"),
          MCRF_DESC("Configure this entity's behavior for grid.step() turn management."),
          MCRF_ARGS_START
          MCRF_ARG("type", "Behavior type (int or Behavior enum, e.g., Behavior.PATROL)")
@@ -1863,6 +1949,7 @@ PyMethodDef UIEntity_all_methods[] = {
          MCRF_ARG("turns", "Number of turns for SLEEP behavior")
          MCRF_ARG("path", "Pre-computed path as list of (x, y) tuples for PATH behavior")
          MCRF_ARG("pathfinder", "DijkstraMap, AStarPath, or (x, y) target tuple for SEEK behavior")
+         MCRF_ARG("hierarchical", "With an (x, y) pathfinder: follow a route planned on the grid's hierarchical path graph (re-planned after walkability edits) instead of stepping straight toward the target")
          MCRF_RETURNS("None")
      )},
     {NULL}  // Sentinel
@@ -1899,7 +1986,10 @@ PyGetSetDef UIEntity::getsetters[] = {
      MCRF_PROPERTY(draw_pos, "Fractional tile position for rendering (Vector). Use for smooth animation between grid cells."), (void*)0},
 
     {"perspective_map", (getter)UIEntity::get_perspective_map, (setter)UIEntity::set_perspective_map,
-     MCRF_PROPERTY(perspective_map, "Per-entity FOV memory (DiscreteMap). 3-state values per cell: 0=unknown, 1=discovered, 2=visible. Lazy-allocated on first access once entity has a grid; returns None otherwise. The returned DiscreteMap is a live reference. Assigning a DiscreteMap replaces the entity's memory (e.g. loading a saved perspective via from_bytes); size must match the grid or ValueError is raised, and the next updateVisibility() demotes any loaded visible cells to discovered before recomputing FOV. Assign None to clear. Note: updateVisibility() only auto-demotes visible cells the engine itself promoted; if you write 2 (visible) into the live map by hand at a cell outside the entity's current FOV, it will not be auto-demoted -- use 1 (discovered) to reveal remembered cells, or assign a whole map to set arbitrary state."),
+     MCRF_PROPERTY(perspective_map, "Per-entity FOV memory (DiscreteMap). 3-state values per cell: 0=unknown, 1=discovered, 2=visible. Lazy-allocated on first access once entity has a grid; returns None otherwise. The returned DiscreteMap is a live reference. Assigning a DiscreteMap replaces the entity's memory (e.g. loading a saved perspective via from_bytes); size must match the grid or ValueError is raised, and the next updateVisibility() demotes any loaded visible cells to discovered before recomputing FOV. Assign None to clear. Note: updateVisibility() only auto-demotes visible cells the engine itself promoted; if you write 2 (visible) into the live map by hand at a cell outside the entity's current FOV, it will not be auto-demoted -- use 1 (discovered) to reveal remembered cells, or assign a whole map to set arbitrary state. When compact_perspective is True the returned DiscreteMap is a snapshot copy instead, and assigned maps are copied in (values must be 0-2)."),
+     NULL},
+    {"compact_perspective", (getter)UIEntity::get_compact_perspective, (setter)UIEntity::set_compact_perspective,
+     MCRF_PROPERTY(compact_perspective, "Store perspective memory as two bitplanes (bool). Default False. About a quarter of the memory of the byte-per-cell map, with the same Perspective values; demote and promote work a machine word at a time. Toggling converts the existing memory. While True, perspective_map returns a snapshot copy rather than a live view."),
      NULL},
     {"grid", (getter)UIEntity::get_grid, (setter)UIEntity::set_grid,
      MCRF_PROPERTY(grid, "Grid this entity belongs to (Grid or None). Assign a Grid to attach the entity, or None to remove it from its current grid."), NULL},
@@ -1974,39 +2064,8 @@ PyObject* UIEntity::repr(PyUIEntityObject* self) {
 // #176 - Animation properties use tile coordinates (draw_x, draw_y)
 // "x" and "y" are kept as aliases for backwards compatibility
 bool UIEntity::setProperty(const std::string& name, float value) {
-    if (name == "draw_x" || name == "x") {  // #176 - draw_x is preferred, x is alias
-        float old_x = position.x;
-        float old_y = position.y;
-        position.x = value;
-        if (grid) {
-            grid->markCompositeDirty();
-            grid->spatial_hash.update(shared_from_this(), old_x, old_y);  // #256
-        }
-        return true;
-    }
-    else if (name == "draw_y" || name == "y") {  // #176 - draw_y is preferred, y is alias
-        float old_x = position.x;
-        float old_y = position.y;
-        position.y = value;
-        if (grid) {
-            grid->markCompositeDirty();
-            grid->spatial_hash.update(shared_from_this(), old_x, old_y);  // #256
-        }
-        return true;
-    }
-    else if (name == "sprite_scale") {
-        sprite.setScale(sf::Vector2f(value, value));
-        if (grid) grid->markCompositeDirty();  // #144 - Content change
-        return true;
-    }
-    else if (name == "sprite_offset_x") {
-        sprite_offset.x = value;
-        if (grid) grid->markCompositeDirty();
-        return true;
-    }
-    else if (name == "sprite_offset_y") {
-        sprite_offset.y = value;
-        if (grid) grid->markCompositeDirty();
+    if (auto set = floatSetter(AnimationProperty::lookup(name))) {
+        set(*this, value);
         return true;
     }
     // #106: Shader uniform properties - delegate to sprite
@@ -2016,6 +2075,41 @@ bool UIEntity::setProperty(const std::string& name, float value) {
     return false;
 }
 
+AnimationProperty::FloatSetter<UIEntity> UIEntity::floatSetter(AnimationProperty::Id prop) {
+    using namespace AnimationProperty;
+    static const SetterTable<UIEntity> table = [] {
+        SetterTable<UIEntity> t;
+        t[DRAW_X] = [](UIEntity& e, float value) {
+            float old_x = e.position.x;
+            float old_y = e.position.y;
+            e.position.x = value;
+            if (e.grid) e.grid->entityMoved(e, sf::Vector2f(old_x, old_y));  // #256
+        };
+        t[X] = t[DRAW_X];  // #176 - draw_x is preferred, x is alias
+        t[DRAW_Y] = [](UIEntity& e, float value) {
+            float old_x = e.position.x;
+            float old_y = e.position.y;
+            e.position.y = value;
+            if (e.grid) e.grid->entityMoved(e, sf::Vector2f(old_x, old_y));  // #256
+        };
+        t[Y] = t[DRAW_Y];  // #176 - draw_y is preferred, y is alias
+        t[SPRITE_SCALE] = [](UIEntity& e, float value) {
+            e.sprite.setScale(sf::Vector2f(value, value));
+            if (e.grid) e.grid->markCompositeDirty();  // #144 - Content change
+        };
+        t[SPRITE_OFFSET_X] = [](UIEntity& e, float value) {
+            e.sprite_offset.x = value;
+            if (e.grid) e.grid->markCompositeDirty();
+        };
+        t[SPRITE_OFFSET_Y] = [](UIEntity& e, float value) {
+            e.sprite_offset.y = value;
+            if (e.grid) e.grid->markCompositeDirty();
+        };
+        return t;
+    }();
+    return table.get(prop);
+}
+
 bool UIEntity::setProperty(const std::string& name, int value) {
     if (name == "sprite_index") {
         sprite.setSpriteIndex(value);
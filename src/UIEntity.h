@@ -20,10 +20,13 @@
 #include "UISprite.h"
 #include "EntityBehavior.h"
 #include "DiscreteMap.h"
+#include "FOVEngine.h"
+#include "PerspectiveBits.h"
 #include <memory>
 
 class GridData;
 class GridData;
+class SpatialHash;
 
 // UIEntity
 /*
@@ -93,6 +96,13 @@ public:
     // VISIBLE cells correctly fall to DISCOVERED before the FOV is recomputed.
     // Set by set_perspective_map(); cleared after the one-shot full demote.
     bool perspective_full_demote_pending = false;
+    // Compact perspective (Entity.compact_perspective): when set, the memory
+    // lives in perspective_bits (two bitplanes) and perspective_map stays
+    // null; the Python perspective_map getter hands out a DiscreteMap copy.
+    // prev_fov_* and perspective_full_demote_pending apply to whichever form
+    // is active.
+    bool compact_perspective = false;
+    std::shared_ptr<PerspectiveBits> perspective_bits;
     UISprite sprite;
     sf::Vector2f position; //(x,y) in grid coordinates; float for animation
     sf::Vector2i cell_position{0, 0}; // #295: integer logical position (decoupled from float position)
@@ -101,6 +111,18 @@ public:
     int tile_height = 1;
     std::vector<int> sprite_grid; // #237: per-tile sprite indices (row-major, -1 = empty)
     std::unordered_set<std::string> labels; // #296: entity label system for collision/targeting
+    // SpatialHash bookkeeping: the hash holding this entity and its bucket /
+    // slot there, so removal and re-bucketing are O(1). Written only by
+    // SpatialHash.
+    SpatialHash* spatial_owner = nullptr;
+    int spatial_bucket = -1;
+    uint32_t spatial_slot = 0;
+    // Same for the hash's draw-position buckets (SpatialHash::forEachInDrawRect)
+    int draw_bucket = -1;
+    uint32_t draw_slot = 0;
+    // Index in grid->entities when a view last numbered them; views check it
+    // against the vector before trusting it to order culled entities.
+    uint32_t render_order = 0;
     PyObject* step_callback = nullptr; // #299: callback for grid.step() turn management
     int default_behavior = 0; // #299: BehaviorType::IDLE - behavior to revert to after DONE
     EntityBehavior behavior; // #300: behavior state for grid.step()
@@ -111,23 +133,19 @@ public:
 
     // #303 - Per-entity FOV result cache for TARGET trigger optimization
     // Caches the visibility bitmap from the last FOV computation so that
-    // entities that haven't moved skip recomputation entirely.
+    // entities that haven't moved skip recomputation entirely. The bitmap is
+    // FOVEngine's packed window, so it can be filled on a worker thread.
     struct TargetFOVCache {
         sf::Vector2i origin{-1, -1};
         int radius = -1;
         uint32_t transparency_gen = 0;
-        std::vector<bool> visibility; // (2*radius+1)^2 bitmap
-        int vis_side = 0; // 2*radius+1
+        FOVEngine::VisibilityMask visibility;
+        bool filled = false;
 
         bool isValid(sf::Vector2i pos, int r, uint32_t gen) const {
-            return vis_side > 0 && pos == origin && r == radius && gen == transparency_gen;
-        }
-        bool isVisible(int x, int y) const {
-            int dx = x - origin.x + radius;
-            int dy = y - origin.y + radius;
-            if (dx < 0 || dx >= vis_side || dy < 0 || dy >= vis_side) return false;
-            return visibility[dy * vis_side + dx];
+            return filled && pos == origin && r == radius && gen == transparency_gen;
         }
+        bool isVisible(int x, int y) const { return visibility.test(x, y); }
     } target_fov_cache;
     //void render(sf::Vector2f); //override final;
 
@@ -149,9 +167,18 @@ public:
 
     // Visibility methods
     void updateVisibility();  // Update perspective_map from current FOV (#294)
+    // Second half of updateVisibility(): demote last tick's VISIBLE window and
+    // promote `fov`, which must have been computed at this entity's cell with
+    // the grid's radius/algorithm (grid.update_visibility() batches these).
+    void applyVisibility(const FOVEngine::VisibilityMask& fov);
+    // Perspective state (0/1/2) of grid cell (x, y) from whichever form is
+    // active; 0 when there is no memory yet or it is sized for another grid.
+    uint8_t perspectiveState(int x, int y) const;
     
     // Property system for animations
     bool setProperty(const std::string& name, float value);
+    // Float setter for an interned property, or nullptr (see AnimationProperty.h)
+    static AnimationProperty::FloatSetter<UIEntity> floatSetter(AnimationProperty::Id prop);
     bool setProperty(const std::string& name, int value);
     bool getProperty(const std::string& name, float& value) const;
     bool hasProperty(const std::string& name) const;
@@ -178,6 +205,8 @@ public:
     static int set_position(PyUIEntityObject* self, PyObject* value, void* closure);
     static PyObject* get_perspective_map(PyUIEntityObject* self, void* closure);
     static int set_perspective_map(PyUIEntityObject* self, PyObject* value, void* closure);
+    static PyObject* get_compact_perspective(PyUIEntityObject* self, void* closure);
+    static int set_compact_perspective(PyUIEntityObject* self, PyObject* value, void* closure);
     static PyObject* get_spritenumber(PyUIEntityObject* self, void* closure);
     static int set_spritenumber(PyUIEntityObject* self, PyObject* value, void* closure);
     // #313 - texture property (thin wrapper over the entity's own UISprite)
@@ -289,6 +318,7 @@ namespace mcrfpydef {
                             "    grid_x, grid_y (int): Integer tile coordinate components\n"
                             "    draw_pos (Vector): Fractional tile position for smooth animation\n"
                             "    perspective_map (DiscreteMap | None): 3-state per-entity FOV memory\n"
+                            "    compact_perspective (bool): Store perspective_map as bitplanes\n"
                             "    texture (Texture): Texture atlas used by the entity's sprite\n"
                             "    sprite_index (int): Current sprite index\n"
                             "    visible (bool): Visibility state\n"
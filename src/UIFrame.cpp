@@ -12,6 +12,7 @@
 #include "PyShader.h"  // #106: Shader support
 #include "PyUniformCollection.h"  // #106: Uniform collection
 #include <iostream>  // #106: for shader error output
+#include <cmath>
 #include "McRFPy_Doc.h"
 // UIDrawable methods now in UIBase.h
 
@@ -97,6 +98,41 @@ sf::FloatRect UIFrame::get_bounds() const
     return sf::FloatRect(position.x, position.y, size.x, size.y);
 }
 
+sf::FloatRect UIFrame::damage_bounds() const
+{
+    sf::FloatRect r = get_bounds();
+    float pad = std::max(0.0f, box.getOutlineThickness());
+    return sf::FloatRect(r.left - pad, r.top - pad, r.width + 2 * pad, r.height + 2 * pad);
+}
+
+bool UIFrame::bounded() const
+{
+    // Matches render(): these draw the children into a frame-sized texture
+    auto size = box.getSize();
+    bool textured = (clip_children || cache_subtree || (shader && shader->shader)) &&
+                    size.x > 0 && size.y > 0;
+    return textured || children->empty();
+}
+
+bool UIFrame::occluder_bounds(sf::FloatRect& rect) const
+{
+    if (!visible || opacity < 1.0f || rotation != 0.0f || (shader && shader->shader)) return false;
+    if (box.getFillColor().a < 255) return false;
+    // An inward outline paints over the fill's edge
+    if (box.getOutlineThickness() < 0 && box.getOutlineColor().a < 255) return false;
+    rect = get_bounds();
+    return rect.width > 0 && rect.height > 0;
+}
+
+bool UIFrame::retainable() const
+{
+    if (!UIDrawable::retainable()) return false;
+    for (const auto& child : *children) {
+        if (child && !child->retainable()) return false;
+    }
+    return true;
+}
+
 void UIFrame::move(float dx, float dy)
 {
     position.x += dx;
@@ -124,6 +160,105 @@ void UIFrame::onPositionChanged()
     box.setPosition(position);
 }
 
+bool UIFrame::redrawDamagedChildren()
+{
+#if defined(MCRF_HEADLESS) || defined(MCRF_SDL2)
+    return false;  // Clearing a hole in the raster needs sf::BlendNone
+#else
+    if (cache_needs_full || children_need_sort || damaged_children.empty()) return false;
+
+    // Old and new areas of each changed child, in whole raster pixels (1px
+    // margin for antialiased edges), merged where they overlap
+    sf::Vector2u tex_size = render_texture->getSize();
+    std::vector<sf::IntRect> rects;
+    auto addArea = [&](const sf::FloatRect& r) {
+        int x0 = std::max(0, static_cast<int>(std::floor(r.left)) - 1);
+        int y0 = std::max(0, static_cast<int>(std::floor(r.top)) - 1);
+        int x1 = std::min(static_cast<int>(tex_size.x), static_cast<int>(std::ceil(r.left + r.width)) + 1);
+        int y1 = std::min(static_cast<int>(tex_size.y), static_cast<int>(std::ceil(r.top + r.height)) + 1);
+        if (x1 > x0 && y1 > y0) rects.emplace_back(x0, y0, x1 - x0, y1 - y0);
+    };
+    size_t found = 0;
+    for (const auto& child : *children) {
+        if (std::find(damaged_children.begin(), damaged_children.end(), child.get()) == damaged_children.end()) {
+            continue;
+        }
+        // Bounds ignore rotation, origin offsets and unclipped descendants;
+        // repaint such children whole
+        if (!child->has_composited_bounds || child->rotation != 0.0f ||
+            child->origin != sf::Vector2f(0, 0) || !child->bounded()) {
+            return false;
+        }
+        addArea(child->composited_bounds);
+        addArea(child->damage_bounds());
+        ++found;
+    }
+    if (found != damaged_children.size()) return false;  // e.g. a removed child
+
+    // A child whose descendants spill outside its box could draw into any
+    // hole, and the damage_bounds() test below would not redraw it
+    for (const auto& child : *children) {
+        if (child->visible && !child->bounded()) return false;
+    }
+
+    for (bool merged = true; merged; ) {
+        merged = false;
+        for (size_t i = 0; i < rects.size() && !merged; ++i) {
+            for (size_t j = i + 1; j < rects.size(); ++j) {
+                if (!rects[i].intersects(rects[j])) continue;
+                int x0 = std::min(rects[i].left, rects[j].left);
+                int y0 = std::min(rects[i].top, rects[j].top);
+                int x1 = std::max(rects[i].left + rects[i].width, rects[j].left + rects[j].width);
+                int y1 = std::max(rects[i].top + rects[i].height, rects[j].top + rects[j].height);
+                rects[i] = sf::IntRect(x0, y0, x1 - x0, y1 - y0);
+                rects.erase(rects.begin() + j);
+                merged = true;
+                break;
+            }
+        }
+    }
+    long long area = 0;
+    for (const auto& r : rects) area += static_cast<long long>(r.width) * r.height;
+    if (rects.size() > MAX_DAMAGE_RECTS || area * 2 > static_cast<long long>(tex_size.x) * tex_size.y) {
+        return false;  // About as costly as a full rebuild
+    }
+
+    box.setPosition(0, 0);  // Same placement as the full rebuild
+    box.setOrigin(0, 0);
+    box.setRotation(0);
+    sf::RectangleShape hole;
+    hole.setFillColor(sf::Color::Transparent);
+    for (const auto& r : rects) {
+        // A view showing exactly this rect through a matching viewport draws
+        // everything at its usual pixels, clipped to the rect
+        sf::FloatRect px(static_cast<float>(r.left), static_cast<float>(r.top),
+                         static_cast<float>(r.width), static_cast<float>(r.height));
+        sf::View clip(px);
+        clip.setViewport(sf::FloatRect(px.left / tex_size.x, px.top / tex_size.y,
+                                       px.width / tex_size.x, px.height / tex_size.y));
+        render_texture->setView(clip);
+
+        hole.setPosition(px.left, px.top);
+        hole.setSize(sf::Vector2f(px.width, px.height));
+        render_texture->draw(hole, sf::BlendNone);
+        render_texture->draw(box);
+        for (const auto& child : *children) {
+            if (child->damage_bounds().intersects(px)) {
+                child->render(sf::Vector2f(0, 0), *render_texture);
+            }
+        }
+    }
+    render_texture->setView(render_texture->getDefaultView());
+    render_texture->display();
+
+    for (const auto& child : *children) {
+        child->composited_bounds = child->damage_bounds();
+    }
+    damaged_children.clear();
+    return true;
+#endif
+}
+
 void UIFrame::render(sf::Vector2f offset, sf::RenderTarget& target)
 {
     // Check visibility
@@ -162,8 +297,13 @@ void UIFrame::render(sf::Vector2f offset, sf::RenderTarget& target)
     }
 
     if (use_texture) {
-        // Update RenderTexture if dirty
-        if (use_render_texture && render_dirty) {
+        // Update RenderTexture if dirty: just the changed children's areas when
+        // that is all that changed, else everything
+        if (use_render_texture && render_dirty && redrawDamagedChildren()) {
+            render_dirty = false;
+            ++Resources::game->metrics.framePartialRecomposites;
+        } else if (use_render_texture && render_dirty) {
+            ++Resources::game->metrics.frameFullRebuilds;
             // Clear the RenderTexture
             render_texture->clear(sf::Color::Transparent);
 
@@ -183,8 +323,10 @@ void UIFrame::render(sf::Vector2f offset, sf::RenderTarget& target)
             }
 
             // Render children to RenderTexture at local coordinates
+            renderList(*children, sf::Vector2f(0, 0), *render_texture, child_batch);
             for (auto drawable : *children) {
-                drawable->render(sf::Vector2f(0, 0), *render_texture);
+                drawable->composited_bounds = drawable->damage_bounds();
+                drawable->has_composited_bounds = true;
             }
 
             // Finalize the RenderTexture
@@ -194,6 +336,8 @@ void UIFrame::render(sf::Vector2f offset, sf::RenderTarget& target)
             render_sprite.setTexture(render_texture->getTexture());
 
             render_dirty = false;
+            cache_needs_full = false;
+            damaged_children.clear();
         }
 
         // Draw the RenderTexture sprite (single blit!)
@@ -248,9 +392,7 @@ void UIFrame::render(sf::Vector2f offset, sf::RenderTarget& target)
         // Render children - note: in non-texture mode, children don't automatically
         // rotate with parent. Use clip_children=True or cache_subtree=True if you need
         // children to rotate with the frame.
-        for (auto drawable : *children) {
-            drawable->render(offset + position, target);  // Use `position` as source of truth
-        }
+        renderList(*children, offset + position, target, child_batch);  // Use `position` as source of truth
     }
 
     // Restore original colors
@@ -849,104 +991,8 @@ int UIFrame::init(PyUIFrameObject* self, PyObject* args, PyObject* kwds)
 
 // Animation property system implementation
 bool UIFrame::setProperty(const std::string& name, float value) {
-    if (name == "x") {
-        position.x = value;
-        box.setPosition(position);  // Keep box in sync
-        markCompositeDirty();  // #144 - Position change, texture still valid
-        return true;
-    } else if (name == "y") {
-        position.y = value;
-        box.setPosition(position);  // Keep box in sync
-        markCompositeDirty();  // #144 - Position change, texture still valid
-        return true;
-    } else if (name == "w") {
-        box.setSize(sf::Vector2f(value, box.getSize().y));
-        if (use_render_texture) {
-            // Need to recreate RenderTexture with new size
-            enableRenderTexture(static_cast<unsigned int>(box.getSize().x), 
-                              static_cast<unsigned int>(box.getSize().y));
-        }
-        markDirty();
-        return true;
-    } else if (name == "h") {
-        box.setSize(sf::Vector2f(box.getSize().x, value));
-        if (use_render_texture) {
-            // Need to recreate RenderTexture with new size
-            enableRenderTexture(static_cast<unsigned int>(box.getSize().x), 
-                              static_cast<unsigned int>(box.getSize().y));
-        }
-        markDirty();
-        return true;
-    } else if (name == "outline") {
-        box.setOutlineThickness(value);
-        markDirty();
-        return true;
-    } else if (name == "opacity") {
-        opacity = std::clamp(value, 0.0f, 1.0f);
-        markDirty();
-        return true;
-    } else if (name == "fill_color.r") {
-        auto color = box.getFillColor();
-        color.r = std::clamp(static_cast<int>(value), 0, 255);
-        box.setFillColor(color);
-        markDirty();
-        return true;
-    } else if (name == "fill_color.g") {
-        auto color = box.getFillColor();
-        color.g = std::clamp(static_cast<int>(value), 0, 255);
-        box.setFillColor(color);
-        markDirty();
-        return true;
-    } else if (name == "fill_color.b") {
-        auto color = box.getFillColor();
-        color.b = std::clamp(static_cast<int>(value), 0, 255);
-        box.setFillColor(color);
-        markDirty();
-        return true;
-    } else if (name == "fill_color.a") {
-        auto color = box.getFillColor();
-        color.a = std::clamp(static_cast<int>(value), 0, 255);
-        box.setFillColor(color);
-        markDirty();
-        return true;
-    } else if (name == "outline_color.r") {
-        auto color = box.getOutlineColor();
-        color.r = std::clamp(static_cast<int>(value), 0, 255);
-        box.setOutlineColor(color);
-        markDirty();
-        return true;
-    } else if (name == "outline_color.g") {
-        auto color = box.getOutlineColor();
-        color.g = std::clamp(static_cast<int>(value), 0, 255);
-        box.setOutlineColor(color);
-        markDirty();
-        return true;
-    } else if (name == "outline_color.b") {
-        auto color = box.getOutlineColor();
-        color.b = std::clamp(static_cast<int>(value), 0, 255);
-        box.setOutlineColor(color);
-        markDirty();
-        return true;
-    } else if (name == "outline_color.a") {
-        auto color = box.getOutlineColor();
-        color.a = std::clamp(static_cast<int>(value), 0, 255);
-        box.setOutlineColor(color);
-        markDirty();
-        return true;
-    } else if (name == "rotation") {
-        rotation = value;
-        box.setRotation(rotation);
-        markDirty();
-        return true;
-    } else if (name == "origin_x") {
-        origin.x = value;
-        box.setOrigin(origin);
-        markDirty();
-        return true;
-    } else if (name == "origin_y") {
-        origin.y = value;
-        box.setOrigin(origin);
-        markDirty();
+    if (auto set = floatSetter(AnimationProperty::lookup(name))) {
+        set(*this, value);
         return true;
     }
     // #106: Check for shader uniform properties
@@ -956,6 +1002,130 @@ bool UIFrame::setProperty(const std::string& name, float value) {
     return false;
 }
 
+AnimationProperty::FloatSetter<UIDrawable> UIFrame::floatSetter(AnimationProperty::Id prop) const {
+    using namespace AnimationProperty;
+    static const SetterTable<UIDrawable> table = [] {
+        SetterTable<UIDrawable> t;
+        t[X] = [](UIDrawable& d, float value) {
+            auto& f = static_cast<UIFrame&>(d);
+            f.position.x = value;
+            f.box.setPosition(f.position);  // Keep box in sync
+            f.markCompositeDirty();  // #144 - Position change, texture still valid
+        };
+        t[Y] = [](UIDrawable& d, float value) {
+            auto& f = static_cast<UIFrame&>(d);
+            f.position.y = value;
+            f.box.setPosition(f.position);  // Keep box in sync
+            f.markCompositeDirty();  // #144 - Position change, texture still valid
+        };
+        t[W] = [](UIDrawable& d, float value) {
+            auto& f = static_cast<UIFrame&>(d);
+            f.box.setSize(sf::Vector2f(value, f.box.getSize().y));
+            if (f.use_render_texture) {
+                // Need to recreate RenderTexture with new size
+                f.enableRenderTexture(static_cast<unsigned int>(f.box.getSize().x),
+                                      static_cast<unsigned int>(f.box.getSize().y));
+            }
+            f.markDirty();
+        };
+        t[H] = [](UIDrawable& d, float value) {
+            auto& f = static_cast<UIFrame&>(d);
+            f.box.setSize(sf::Vector2f(f.box.getSize().x, value));
+            if (f.use_render_texture) {
+                // Need to recreate RenderTexture with new size
+                f.enableRenderTexture(static_cast<unsigned int>(f.box.getSize().x),
+                                      static_cast<unsigned int>(f.box.getSize().y));
+            }
+            f.markDirty();
+        };
+        t[OUTLINE] = [](UIDrawable& d, float value) {
+            auto& f = static_cast<UIFrame&>(d);
+            f.box.setOutlineThickness(value);
+            f.markDirty();
+        };
+        t[OPACITY] = [](UIDrawable& d, float value) {
+            d.opacity = std::clamp(value, 0.0f, 1.0f);
+            d.markDirty();
+        };
+        t[FILL_COLOR_R] = [](UIDrawable& d, float value) {
+            auto& f = static_cast<UIFrame&>(d);
+            auto color = f.box.getFillColor();
+            color.r = std::clamp(static_cast<int>(value), 0, 255);
+            f.box.setFillColor(color);
+            f.markDirty();
+        };
+        t[FILL_COLOR_G] = [](UIDrawable& d, float value) {
+            auto& f = static_cast<UIFrame&>(d);
+            auto color = f.box.getFillColor();
+            color.g = std::clamp(static_cast<int>(value), 0, 255);
+            f.box.setFillColor(color);
+            f.markDirty();
+        };
+        t[FILL_COLOR_B] = [](UIDrawable& d, float value) {
+            auto& f = static_cast<UIFrame&>(d);
+            auto color = f.box.getFillColor();
+            color.b = std::clamp(static_cast<int>(value), 0, 255);
+            f.box.setFillColor(color);
+            f.markDirty();
+        };
+        t[FILL_COLOR_A] = [](UIDrawable& d, float value) {
+            auto& f = static_cast<UIFrame&>(d);
+            auto color = f.box.getFillColor();
+            color.a = std::clamp(static_cast<int>(value), 0, 255);
+            f.box.setFillColor(color);
+            f.markDirty();
+        };
+        t[OUTLINE_COLOR_R] = [](UIDrawable& d, float value) {
+            auto& f = static_cast<UIFrame&>(d);
+            auto color = f.box.getOutlineColor();
+            color.r = std::clamp(static_cast<int>(value), 0, 255);
+            f.box.setOutlineColor(color);
+            f.markDirty();
+        };
+        t[OUTLINE_COLOR_G] = [](UIDrawable& d, float value) {
+            auto& f = static_cast<UIFrame&>(d);
+            auto color = f.box.getOutlineColor();
+            color.g = std::clamp(static_cast<int>(value), 0, 255);
+            f.box.setOutlineColor(color);
+            f.markDirty();
+        };
+        t[OUTLINE_COLOR_B] = [](UIDrawable& d, float value) {
+            auto& f = static_cast<UIFrame&>(d);
+            auto color = f.box.getOutlineColor();
+            color.b = std::clamp(static_cast<int>(value), 0, 255);
+            f.box.setOutlineColor(color);
+            f.markDirty();
+        };
+        t[OUTLINE_COLOR_A] = [](UIDrawable& d, float value) {
+            auto& f = static_cast<UIFrame&>(d);
+            auto color = f.box.getOutlineColor();
+            color.a = std::clamp(static_cast<int>(value), 0, 255);
+            f.box.setOutlineColor(color);
+            f.markDirty();
+        };
+        t[ROTATION] = [](UIDrawable& d, float value) {
+            auto& f = static_cast<UIFrame&>(d);
+            f.rotation = value;
+            f.box.setRotation(f.rotation);
+            f.markDirty();
+        };
+        t[ORIGIN_X] = [](UIDrawable& d, float value) {
+            auto& f = static_cast<UIFrame&>(d);
+            f.origin.x = value;
+            f.box.setOrigin(f.origin);
+            f.markDirty();
+        };
+        t[ORIGIN_Y] = [](UIDrawable& d, float value) {
+            auto& f = static_cast<UIFrame&>(d);
+            f.origin.y = value;
+            f.box.setOrigin(f.origin);
+            f.markDirty();
+        };
+        return t;
+    }();
+    return table.get(prop);
+}
+
 bool UIFrame::setProperty(const std::string& name, const sf::Color& value) {
     if (name == "fill_color") {
         box.setFillColor(value);
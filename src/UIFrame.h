@@ -40,6 +40,10 @@ public:
     
     // Phase 1 virtual method implementations
     sf::FloatRect get_bounds() const override;
+    sf::FloatRect damage_bounds() const override;  // Includes an outward outline
+    bool bounded() const override;                  // Children clipped (or none)
+    bool occluder_bounds(sf::FloatRect& rect) const override;
+    bool retainable() const override;               // Own shader and every child's
     void move(float dx, float dy) override;
     void resize(float w, float h) override;
     void onPositionChanged() override;
@@ -62,6 +66,7 @@ public:
     
     // Animation property system
     bool setProperty(const std::string& name, float value) override;
+    AnimationProperty::FloatSetter<UIDrawable> floatSetter(AnimationProperty::Id prop) const override;
     bool setProperty(const std::string& name, const sf::Color& value) override;
     bool setProperty(const std::string& name, const sf::Vector2f& value) override;
     
@@ -70,6 +75,14 @@ public:
     bool getProperty(const std::string& name, sf::Vector2f& value) const override;
 
     bool hasProperty(const std::string& name) const override;
+
+private:
+    // Cached path: repaint only the areas of children that changed since the
+    // raster was built. False (nothing drawn) when a full rebuild is needed.
+    bool redrawDamagedChildren();
+    static constexpr size_t MAX_DAMAGE_RECTS = 8;
+
+    SpriteBatch child_batch;  // runs of children sharing a texture, one draw each
 };
 
 // Forward declaration of methods array
@@ -8,138 +8,180 @@
 #include "PyHeuristic.h"
 #include "PyDiscreteMap.h"
 #include "McRFPy_Doc.h"
+#include <algorithm>
+#include <iterator>
 
 //=============================================================================
 // DijkstraMap Implementation
 //=============================================================================
 
-DijkstraMap::DijkstraMap(TCODMap* map, int root_x, int root_y, float diag_cost)
-    : tcod_dijkstra(nullptr)
-    , tcod_map(map)
-    , root(root_x, root_y)
-    , diagonal_cost(diag_cost)
-    , map_width(map ? map->getWidth() : 0)
-    , map_height(map ? map->getHeight() : 0)
+DijkstraMap::DijkstraMap(const std::shared_ptr<GridData>& grid, int root_x, int root_y, float diag_cost)
+    : DijkstraMap(grid, std::vector<sf::Vector2i>{sf::Vector2i(root_x, root_y)}, diag_cost)
 {
-    roots.push_back(sf::Vector2i(root_x, root_y));
-    if (tcod_map) {
-        tcod_dijkstra = TCOD_dijkstra_new(tcod_map->data, diagonal_cost);
-        TCOD_dijkstra_compute(tcod_dijkstra, root_x, root_y);
+}
+
+// Sorted cells blocked by entities carrying `label`, as fromLabel() sees them.
+static void labelCells(const GridData& grid, const std::string& label, std::vector<uint32_t>& out) {
+    out.clear();
+    if (label.empty() || !grid.entities) return;
+    for (const auto& entity : *grid.entities) {
+        if (!entity || !entity->labels.count(label)) continue;
+        int x = entity->cell_position.x;
+        int y = entity->cell_position.y;
+        if (x >= 0 && x < grid.grid_w && y >= 0 && y < grid.grid_h) {
+            out.push_back(static_cast<uint32_t>(static_cast<size_t>(y) * grid.grid_w + x));
+        }
     }
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
 }
 
-DijkstraMap::DijkstraMap(TCODMap* map, const std::vector<sf::Vector2i>& roots_in, float diag_cost)
-    : tcod_dijkstra(nullptr)
-    , tcod_map(map)
-    , root(roots_in.empty() ? sf::Vector2i(-1, -1) : roots_in.front())
-    , roots(roots_in)
+DijkstraMap::DijkstraMap(const std::shared_ptr<GridData>& grid, const std::vector<sf::Vector2i>& roots_in,
+                         float diag_cost, const std::string& collide_label, const uint8_t* weights)
+    : field(std::make_shared<Field>())
     , diagonal_cost(diag_cost)
-    , map_width(map ? map->getWidth() : 0)
-    , map_height(map ? map->getHeight() : 0)
 {
-    if (!tcod_map || roots.empty()) return;
+    Field& f = *field;
+    f.roots = roots_in;
+    f.costs = PathEngine::StepCosts::fromDiagonal(diagonal_cost);
+    f.collide_label = collide_label;
+    f.width = grid->grid_w;
+    f.height = grid->grid_h;
+    // The weight plane belongs to the caller, so a weighted map cannot be
+    // recomputed later: leave it detached.
+    if (!weights) f.grid = grid;
+    f.walkability_generation = grid->walkability_generation;
+    f.occupancy_generation = collide_label.empty() ? 0 : grid->spatial_hash.generation();
+    labelCells(*grid, collide_label, f.occupied);
+
+    auto overlay = PathEngine::OccupancyOverlay::fromLabel(*grid, collide_label);
+    auto terrain = PathEngine::Terrain::fromGrid(*grid, &overlay, weights);
+    PathEngine::computeDistances(terrain, f.costs, f.roots, f.dist);
+}
 
-    tcod_dijkstra = TCOD_dijkstra_new(tcod_map->data, diagonal_cost);
+// Repairing more than one changed cell per this many cells costs about as much
+// as starting over.
+static constexpr size_t REPAIR_CELLS_PER_CHANGE = 8;
+
+DijkstraMap::Refresh DijkstraMap::refresh() {
+    Field& f = *field;
+    auto grid = f.grid.lock();
+    if (!grid) return Refresh::DETACHED;
+
+    uint32_t occupancy = f.collide_label.empty() ? 0 : grid->spatial_hash.generation();
+    if (grid->walkability_generation == f.walkability_generation &&
+        occupancy == f.occupancy_generation) {
+        return Refresh::CURRENT;
+    }
+
+    const uint32_t* walk_changes = nullptr;
+    size_t walk_count = 0;
+    bool repairable = grid->grid_w == f.width && grid->grid_h == f.height &&
+                      grid->walkabilityChangesSince(f.walkability_generation, &walk_changes, &walk_count);
+
+    // Cells whose passability may have flipped: walkability edits, plus cells
+    // collide-label entities entered or left. Moves of other entities bump
+    // the occupancy generation too but leave the difference empty.
+    thread_local std::vector<uint32_t> changed;
+    thread_local std::vector<uint32_t> occupied;
+    changed.clear();
+    if (repairable) changed.assign(walk_changes, walk_changes + walk_count);
+    if (occupancy != f.occupancy_generation) {
+        labelCells(*grid, f.collide_label, occupied);
+        if (repairable) {
+            std::set_symmetric_difference(f.occupied.begin(), f.occupied.end(),
+                                          occupied.begin(), occupied.end(),
+                                          std::back_inserter(changed));
+        }
+        f.occupied.swap(occupied);
+    }
+    repairable = repairable && changed.size() * REPAIR_CELLS_PER_CHANGE <= f.dist.size();
 
-    if (roots.size() == 1) {
-        TCOD_dijkstra_compute(tcod_dijkstra, roots[0].x, roots[0].y);
+    auto overlay = PathEngine::OccupancyOverlay::fromLabel(*grid, f.collide_label);
+    auto terrain = PathEngine::Terrain::fromGrid(*grid, &overlay);
+    Refresh result;
+    if (repairable) {
+        PathEngine::repairDistances(terrain, f.costs, changed.data(), changed.size(), f.dist);
+        result = Refresh::REPAIRED;
     } else {
-        std::vector<int> xs, ys;
-        xs.reserve(roots.size());
-        ys.reserve(roots.size());
-        for (auto& r : roots) { xs.push_back(r.x); ys.push_back(r.y); }
-        TCOD_dijkstra_compute_multi(tcod_dijkstra,
-            static_cast<int>(roots.size()), xs.data(), ys.data());
-    }
+        f.width = grid->grid_w;
+        f.height = grid->grid_h;
+        PathEngine::computeDistances(terrain, f.costs, f.roots, f.dist);
+        result = Refresh::RECOMPUTED;
+    }
+    f.walkability_generation = grid->walkability_generation;
+    f.occupancy_generation = occupancy;
+    f.farthest_valid = false;
+    return result;
 }
 
-DijkstraMap::~DijkstraMap() {
-    if (tcod_dijkstra) {
-        TCOD_dijkstra_delete(tcod_dijkstra);
-        tcod_dijkstra = nullptr;
+uint32_t DijkstraMap::farthest() const {
+    Field& f = *field;
+    if (!f.farthest_valid) {
+        f.farthest = 0;
+        for (uint32_t d : f.dist) {
+            if (d != PathEngine::UNREACHABLE) f.farthest = std::max(f.farthest, d);
+        }
+        f.farthest_valid = true;
     }
+    return f.farthest;
 }
 
 float DijkstraMap::getDistance(int x, int y) const {
-    if (!tcod_dijkstra) return -1.0f;
-    return TCOD_dijkstra_get_distance(tcod_dijkstra, x, y);
+    if (x < 0 || y < 0 || x >= field->width || y >= field->height) return -1.0f;
+    uint32_t d = field->dist[static_cast<size_t>(y) * field->width + x];
+    if (d == PathEngine::UNREACHABLE) return -1.0f;
+    // Inverted: the farthest cells become the new minima, so descending the
+    // view flees the original roots.
+    if (inverted_view) d = farthest() - d;
+    return static_cast<float>(d) / PathEngine::COST_SCALE;
 }
 
 // #375: emit the path in origin->destination order, matching find_path()'s convention
-// (excludes the origin, includes the root).
-//
-// libtcod builds its internal list as [pos, ..., root_adjacent] and
-// TCOD_dijkstra_path_walk() pops from the BACK, so walking yields
-// [root_adjacent, ..., pos] -- the exact reverse of what path_from's docstring,
-// AStarPath.origin/.destination, and step_from all promise. stepFrom() inherited the
-// error and returned a cell adjacent to the ROOT rather than to the query position,
-// i.e. an arbitrarily long teleport.
+// (excludes the origin, includes the root). Built by steepest descent, so each step is
+// adjacent to the previous one and the walk ends on the root it descends into (the
+// correct one for multi-root maps).
 std::vector<sf::Vector2i> DijkstraMap::getPathFrom(int x, int y) const {
     std::vector<sf::Vector2i> path;
-    if (!tcod_dijkstra) return path;
-
-    if (TCOD_dijkstra_path_set(tcod_dijkstra, x, y)) {
-        int px, py;
-        while (TCOD_dijkstra_path_walk(tcod_dijkstra, &px, &py)) {
-            path.push_back(sf::Vector2i(px, py));
-        }
+    sf::Vector2i cur(x, y);
+    sf::Vector2i next;
+    bool valid = false;
+    // Distances strictly decrease along the walk, so it always terminates.
+    for (next = descentStep(cur.x, cur.y, &valid); valid; next = descentStep(cur.x, cur.y, &valid)) {
+        path.push_back(next);
+        cur = next;
     }
-    if (path.empty()) return path;  // already at a root, or unreachable
-
-    std::reverse(path.begin(), path.end());  // -> [pos, ..., root_adjacent]
-    path.erase(path.begin());                // drop the origin
-
-    // The walk stops one cell short of the root. Append the root this path descends
-    // into -- via descentStep, so the multi-root case lands on the correct root.
-    bool ok = false;
-    sf::Vector2i last = path.empty() ? sf::Vector2i(x, y) : path.back();
-    sf::Vector2i root_cell = descentStep(last.x, last.y, &ok);
-    if (ok) path.push_back(root_cell);
-
     return path;
 }
 
 sf::Vector2i DijkstraMap::stepFrom(int x, int y, bool* valid) const {
-    if (!tcod_dijkstra) {
-        if (valid) *valid = false;
-        return sf::Vector2i(-1, -1);
-    }
-
-    // #375: the first cell of the corrected path -- guaranteed adjacent to (x, y).
-    std::vector<sf::Vector2i> path = getPathFrom(x, y);
-    if (!path.empty()) {
-        if (valid) *valid = true;
-        return path.front();
-    }
-
-    if (valid) *valid = false;
-    return sf::Vector2i(-1, -1);
+    // #375: the first cell of the path -- guaranteed adjacent to (x, y).
+    return descentStep(x, y, valid);
 }
 
 void DijkstraMap::invertInPlace() {
-    if (tcod_dijkstra) {
-        TCOD_dijkstra_invert(tcod_dijkstra);
-    }
+    inverted_view = !inverted_view;
 }
 
 std::shared_ptr<DijkstraMap> DijkstraMap::inverted() const {
-    // Recompute from the stored roots, then invert. This preserves the invariant that
-    // the original's distance field is unchanged.
-    auto copy = std::make_shared<DijkstraMap>(tcod_map, roots, diagonal_cost);
-    copy->invertInPlace();
-    return copy;
+    std::shared_ptr<DijkstraMap> view(new DijkstraMap());
+    view->field = field;
+    view->inverted_view = !inverted_view;
+    view->diagonal_cost = diagonal_cost;
+    return view;
 }
 
 sf::Vector2i DijkstraMap::descentStep(int x, int y, bool* valid) const {
-    if (!tcod_dijkstra) {
-        if (valid) *valid = false;
-        return sf::Vector2i(-1, -1);
-    }
-    int out_x = -1, out_y = -1;
-    bool ok = TCOD_dijkstra_get_descent(tcod_dijkstra, x, y, &out_x, &out_y);
+    // Descending (farthest - d) is ascending d, which needs no farthest().
+    const Field& f = *field;
+    sf::Vector2i out(-1, -1);
+    int neighbors = f.costs.neighborCount();
+    bool ok = inverted_view
+        ? PathEngine::ascend(f.dist, f.width, f.height, neighbors, x, y, &out)
+        : PathEngine::descend(f.dist, f.width, f.height, neighbors, x, y, &out);
     if (valid) *valid = ok;
     if (!ok) return sf::Vector2i(-1, -1);
-    return sf::Vector2i(out_x, out_y);
+    return out;
 }
 
 //=============================================================================
@@ -355,9 +397,8 @@ PyObject* UIGridPathfinding::DijkstraMap_repr(PyDijkstraMapObject* self) {
     return PyUnicode_FromFormat("<DijkstraMap root=(%d,%d)>", root.x, root.y);
 }
 
-// #311: Reject out-of-bounds coordinates at the Python boundary. TCOD's
-// dijkstra routines assert and abort() the process for invalid coords, so
-// catching them here turns a fatal crash into a recoverable IndexError.
+// #311: Reject out-of-bounds coordinates at the Python boundary so they surface
+// as a recoverable IndexError rather than a silent None.
 static bool dijkstra_bounds_check(DijkstraMap* dmap, int x, int y) {
     int w = dmap->getWidth();
     int h = dmap->getHeight();
@@ -382,6 +423,7 @@ PyObject* UIGridPathfinding::DijkstraMap_distance(PyDijkstraMapObject* self, PyO
         PyErr_SetString(PyExc_RuntimeError, "DijkstraMap is invalid");
         return NULL;
     }
+    self->data->refresh();  // follow walkability edits since the last query
 
     int x, y;
     if (!ExtractPosition(pos_obj, &x, &y, nullptr, "pos")) {
@@ -410,6 +452,7 @@ PyObject* UIGridPathfinding::DijkstraMap_path_from(PyDijkstraMapObject* self, Py
         PyErr_SetString(PyExc_RuntimeError, "DijkstraMap is invalid");
         return NULL;
     }
+    self->data->refresh();
 
     int x, y;
     if (!ExtractPosition(pos_obj, &x, &y, nullptr, "pos")) {
@@ -445,6 +488,7 @@ PyObject* UIGridPathfinding::DijkstraMap_step_from(PyDijkstraMapObject* self, Py
         PyErr_SetString(PyExc_RuntimeError, "DijkstraMap is invalid");
         return NULL;
     }
+    self->data->refresh();
 
     int x, y;
     if (!ExtractPosition(pos_obj, &x, &y, nullptr, "pos")) {
@@ -498,6 +542,7 @@ PyObject* UIGridPathfinding::DijkstraMap_descent_step(PyDijkstraMapObject* self,
         PyErr_SetString(PyExc_RuntimeError, "DijkstraMap is invalid");
         return nullptr;
     }
+    self->data->refresh();
     int x, y;
     if (!ExtractPosition(pos_obj, &x, &y, nullptr, "pos")) {
         return nullptr;
@@ -527,6 +572,7 @@ PyObject* UIGridPathfinding::DijkstraMap_to_heightmap(PyDijkstraMapObject* self,
         PyErr_SetString(PyExc_RuntimeError, "DijkstraMap is invalid");
         return nullptr;
     }
+    self->data->refresh();
 
     // Determine output size (default to dijkstra dimensions)
     int width = self->data->getWidth();
@@ -587,59 +633,45 @@ PyObject* UIGridPathfinding::DijkstraMap_to_heightmap(PyDijkstraMapObject* self,
 // Grid Factory Methods
 //=============================================================================
 
-// Helper: collect cells occupied by entities with a given label, mark non-walkable.
-// Returns the list of (x, y, was_walkable) for restoration.
-static std::vector<std::tuple<int,int,bool>> markCollisionLabel(
-    GridData* grid, const std::string& collide_label)
-{
-    std::vector<std::tuple<int,int,bool>> restore_list;
-    if (!grid->entities || collide_label.empty()) return restore_list;
-
-    TCODMap* tcod_map = grid->getTCODMap();
-    if (!tcod_map) return restore_list;
-
-    for (auto& entity : *grid->entities) {
-        if (!entity) continue;
-        if (entity->labels.count(collide_label)) {
-            int ex = entity->cell_position.x;
-            int ey = entity->cell_position.y;
-            if (ex >= 0 && ex < grid->grid_w && ey >= 0 && ey < grid->grid_h) {
-                bool was_walkable = tcod_map->isWalkable(ex, ey);
-                if (was_walkable) {
-                    tcod_map->setProperties(ex, ey, tcod_map->isTransparent(ex, ey), false);
-                    restore_list.emplace_back(ex, ey, true);
-                }
-            }
-        }
+// Resolve the optional `weights` argument: a grid-sized DiscreteMap whose cell
+// values multiply the cost of entering that cell (0 = impassable). Returns
+// true with *out = nullptr when no weights were given.
+static bool resolveWeights(PyObject* weights_obj, GridData* grid, const uint8_t** out) {
+    *out = nullptr;
+    if (!weights_obj || weights_obj == Py_None) return true;
+    if (!PyObject_IsInstance(weights_obj, (PyObject*)&mcrfpydef::PyDiscreteMapType)) {
+        PyErr_SetString(PyExc_TypeError, "weights must be a DiscreteMap or None");
+        return false;
     }
-    return restore_list;
-}
-
-// Helper: restore walkability after pathfinding.
-static void restoreCollisionLabel(GridData* grid,
-    const std::vector<std::tuple<int,int,bool>>& restore_list)
-{
-    TCODMap* tcod_map = grid->getTCODMap();
-    if (!tcod_map) return;
-
-    for (auto& [x, y, was_walkable] : restore_list) {
-        tcod_map->setProperties(x, y, tcod_map->isTransparent(x, y), was_walkable);
+    auto* dmap = (PyDiscreteMapObject*)weights_obj;
+    if (!dmap->data) {
+        PyErr_SetString(PyExc_RuntimeError, "DiscreteMap is invalid");
+        return false;
+    }
+    if (dmap->data->width() != grid->grid_w || dmap->data->height() != grid->grid_h) {
+        PyErr_Format(PyExc_ValueError,
+            "weights size (%dx%d) does not match grid size (%dx%d)",
+            dmap->data->width(), dmap->data->height(), grid->grid_w, grid->grid_h);
+        return false;
     }
+    *out = dmap->data->data();
+    return true;
 }
 
 PyObject* UIGridPathfinding::Grid_find_path(PyGridDataObject* self, PyObject* args, PyObject* kwds) {
     static const char* kwlist[] = {"start", "end", "diagonal_cost", "collide",
-                                   "heuristic", "weight", NULL};
+                                   "heuristic", "weight", "weights", NULL};
     PyObject* start_obj = NULL;
     PyObject* end_obj = NULL;
     float diagonal_cost = 1.41f;
     const char* collide_label = NULL;
     PyObject* heuristic_obj = NULL;
     float heuristic_weight = 1.0f;
+    PyObject* weights_obj = NULL;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwds, "OO|fzOf", const_cast<char**>(kwlist),
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "OO|fzOfO", const_cast<char**>(kwlist),
                                      &start_obj, &end_obj, &diagonal_cost, &collide_label,
-                                     &heuristic_obj, &heuristic_weight)) {
+                                     &heuristic_obj, &heuristic_weight, &weights_obj)) {
         return NULL;
     }
 
@@ -669,60 +701,57 @@ PyObject* UIGridPathfinding::Grid_find_path(PyGridDataObject* self, PyObject* ar
     }
 
     // Resolve heuristic selection before any allocations so we fail fast on bad args.
-    TCOD_heuristic_func_t heuristic_func = nullptr;
+    // None keeps the default (Euclidean) while still honoring weight.
+    auto heuristic = PathEngine::Heuristic::EUCLIDEAN;
+    bool hierarchical = false;
     if (heuristic_obj && heuristic_obj != Py_None) {
         int hval = 0;
         if (!PyHeuristic::from_arg(heuristic_obj, &hval)) {
             return NULL;
         }
-        heuristic_func = PyHeuristic::get_function(hval);
+        if (hval == PyHeuristic::HIERARCHICAL) {
+            hierarchical = true;
+        } else {
+            heuristic = static_cast<PathEngine::Heuristic>(hval);
+        }
     }
 
-    // Mark-and-restore: temporarily block cells occupied by entities with collide label
-    std::string label_str = collide_label ? collide_label : "";
-    auto restore_list = markCollisionLabel(self->data.get(), label_str);
-
-    TCODMap* tcmap = self->data->getTCODMap();
-
-    // Build path handle. Use C API so we can set the heuristic/weight when requested.
-    TCOD_path_t tcod_path = TCOD_path_new_using_map(tcmap->data, diagonal_cost);
-    if (heuristic_func || heuristic_weight != 1.0f) {
-        // Passing null heuristic_func keeps the default (Euclidean) while still allowing
-        // weight override; non-null installs the chosen built-in.
-        TCOD_path_set_heuristic(tcod_path, heuristic_func, heuristic_weight);
+    const uint8_t* weights = nullptr;
+    if (!resolveWeights(weights_obj, self->data.get(), &weights)) {
+        return NULL;
     }
 
-    bool found = TCOD_path_compute(tcod_path, x1, y1, x2, y2);
-
-    // Restore walkability before returning
-    restoreCollisionLabel(self->data.get(), restore_list);
-
+    // Cells occupied by entities with the collide label are blocked through a
+    // read-only overlay; the grid itself is never modified.
+    std::string label_str = collide_label ? collide_label : "";
+    auto overlay = PathEngine::OccupancyOverlay::fromLabel(*self->data, label_str);
+    auto terrain = PathEngine::Terrain::fromGrid(*self->data, &overlay, weights);
+
+    std::vector<sf::Vector2i> steps;
+    auto costs = PathEngine::StepCosts::fromDiagonal(diagonal_cost);
+    bool found;
+    if (hierarchical) {
+        // The GIL stays held: sync() rebuilds cluster state from the
+        // walkability planes, which Python code may otherwise edit mid-query.
+        GridData& grid = *self->data;
+        grid.hpa_graph.sync(grid, costs);
+        found = grid.hpa_graph.findPath(terrain, sf::Vector2i(x1, y1), sf::Vector2i(x2, y2), steps);
+    } else {
+        found = PathEngine::findPath(terrain, costs, sf::Vector2i(x1, y1), sf::Vector2i(x2, y2),
+                                     heuristic, heuristic_weight, steps);
+    }
     if (!found) {
-        TCOD_path_delete(tcod_path);
         Py_RETURN_NONE;
     }
 
     PyAStarPathObject* result = (PyAStarPathObject*)mcrfpydef::PyAStarPathType.tp_alloc(
         &mcrfpydef::PyAStarPathType, 0);
-    if (!result) {
-        TCOD_path_delete(tcod_path);
-        return NULL;
-    }
+    if (!result) return NULL;
 
-    new (&result->path) std::vector<sf::Vector2i>();
+    new (&result->path) std::vector<sf::Vector2i>(std::move(steps));
     result->current_index = 0;
     result->origin = sf::Vector2i(x1, y1);
     result->destination = sf::Vector2i(x2, y2);
-
-    int size = TCOD_path_size(tcod_path);
-    result->path.reserve(size);
-    for (int i = 0; i < size; i++) {
-        int px, py;
-        TCOD_path_get(tcod_path, i, &px, &py);
-        result->path.push_back(sf::Vector2i(px, py));
-    }
-
-    TCOD_path_delete(tcod_path);
     return (PyObject*)result;
 }
 
@@ -813,14 +842,16 @@ static bool collectRoots(PyObject* root_obj, GridData* grid,
 }
 
 PyObject* UIGridPathfinding::Grid_get_dijkstra_map(PyGridDataObject* self, PyObject* args, PyObject* kwds) {
-    static const char* kwlist[] = {"root", "diagonal_cost", "collide", "roots", NULL};
+    static const char* kwlist[] = {"root", "diagonal_cost", "collide", "roots", "weights", NULL};
     PyObject* root_obj = NULL;
     PyObject* roots_obj = NULL;
     float diagonal_cost = 1.41f;
     const char* collide_label = NULL;
+    PyObject* weights_obj = NULL;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|OfzO", const_cast<char**>(kwlist),
-                                     &root_obj, &diagonal_cost, &collide_label, &roots_obj)) {
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|OfzOO", const_cast<char**>(kwlist),
+                                     &root_obj, &diagonal_cost, &collide_label, &roots_obj,
+                                     &weights_obj)) {
         return NULL;
     }
 
@@ -848,33 +879,33 @@ PyObject* UIGridPathfinding::Grid_get_dijkstra_map(PyGridDataObject* self, PyObj
         return NULL;
     }
 
-    std::string label_str = collide_label ? collide_label : "";
+    const uint8_t* weights = nullptr;
+    if (!resolveWeights(weights_obj, self->data.get(), &weights)) {
+        return NULL;
+    }
 
-    // Cache path for the common single-root case (preserves prior behavior).
-    if (!mask_obj && roots.size() == 1) {
-        auto key = std::make_tuple(roots[0].x, roots[0].y, label_str);
-        auto it = self->data->dijkstra_maps.find(key);
-        if (it != self->data->dijkstra_maps.end()) {
-            if (std::abs(it->second->getDiagonalCost() - diagonal_cost) < 0.001f) {
-                PyDijkstraMapObject* result = (PyDijkstraMapObject*)mcrfpydef::PyDijkstraMapType.tp_alloc(
-                    &mcrfpydef::PyDijkstraMapType, 0);
-                if (!result) return NULL;
-                new (&result->data) std::shared_ptr<DijkstraMap>(it->second);
-                return (PyObject*)result;
-            }
-            self->data->dijkstra_maps.erase(it);
+    std::string label_str = collide_label ? collide_label : "";
+    // Weighted maps are not cached: the key does not capture the weight plane.
+    bool cacheable = !mask_obj && roots.size() == 1 && !weights;
+
+    // Cache path for the common single-root case. A hit is refreshed against
+    // the grid first, so walkability edits since it was cached are repaired.
+    DijkstraCache::Key cache_key;
+    if (cacheable) {
+        cache_key = std::make_tuple(roots[0].x, roots[0].y, label_str);
+        if (auto cached = self->data->dijkstra_maps.find(cache_key, diagonal_cost)) {
+            PyDijkstraMapObject* result = (PyDijkstraMapObject*)mcrfpydef::PyDijkstraMapType.tp_alloc(
+                &mcrfpydef::PyDijkstraMapType, 0);
+            if (!result) return NULL;
+            new (&result->data) std::shared_ptr<DijkstraMap>(cached);
+            return (PyObject*)result;
         }
     }
 
-    auto restore_list = markCollisionLabel(self->data.get(), label_str);
-
     std::shared_ptr<DijkstraMap> dijkstra;
-    TCODMap* tcmap = self->data->getTCODMap();
 
     if (mask_obj) {
-        // Translate mask -> explicit root list, then drive compute_multi. Distance-only
-        // results are identical to compute_masked; this keeps DijkstraMap's invariant
-        // that it always holds exactly one computed TCOD_Dijkstra handle.
+        // Translate mask -> explicit root list for the multi-source search.
         std::vector<sf::Vector2i> mask_roots;
         const uint8_t* buf = mask_obj->data->data();
         int w = mask_obj->data->width();
@@ -888,21 +919,19 @@ PyObject* UIGridPathfinding::Grid_get_dijkstra_map(PyGridDataObject* self, PyObj
             }
         }
         if (mask_roots.empty()) {
-            restoreCollisionLabel(self->data.get(), restore_list);
             PyErr_SetString(PyExc_ValueError, "DiscreteMap mask has no non-zero cells");
             return NULL;
         }
-        dijkstra = std::make_shared<DijkstraMap>(tcmap, mask_roots, diagonal_cost);
+        dijkstra = std::make_shared<DijkstraMap>(self->data, mask_roots, diagonal_cost,
+                                                 label_str, weights);
     } else {
-        dijkstra = std::make_shared<DijkstraMap>(tcmap, roots, diagonal_cost);
+        dijkstra = std::make_shared<DijkstraMap>(self->data, roots, diagonal_cost,
+                                                 label_str, weights);
     }
 
-    restoreCollisionLabel(self->data.get(), restore_list);
-
     // Cache only single-root case
-    if (!mask_obj && roots.size() == 1) {
-        auto key = std::make_tuple(roots[0].x, roots[0].y, label_str);
-        self->data->dijkstra_maps[key] = dijkstra;
+    if (cacheable) {
+        self->data->dijkstra_maps.insert(cache_key, dijkstra);
     }
 
     PyDijkstraMapObject* result = (PyDijkstraMapObject*)mcrfpydef::PyDijkstraMapType.tp_alloc(
@@ -1062,7 +1091,7 @@ PyMethodDef PyDijkstraMap_methods[] = {
     {"invert", (PyCFunction)UIGridPathfinding::DijkstraMap_invert, METH_NOARGS,
      MCRF_METHOD(DijkstraMap, invert,
          MCRF_SIG("()", "DijkstraMap"),
-         MCRF_DESC("Return a new DijkstraMap whose distance field is inverted (safety field). Cells near a root become high values; descend to flee from original roots. The original DijkstraMap is unchanged.")
+         MCRF_DESC("Return a new DijkstraMap whose distance field is inverted (safety field). Cells near a root become high values; descend to flee from original roots. The original DijkstraMap is unchanged; both share one field and follow later walkability edits.")
          MCRF_RETURNS("New DijkstraMap with inverted distances")
      )},
 
@@ -1099,8 +1128,10 @@ PyTypeObject PyDijkstraMapType = {
         "A Dijkstra distance map from a fixed root position.\n\n"
         "Created by Grid.get_dijkstra_map(). Cannot be instantiated directly.\n\n"
         "Grid caches these maps - multiple requests for the same root return\n"
-        "the same map. Call Grid.clear_dijkstra_maps() after changing grid\n"
-        "walkability to invalidate the cache.\n\n"
+        "the same map. Maps follow the grid: after walkability edits, or moves\n"
+        "of collide-labelled entities, the next query repairs only the affected\n"
+        "region. Maps built with weights are fixed snapshots. The\n"
+        "cache is LRU-bounded by Grid.dijkstra_cache_budget bytes.\n\n"
         "Properties:\n"
         "    root (Vector): Root position (read-only)\n\n"
         "Methods:\n"
@@ -2,10 +2,11 @@
 #include "Common.h"
 #include "Python.h"
 #include "UIBase.h"  // For PyGridDataObject typedef
-#include <libtcod.h>
+#include "PathEngine.h"
 #include <vector>
 #include <memory>
 #include <map>
+#include <string>
 
 // Forward declarations
 class GridData;
@@ -26,55 +27,97 @@ struct PyAStarPathObject {
 // DijkstraMap - A Dijkstra distance field from a fixed root
 //=============================================================================
 
+// Computed natively by PathEngine over the grid's walkable plane. Unweighted
+// maps stay attached to their grid: refresh() brings the field up to date
+// after walkability edits and collide-label moves, repairing only the region
+// the changes affect when the grid's change log still covers them. Weighted maps (and maps whose grid
+// is gone) are fixed snapshots.
 class DijkstraMap {
 public:
     // Single-root construction (back-compat).
-    DijkstraMap(TCODMap* map, int root_x, int root_y, float diagonal_cost);
+    DijkstraMap(const std::shared_ptr<GridData>& grid, int root_x, int root_y, float diagonal_cost);
 
-    // Multi-root construction (#315). roots must be non-empty.
-    DijkstraMap(TCODMap* map, const std::vector<sf::Vector2i>& roots, float diagonal_cost);
+    // Multi-root construction (#315). roots must be non-empty. Entities
+    // carrying `collide_label` block their cells; `weights` is an optional
+    // per-cell entry-cost plane (grid-sized, 0 = impassable), read only here.
+    DijkstraMap(const std::shared_ptr<GridData>& grid, const std::vector<sf::Vector2i>& roots,
+                float diagonal_cost, const std::string& collide_label = "",
+                const uint8_t* weights = nullptr);
 
-    ~DijkstraMap();
-
-    // Non-copyable (owns TCOD_Dijkstra)
+    // Non-copyable (maps are shared via shared_ptr)
     DijkstraMap(const DijkstraMap&) = delete;
     DijkstraMap& operator=(const DijkstraMap&) = delete;
 
+    enum class Refresh { CURRENT, REPAIRED, RECOMPUTED, DETACHED };
+
+    // Bring the field up to date with the grid. Walkability edits, and for
+    // collide maps the cells labelled entities entered or left, are repaired
+    // in place; a resize, an overflowed change log, or too many changed cells
+    // recomputes it. Shared with every inverted() view. Main
+    // thread only - queries below never refresh, so worker threads may read.
+    Refresh refresh();
+
     // Queries
     float getDistance(int x, int y) const;
     std::vector<sf::Vector2i> getPathFrom(int x, int y) const;
     sf::Vector2i stepFrom(int x, int y, bool* valid = nullptr) const;
 
     // Phase B: FLEE primitives (#315)
-    // invertInPlace() mutates this map's distance field. Prefer inverted() in new code —
-    // the Python surface exposes the non-mutating form to keep maps immutable after
-    // creation.
+    // invertInPlace() flips this map between the distance field and its
+    // inverse. Prefer inverted() in new code - the Python surface exposes the
+    // non-mutating form.
     void invertInPlace();
-    // Returns a freshly computed DijkstraMap with the same roots and diagonal_cost,
-    // then inverts its distance field. The caller owns the returned shared_ptr.
+    // Returns a view of the same field with distances inverted: reachable
+    // cells read (farthest - d), so descending it flees the roots. Views share
+    // the field, so a refresh() of either updates both. The caller owns the
+    // returned shared_ptr.
     std::shared_ptr<DijkstraMap> inverted() const;
     // descent_step returns the next cell along steepest descent, or (-1,-1) + valid=false.
     sf::Vector2i descentStep(int x, int y, bool* valid = nullptr) const;
 
     // Accessors
-    sf::Vector2i getRoot() const { return root; }  // First root for multi-root
-    const std::vector<sf::Vector2i>& getRoots() const { return roots; }
-    bool isMultiRoot() const { return roots.size() > 1; }
+    sf::Vector2i getRoot() const { return field->roots.empty() ? sf::Vector2i(-1, -1) : field->roots.front(); }  // First root for multi-root
+    const std::vector<sf::Vector2i>& getRoots() const { return field->roots; }
+    bool isMultiRoot() const { return field->roots.size() > 1; }
+    bool isInverted() const { return inverted_view; }
     float getDiagonalCost() const { return diagonal_cost; }
-    int getWidth() const { return map_width; }
-    int getHeight() const { return map_height; }
+    int getWidth() const { return field->width; }
+    int getHeight() const { return field->height; }
+    // Entities carrying this label block the field; empty if none do.
+    const std::string& getCollideLabel() const { return field->collide_label; }
 
-    // Raw C handle, for internal use in new constructor paths (e.g. from_invert).
-    TCOD_Dijkstra* getHandle() const { return tcod_dijkstra; }
+    // Raw fixed-point field (PathEngine::COST_SCALE per orthogonal step,
+    // PathEngine::UNREACHABLE for unreached cells), row-major. Always the
+    // un-inverted distances.
+    const std::vector<uint32_t>& distances() const { return field->dist; }
 
 private:
-    TCOD_Dijkstra* tcod_dijkstra;  // Owned
-    TCODMap* tcod_map;             // Borrowed from Grid
-    sf::Vector2i root;
-    std::vector<sf::Vector2i> roots;
-    float diagonal_cost;
-    int map_width;
-    int map_height;
+    // State shared between a map and its inverted views.
+    struct Field {
+        std::vector<uint32_t> dist;
+        std::vector<sf::Vector2i> roots;
+        PathEngine::StepCosts costs;
+        std::string collide_label;
+        int width = 0;
+        int height = 0;
+
+        std::weak_ptr<GridData> grid;  // empty for fixed snapshots
+        uint32_t walkability_generation = 0;
+        uint32_t occupancy_generation = 0;
+        std::vector<uint32_t> occupied;  // sorted cells collide_label blocked
+
+        // Largest reachable distance, for inverted views; found lazily after
+        // each compute or repair (main thread only, like refresh()).
+        uint32_t farthest = 0;
+        bool farthest_valid = false;
+    };
+
+    DijkstraMap() = default;  // for inverted()
+    uint32_t farthest() const;
+
+    std::shared_ptr<Field> field;
+    bool inverted_view = false;
+    float diagonal_cost = 1.41f;
 };
 
 struct PyDijkstraMapObject {
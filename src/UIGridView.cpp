@@ -188,6 +188,187 @@ void UIGridView::center_camera(float tile_x, float tile_y)
     center_y = tile_y * ch;
 }
 
+void UIGridView::collectVisibleEntities(float x0, float y0, float x1, float y1)
+{
+    visible_entities.clear();
+    auto& entities = *grid_data->entities;
+    auto inside = [&](const UIEntity& e) {
+        return e.position.x >= x0 && e.position.x < x1 &&
+               e.position.y >= y0 && e.position.y < y1;
+    };
+
+    // Entities listed but not hashed (or the reverse) would be missed by the
+    // bucket query; walk the list as before.
+    if (grid_data->spatial_hash.size() != entities.size()) {
+        for (auto& e : entities) {
+            if (inside(*e)) visible_entities.push_back(e.get());
+        }
+        return;
+    }
+
+    bool order_valid = true;
+    grid_data->spatial_hash.forEachInDrawRect(x0, y0, x1, y1, [&](UIEntity& e) {
+        if (!inside(e)) return;
+        visible_entities.push_back(&e);
+        if (e.render_order >= entities.size() || entities[e.render_order].get() != &e)
+            order_valid = false;
+    });
+    // Draw order is list order. render_order is renumbered only after the list
+    // itself changed, so steady-state frames stay O(visible).
+    if (!order_valid) {
+        for (size_t i = 0; i < entities.size(); ++i)
+            entities[i]->render_order = static_cast<uint32_t>(i);
+    }
+    std::sort(visible_entities.begin(), visible_entities.end(),
+              [](const UIEntity* a, const UIEntity* b) { return a->render_order < b->render_order; });
+}
+
+// Layers, entities and layers again for the tile window [left_edge,
+// left_edge + width_sq) x [top_edge, top_edge + height_sq), drawn at the
+// camera given by left/top_spritepixels. render() passes the whole viewport,
+// or one damaged rectangle's tiles.
+void UIGridView::drawContent(sf::RenderTarget& target, int left_spritepixels, int top_spritepixels,
+                             float left_edge, float top_edge, float width_sq, float height_sq,
+                             int cell_width, int cell_height)
+{
+    auto& metrics = Resources::game->metrics;
+    int x_limit = left_edge + width_sq + 2;
+    if (x_limit > grid_data->grid_w) x_limit = grid_data->grid_w;
+    int y_limit = top_edge + height_sq + 2;
+    if (y_limit > grid_data->grid_h) y_limit = grid_data->grid_h;
+
+    // Cells actually inside the viewport window, per layer drawn.
+    const int x_start = std::max(0, static_cast<int>(left_edge));
+    const int y_start = std::max(0, static_cast<int>(top_edge));
+    const int visible_cells = std::max(0, x_limit - x_start) * std::max(0, y_limit - y_start);
+
+    // Chunk cache traffic of this draw, from the cache's running totals
+    auto& chunk_cache = ChunkCache::get();
+    const uint64_t hits0 = chunk_cache.hits, misses0 = chunk_cache.misses;
+    const uint64_t evictions0 = chunk_cache.evictions;
+
+    // Render layers below entities (z_index <= 0)
+    grid_data->sortLayers();
+    int layers_drawn = 0;
+    for (auto& layer : grid_data->layers) {
+        if (layer->z_index > 0) break;  // #257: z_index=0 is ground level (below entities)
+        layer->render(target, left_spritepixels, top_spritepixels,
+                     left_edge, top_edge, x_limit, y_limit, zoom, cell_width, cell_height);
+        ++layers_drawn;
+    }
+
+    // Render entities
+    if (grid_data->entities) {
+        ScopedAccumTimer entityTimer(metrics.entityRenderTime);
+        // Entities anchored outside the window can still draw into it
+        float margin = 2.f;
+        float reach = grid_data->entityReach();
+        if (std::isfinite(reach)) margin += std::ceil(reach);
+        collectVisibleEntities(left_edge - margin, top_edge - margin,
+                               left_edge + width_sq + margin, top_edge + height_sq + margin);
+        entity_batch.begin(target);
+        int own_draws = 0;
+        for (UIEntity* e : visible_entities) {
+            auto& drawent = e->sprite;
+            drawent.setScale(sf::Vector2f(zoom, zoom));
+            auto pixel_pos = sf::Vector2f(
+                (e->position.x*cell_width - left_spritepixels + e->sprite_offset.x) * zoom,
+                (e->position.y*cell_height - top_spritepixels + e->sprite_offset.y) * zoom);
+            // #237: composite entities draw their sprite_grid tiles
+            const std::vector<int>* tiles = e->sprite_grid.empty() ? nullptr : &e->sprite_grid;
+            if (!drawent.addToBatch(pixel_pos, entity_batch, tiles, e->tile_width, e->tile_height)) {
+                // Shaded sprites draw alone; flush first to keep list order
+                entity_batch.flush();
+                drawent.render(pixel_pos, target, tiles, e->tile_width, e->tile_height);
+                ++own_draws;
+            }
+            ++metrics.entitiesRendered;
+        }
+        entity_batch.flush();
+        metrics.entityDrawCalls += entity_batch.drawCalls() + own_draws;
+        metrics.drawCalls += entity_batch.drawCalls() + own_draws;
+    }
+
+    // Render layers above entities (z_index > 0)
+    for (auto& layer : grid_data->layers) {
+        if (layer->z_index <= 0) continue;  // #257: skip ground-level and below
+        layer->render(target, left_spritepixels, top_spritepixels,
+                     left_edge, top_edge, x_limit, y_limit, zoom, cell_width, cell_height);
+        ++layers_drawn;
+    }
+
+    // One "cell rendered" per cell per layer drawn -- i.e. cell draw operations.
+    metrics.gridCellsRendered += visible_cells * layers_drawn;
+    metrics.chunkCacheHits += static_cast<int>(chunk_cache.hits - hits0);
+    metrics.chunkCacheMisses += static_cast<int>(chunk_cache.misses - misses0);
+    metrics.chunkCacheEvictions += static_cast<int>(chunk_cache.evictions - evictions0);
+}
+
+// Render-texture rectangles covering every logged damage entry newer than
+// the last raster (see GridData::Damage), merged where they overlap. False
+// if some content change since then was not logged, or redrawing the pieces
+// would cost about as much as a full redraw.
+bool UIGridView::collectDamage(int cell_width, int cell_height,
+                               int left_spritepixels, int top_spritepixels)
+{
+    damage_rects.clear();
+    // Some entity's drawn extent is unbounded: any rect could miss it
+    if (!std::isfinite(grid_data->entityReach())) return false;
+    uint64_t needed = grid_data->content_generation - last_content_gen;
+    uint64_t found = 0;
+    const int view_w = static_cast<int>(box.getSize().x);
+    const int view_h = static_cast<int>(box.getSize().y);
+    const auto& log = grid_data->damage_log;
+    for (auto it = log.rbegin(); it != log.rend() && it->generation > last_content_gen; ++it) {
+        ++found;
+        float wx0 = it->tiles.left * cell_width, wy0 = it->tiles.top * cell_height;
+        float wx1 = wx0 + it->tiles.width * cell_width, wy1 = wy0 + it->tiles.height * cell_height;
+        if (it->pixel_size.x > 0.f || it->pixel_size.y > 0.f) {
+            float px = wx0 + it->pixel_offset.x, py = wy0 + it->pixel_offset.y;
+            if (it->tiles.width > 0.f || it->tiles.height > 0.f) {
+                wx0 = std::min(wx0, px); wy0 = std::min(wy0, py);
+                wx1 = std::max(wx1, px + it->pixel_size.x); wy1 = std::max(wy1, py + it->pixel_size.y);
+            } else {
+                wx0 = px; wy0 = py;
+                wx1 = px + it->pixel_size.x; wy1 = py + it->pixel_size.y;
+            }
+        }
+        // World pixels to raster pixels, padded a pixel for filtering
+        int x0 = static_cast<int>(std::floor((wx0 - left_spritepixels) * zoom)) - 1;
+        int y0 = static_cast<int>(std::floor((wy0 - top_spritepixels) * zoom)) - 1;
+        int x1 = static_cast<int>(std::ceil((wx1 - left_spritepixels) * zoom)) + 1;
+        int y1 = static_cast<int>(std::ceil((wy1 - top_spritepixels) * zoom)) + 1;
+        x0 = std::max(x0, 0); y0 = std::max(y0, 0);
+        x1 = std::min(x1, view_w); y1 = std::min(y1, view_h);
+        if (x1 <= x0 || y1 <= y0) continue;  // off screen
+        damage_rects.emplace_back(x0, y0, x1 - x0, y1 - y0);
+    }
+    if (found != needed) return false;
+
+    // Merge overlapping rectangles until none overlap
+    for (bool merged = true; merged;) {
+        merged = false;
+        for (size_t i = 0; i < damage_rects.size() && !merged; ++i) {
+            for (size_t j = i + 1; j < damage_rects.size(); ++j) {
+                if (!damage_rects[i].intersects(damage_rects[j])) continue;
+                auto& a = damage_rects[i];
+                const auto& b = damage_rects[j];
+                int x0 = std::min(a.left, b.left), y0 = std::min(a.top, b.top);
+                int x1 = std::max(a.left + a.width, b.left + b.width);
+                int y1 = std::max(a.top + a.height, b.top + b.height);
+                a = sf::IntRect(x0, y0, x1 - x0, y1 - y0);
+                damage_rects.erase(damage_rects.begin() + j);
+                merged = true;
+                break;
+            }
+        }
+    }
+    long area = 0;
+    for (const auto& r : damage_rects) area += static_cast<long>(r.width) * r.height;
+    return damage_rects.size() <= MAX_DAMAGE_RECTS &&
+           area * 2 <= static_cast<long>(view_w) * view_h;
+}
+
 // =========================================================================
 // Render -- adapted from PyGridData::render()
 // =========================================================================
@@ -202,7 +383,8 @@ void UIGridView::render(sf::Vector2f offset, sf::RenderTarget& target)
     // directly (view-local); grid content changes bump content_generation. The
     // perspective overlay (single source of truth: this view's own
     // perspective_enabled, see #355 fix) and any grid children are conservative
-    // always-render carve-outs until tracked precisely (#352).
+    // always-render carve-outs until tracked precisely (#352). Content changes
+    // that logged their area are redrawn piecewise below (damage_only).
     // last_perspective_enabled: the cached raster HAS an overlay baked into it, so
     // the frame that turns perspective off must re-rasterize even though every
     // other input is unchanged (otherwise the fog stays on screen forever).
@@ -259,23 +441,6 @@ void UIGridView::render(sf::Vector2f offset, sf::RenderTarget& target)
     float aabb_w = grid_w_px * abs_cos + grid_h_px * abs_sin;
     float aabb_h = grid_w_px * abs_sin + grid_h_px * abs_cos;
 
-    sf::RenderTexture* activeTexture = &renderTexture;
-
-    if (has_camera_rotation) {
-        unsigned int needed_size = static_cast<unsigned int>(std::max(aabb_w, aabb_h) + 1);
-        if (!rotationTexture) rotationTexture = std::make_unique<sf::RenderTexture>();  // #338
-        if (rotationTextureSize < needed_size) {
-            rotationTexture->create(needed_size, needed_size);
-            rotationTextureSize = needed_size;
-        }
-        activeTexture = rotationTexture.get();
-        activeTexture->clear(fill_color);
-    } else {
-        output.setPosition(box.getPosition() + offset);
-        output.setTextureRect(sf::IntRect(0, 0, grid_w_px, grid_h_px));
-        renderTexture.clear(fill_color);
-    }
-
     float render_w = has_camera_rotation ? aabb_w : grid_w_px;
     float render_h = has_camera_rotation ? aabb_h : grid_h_px;
 
@@ -287,10 +452,6 @@ void UIGridView::render(sf::Vector2f offset, sf::RenderTarget& target)
     float top_edge = center_y_sq - (height_sq / 2.0);
     int left_spritepixels = center_x - (render_w / 2.0 / zoom);
     int top_spritepixels = center_y - (render_h / 2.0 / zoom);
-    int x_limit = left_edge + width_sq + 2;
-    if (x_limit > grid_data->grid_w) x_limit = grid_data->grid_w;
-    int y_limit = top_edge + height_sq + 2;
-    if (y_limit > grid_data->grid_h) y_limit = grid_data->grid_h;
 
     // #341: re-instrument the grid render counters. These were declared and reset
     // every frame but never incremented anywhere -- the increments were lost in the
@@ -299,137 +460,164 @@ void UIGridView::render(sf::Vector2f offset, sf::RenderTarget& target)
     // two views over one map sum rather than clobber each other.
     auto& metrics = Resources::game->metrics;
     ScopedAccumTimer gridTimer(metrics.gridRenderTime);
+    if (grid_data->entities) metrics.totalEntities += static_cast<int>(grid_data->entities->size());
+
+    // Damage-only redraw: the camera and everything else the early-out checks
+    // is unchanged, only grid content moved, and every such change since the
+    // last raster logged its area. Each damaged rectangle is cleared and
+    // redrawn through a view clipped to it, over the cached raster. Needs an
+    // opaque fill_color (drawing the clear must replace, not blend) and no
+    // camera rotation (the raster is a rotated composite then).
+    bool damage_only =
+        has_rendered_once
+        && !render_dirty
+        && !perspective_enabled
+        && !last_perspective_enabled
+        && (!children || children->empty())
+        && !has_camera_rotation && last_camera_rotation == 0.0f
+        && center_x == last_center_x && center_y == last_center_y
+        && zoom == last_zoom
+        && box.getSize() == last_box_size
+        && fill_color == last_fill_color && fill_color.a == 255
+        && renderTextureSize == last_render_tex_size
+        && collectDamage(cell_width, cell_height, left_spritepixels, top_spritepixels);
 
-    // Cells actually inside the viewport window, per layer drawn.
-    const int x_start = std::max(0, static_cast<int>(left_edge));
-    const int y_start = std::max(0, static_cast<int>(top_edge));
-    const int visible_cells = std::max(0, x_limit - x_start) * std::max(0, y_limit - y_start);
-
-    // Render layers below entities (z_index <= 0)
-    grid_data->sortLayers();
-    int layers_drawn = 0;
-    for (auto& layer : grid_data->layers) {
-        if (layer->z_index > 0) break;  // #257: z_index=0 is ground level (below entities)
-        layer->render(*activeTexture, left_spritepixels, top_spritepixels,
-                     left_edge, top_edge, x_limit, y_limit, zoom, cell_width, cell_height);
-        ++layers_drawn;
-    }
-
-    // Render entities
-    if (grid_data->entities) {
-        ScopedAccumTimer entityTimer(metrics.entityRenderTime);
-        metrics.totalEntities += static_cast<int>(grid_data->entities->size());
-        for (auto& e : *grid_data->entities) {
-            if (e->position.x < left_edge - 2 || e->position.x >= left_edge + width_sq + 2 ||
-                e->position.y < top_edge - 2 || e->position.y >= top_edge + height_sq + 2) {
-                continue;
+    if (damage_only) {
+        output.setPosition(box.getPosition() + offset);
+        output.setTextureRect(sf::IntRect(0, 0, grid_w_px, grid_h_px));
+        float tex_w = static_cast<float>(renderTextureSize.x);
+        float tex_h = static_cast<float>(renderTextureSize.y);
+        sf::RectangleShape clear_rect;
+        clear_rect.setFillColor(fill_color);
+        for (const auto& r : damage_rects) {
+            sf::FloatRect area(static_cast<float>(r.left), static_cast<float>(r.top),
+                               static_cast<float>(r.width), static_cast<float>(r.height));
+            sf::View clip(area);
+            clip.setViewport(sf::FloatRect(area.left / tex_w, area.top / tex_h,
+                                           area.width / tex_w, area.height / tex_h));
+            renderTexture.setView(clip);
+            clear_rect.setPosition(area.left, area.top);
+            clear_rect.setSize(sf::Vector2f(area.width, area.height));
+            renderTexture.draw(clear_rect);
+            // The tiles under this rectangle
+            drawContent(renderTexture, left_spritepixels, top_spritepixels,
+                        (left_spritepixels + area.left / zoom) / cell_width,
+                        (top_spritepixels + area.top / zoom) / cell_height,
+                        area.width / (cell_width * zoom), area.height / (cell_height * zoom),
+                        cell_width, cell_height);
+        }
+        renderTexture.setView(renderTexture.getDefaultView());
+        renderTexture.display();
+    } else {
+        sf::RenderTexture* activeTexture = &renderTexture;
+
+        if (has_camera_rotation) {
+            unsigned int needed_size = static_cast<unsigned int>(std::max(aabb_w, aabb_h) + 1);
+            if (!rotationTexture) rotationTexture = std::make_unique<sf::RenderTexture>();  // #338
+            if (rotationTextureSize < needed_size) {
+                rotationTexture->create(needed_size, needed_size);
+                rotationTextureSize = needed_size;
             }
-            auto& drawent = e->sprite;
-            drawent.setScale(sf::Vector2f(zoom, zoom));
-            auto pixel_pos = sf::Vector2f(
-                (e->position.x*cell_width - left_spritepixels + e->sprite_offset.x) * zoom,
-                (e->position.y*cell_height - top_spritepixels + e->sprite_offset.y) * zoom);
-            drawent.render(pixel_pos, *activeTexture);
-            ++metrics.entitiesRendered;
+            activeTexture = rotationTexture.get();
+            activeTexture->clear(fill_color);
+        } else {
+            output.setPosition(box.getPosition() + offset);
+            output.setTextureRect(sf::IntRect(0, 0, grid_w_px, grid_h_px));
+            renderTexture.clear(fill_color);
         }
-    }
 
-    // Render layers above entities (z_index > 0)
-    for (auto& layer : grid_data->layers) {
-        if (layer->z_index <= 0) continue;  // #257: skip ground-level and below
-        layer->render(*activeTexture, left_spritepixels, top_spritepixels,
-                     left_edge, top_edge, x_limit, y_limit, zoom, cell_width, cell_height);
-        ++layers_drawn;
-    }
+        int x_limit = left_edge + width_sq + 2;
+        if (x_limit > grid_data->grid_w) x_limit = grid_data->grid_w;
+        int y_limit = top_edge + height_sq + 2;
+        if (y_limit > grid_data->grid_h) y_limit = grid_data->grid_h;
 
-    // One "cell rendered" per cell per layer drawn -- i.e. cell draw operations.
-    metrics.gridCellsRendered += visible_cells * layers_drawn;
+        drawContent(*activeTexture, left_spritepixels, top_spritepixels,
+                    left_edge, top_edge, width_sq, height_sq, cell_width, cell_height);
 
-    // Children (grid-world pixel coordinates; owned by this view -- #364)
-    if (children && !children->empty()) {
-        if (children_need_sort) {
-            std::sort(children->begin(), children->end(),
-                [](const auto& a, const auto& b) { return a->z_index < b->z_index; });
-            children_need_sort = false;
-        }
-        for (auto& child : *children) {
-            if (!child->visible) continue;
-            float child_grid_x = child->position.x / cell_width;
-            float child_grid_y = child->position.y / cell_height;
-            if (child_grid_x < left_edge - 2 || child_grid_x >= left_edge + width_sq + 2 ||
-                child_grid_y < top_edge - 2 || child_grid_y >= top_edge + height_sq + 2)
-                continue;
-            auto pixel_pos = sf::Vector2f(
-                (child->position.x - left_spritepixels) * zoom,
-                (child->position.y - top_spritepixels) * zoom);
-            child->render(pixel_pos, *activeTexture);
+        // Children (grid-world pixel coordinates; owned by this view -- #364)
+        if (children && !children->empty()) {
+            if (children_need_sort) {
+                std::sort(children->begin(), children->end(),
+                    [](const auto& a, const auto& b) { return a->z_index < b->z_index; });
+                children_need_sort = false;
+            }
+            for (auto& child : *children) {
+                if (!child->visible) continue;
+                float child_grid_x = child->position.x / cell_width;
+                float child_grid_y = child->position.y / cell_height;
+                if (child_grid_x < left_edge - 2 || child_grid_x >= left_edge + width_sq + 2 ||
+                    child_grid_y < top_edge - 2 || child_grid_y >= top_edge + height_sq + 2)
+                    continue;
+                auto pixel_pos = sf::Vector2f(
+                    (child->position.x - left_spritepixels) * zoom,
+                    (child->position.y - top_spritepixels) * zoom);
+                child->render(pixel_pos, *activeTexture);
+            }
         }
-    }
 
-    // Perspective overlay (#355: state owned by the view -- see get/set_perspective)
-    if (perspective_enabled) {
-        // #341: accumulate -- with two perspective views on screen, assignment made
-        // the second view's time silently replace the first's.
-        ScopedAccumTimer fovTimer(Resources::game->metrics.fovOverlayTime);
-        auto entity = perspective_entity.lock();
-        sf::RectangleShape overlay;
-        overlay.setSize(sf::Vector2f(cell_width * zoom, cell_height * zoom));
-
-        if (entity && entity->perspective_map) {
-            // #294: perspective_map values: 0=unknown, 1=discovered, 2=visible.
-            const uint8_t* pm = entity->perspective_map->data();
-            const int pm_w = entity->perspective_map->width();
-            const int pm_h = entity->perspective_map->height();
-            for (int x = std::max(0, (int)(left_edge - 1)); x < x_limit; x++) {
-                for (int y = std::max(0, (int)(top_edge - 1)); y < y_limit; y++) {
-                    if (x < 0 || x >= grid_data->grid_w || y < 0 || y >= grid_data->grid_h) continue;
-                    if (x >= pm_w || y >= pm_h) continue;
-                    auto pixel_pos = sf::Vector2f(
-                        (x*cell_width - left_spritepixels) * zoom,
-                        (y*cell_height - top_spritepixels) * zoom);
-                    uint8_t state = pm[y * pm_w + x];
-                    overlay.setPosition(pixel_pos);
-                    if (state == 0) {
+        // Perspective overlay (#355: state owned by the view -- see get/set_perspective)
+        if (perspective_enabled) {
+            // #341: accumulate -- with two perspective views on screen, assignment made
+            // the second view's time silently replace the first's.
+            ScopedAccumTimer fovTimer(Resources::game->metrics.fovOverlayTime);
+            auto entity = perspective_entity.lock();
+            sf::RectangleShape overlay;
+            overlay.setSize(sf::Vector2f(cell_width * zoom, cell_height * zoom));
+
+            if (entity && (entity->perspective_map || entity->perspective_bits)) {
+                // #294: perspective values: 0=unknown, 1=discovered, 2=visible.
+                // Read through perspectiveState() so compact (bitplane) entities
+                // draw the same fog.
+                for (int x = std::max(0, (int)(left_edge - 1)); x < x_limit; x++) {
+                    for (int y = std::max(0, (int)(top_edge - 1)); y < y_limit; y++) {
+                        if (x < 0 || x >= grid_data->grid_w || y < 0 || y >= grid_data->grid_h) continue;
+                        auto pixel_pos = sf::Vector2f(
+                            (x*cell_width - left_spritepixels) * zoom,
+                            (y*cell_height - top_spritepixels) * zoom);
+                        uint8_t state = entity->perspectiveState(x, y);
+                        overlay.setPosition(pixel_pos);
+                        if (state == 0) {
+                            overlay.setFillColor(sf::Color(0, 0, 0, 255));
+                            activeTexture->draw(overlay);
+                        } else if (state == 1) {
+                            overlay.setFillColor(sf::Color(32, 32, 40, 192));
+                            activeTexture->draw(overlay);
+                        }
+                        // state == 2: visible -- no overlay
+                    }
+                }
+            } else {
+                for (int x = std::max(0, (int)(left_edge - 1)); x < x_limit; x++) {
+                    for (int y = std::max(0, (int)(top_edge - 1)); y < y_limit; y++) {
+                        if (x < 0 || x >= grid_data->grid_w || y < 0 || y >= grid_data->grid_h) continue;
+                        auto pixel_pos = sf::Vector2f(
+                            (x*cell_width - left_spritepixels) * zoom,
+                            (y*cell_height - top_spritepixels) * zoom);
+                        overlay.setPosition(pixel_pos);
                         overlay.setFillColor(sf::Color(0, 0, 0, 255));
                         activeTexture->draw(overlay);
-                    } else if (state == 1) {
-                        overlay.setFillColor(sf::Color(32, 32, 40, 192));
-                        activeTexture->draw(overlay);
                     }
-                    // state == 2: visible -- no overlay
-                }
-            }
-        } else {
-            for (int x = std::max(0, (int)(left_edge - 1)); x < x_limit; x++) {
-                for (int y = std::max(0, (int)(top_edge - 1)); y < y_limit; y++) {
-                    if (x < 0 || x >= grid_data->grid_w || y < 0 || y >= grid_data->grid_h) continue;
-                    auto pixel_pos = sf::Vector2f(
-                        (x*cell_width - left_spritepixels) * zoom,
-                        (y*cell_height - top_spritepixels) * zoom);
-                    overlay.setPosition(pixel_pos);
-                    overlay.setFillColor(sf::Color(0, 0, 0, 255));
-                    activeTexture->draw(overlay);
                 }
             }
         }
-    }
 
-    activeTexture->display();
-
-    // Camera rotation compositing
-    if (has_camera_rotation) {
-        renderTexture.clear(fill_color);
-        sf::Sprite rotatedSprite(rotationTexture->getTexture());
-        float tex_center_x = aabb_w / 2.0f;
-        float tex_center_y = aabb_h / 2.0f;
-        rotatedSprite.setOrigin(tex_center_x, tex_center_y);
-        rotatedSprite.setRotation(camera_rotation);
-        rotatedSprite.setPosition(grid_w_px / 2.0f, grid_h_px / 2.0f);
-        rotatedSprite.setTextureRect(sf::IntRect(0, 0, (int)aabb_w, (int)aabb_h));
-        renderTexture.draw(rotatedSprite);
-        renderTexture.display();
-        output.setPosition(box.getPosition() + offset);
-        output.setTextureRect(sf::IntRect(0, 0, grid_w_px, grid_h_px));
+        activeTexture->display();
+
+        // Camera rotation compositing
+        if (has_camera_rotation) {
+            renderTexture.clear(fill_color);
+            sf::Sprite rotatedSprite(rotationTexture->getTexture());
+            float tex_center_x = aabb_w / 2.0f;
+            float tex_center_y = aabb_h / 2.0f;
+            rotatedSprite.setOrigin(tex_center_x, tex_center_y);
+            rotatedSprite.setRotation(camera_rotation);
+            rotatedSprite.setPosition(grid_w_px / 2.0f, grid_h_px / 2.0f);
+            rotatedSprite.setTextureRect(sf::IntRect(0, 0, (int)aabb_w, (int)aabb_h));
+            renderTexture.draw(rotatedSprite);
+            renderTexture.display();
+            output.setPosition(box.getPosition() + offset);
+            output.setTextureRect(sf::IntRect(0, 0, grid_w_px, grid_h_px));
+        }
     }
 
     if (rotation != 0.0f) {
@@ -1200,7 +1388,7 @@ static PyObject* createCellCallbackArgs(sf::Vector2i cell, const std::string& bu
     }
 
     int button_val = buttonStringToEnum(button);
-    PyObject* button_enum = PyObject_CallFunction(PyMouseButton::mouse_button_enum_class, "i", button_val);
+    PyObject* button_enum = PyMouseButton::get_enum_member(button_val);
     if (!button_enum) {
         Py_DECREF(cell_pos);
         PyErr_Print();
@@ -1208,7 +1396,7 @@ static PyObject* createCellCallbackArgs(sf::Vector2i cell, const std::string& bu
     }
 
     int action_val = actionStringToEnum(action);
-    PyObject* action_enum = PyObject_CallFunction(PyInputState::input_state_enum_class, "i", action_val);
+    PyObject* action_enum = PyInputState::get_enum_member(action_val);
     if (!action_enum) {
         Py_DECREF(cell_pos);
         Py_DECREF(button_enum);
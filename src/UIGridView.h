@@ -16,6 +16,7 @@
 #include "PyVector.h"
 #include "PyCallable.h"
 #include "PyDrawable.h"
+#include "SpriteBatch.h"
 
 // Forward declarations
 class UIGrid;
@@ -39,6 +40,7 @@ public:
     UIDrawable* click_at(sf::Vector2f point) override final;
 
     sf::FloatRect get_bounds() const override;
+    bool retainable() const override { return false; }  // Camera and content bypass the dirty flags
     void move(float dx, float dy) override;
     void resize(float w, float h) override;
     void onPositionChanged() override;   // #355: keep box in sync with position
@@ -129,6 +131,24 @@ public:
     sf::Vector2u last_render_tex_size{0, 0};
     bool last_perspective_enabled = false;  // #355: fog baked into the cached raster
 
+    // Entities whose draw position falls in [x0, x1) x [y0, y1) (tiles), in
+    // grid->entities order. Culls through the spatial hash's draw buckets, so
+    // the cost follows the visible count rather than the entity count.
+    void collectVisibleEntities(float x0, float y0, float x1, float y1);
+    std::vector<UIEntity*> visible_entities;  // scratch, rebuilt every render
+
+    // Draw layers and entities for a tile window (whole viewport or one
+    // damaged rectangle) at the given camera.
+    void drawContent(sf::RenderTarget& target, int left_spritepixels, int top_spritepixels,
+                     float left_edge, float top_edge, float width_sq, float height_sq,
+                     int cell_width, int cell_height);
+    // Fill damage_rects from GridData::damage_log for a damage-only redraw;
+    // false if a full redraw is needed.
+    bool collectDamage(int cell_width, int cell_height, int left_spritepixels, int top_spritepixels);
+    std::vector<sf::IntRect> damage_rects;  // render-texture pixels
+    static constexpr size_t MAX_DAMAGE_RECTS = 32;
+    SpriteBatch entity_batch;  // visible entity sprites, one draw per texture run
+
     // Render textures
     sf::Sprite sprite_proto, output;
     sf::RenderTexture renderTexture;
@@ -214,6 +214,14 @@ sf::FloatRect UILine::get_bounds() const {
     return sf::FloatRect(min_x, min_y, max_x - min_x, max_y - min_y);
 }
 
+sf::FloatRect UILine::damage_bounds() const {
+    // The stroke (or the zero-length dot) reaches thickness/2 past the
+    // endpoints on every side, whatever the direction
+    sf::FloatRect r = get_bounds();
+    float pad = std::max(0.0f, thickness / 2.0f);
+    return sf::FloatRect(r.left - pad, r.top - pad, r.width + 2 * pad, r.height + 2 * pad);
+}
+
 void UILine::move(float dx, float dy) {
     start_pos.x += dx;
     start_pos.y += dy;
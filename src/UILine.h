@@ -65,6 +65,7 @@ public:
 
     // Phase 1 virtual method implementations
     sf::FloatRect get_bounds() const override;
+    sf::FloatRect damage_bounds() const override;  // Endpoint box plus half the thickness
     void move(float dx, float dy) override;
     void resize(float w, float h) override;
 
@@ -109,9 +109,37 @@ void UISprite::render(sf::Vector2f offset)
 */
 
 void UISprite::render(sf::Vector2f offset, sf::RenderTarget& target)
+{
+    render(offset, target, nullptr, 0, 0);
+}
+
+bool UISprite::compositeTiles(const std::vector<int>* tiles, int tiles_w, int tiles_h) const
+{
+    return tiles && ptex && tiles_w > 0 && tiles_h > 0 &&
+           tiles->size() == static_cast<size_t>(tiles_w) * tiles_h;
+}
+
+void UISprite::queueTiles(const sf::Transform& transform, SpriteBatch& batch,
+                          const std::vector<int>& tiles, int tiles_w, int tiles_h, sf::Color color) const
+{
+    float sw = static_cast<float>(ptex->sprite_width);
+    float sh = static_cast<float>(ptex->sprite_height);
+    for (int ty = 0; ty < tiles_h; ++ty) {
+        for (int tx = 0; tx < tiles_w; ++tx) {
+            int index = tiles[ty * tiles_w + tx];
+            if (index < 0) continue;
+            batch.add(sprite.getTexture(), transform, sf::FloatRect(tx * sw, ty * sh, sw, sh),
+                      ptex->spriteRect(index), color);
+        }
+    }
+}
+
+void UISprite::render(sf::Vector2f offset, sf::RenderTarget& target,
+                      const std::vector<int>* tiles, int tiles_w, int tiles_h)
 {
     // Check visibility
     if (!visible) return;
+    const bool composite = compositeTiles(tiles, tiles_w, tiles_h);
 
     // Apply opacity (multiply with sprite color alpha)
     auto color = sprite.getColor();
@@ -136,7 +164,18 @@ void UISprite::render(sf::Vector2f offset, sf::RenderTarget& target)
         // Render sprite at origin in intermediate texture
         sf::Sprite temp_sprite = sprite;
         temp_sprite.setPosition(0, 0);  // Render at origin of intermediate texture
-        intermediate.draw(temp_sprite);
+        if (composite) {
+            // #237: the shader sees the whole composite, as the batch draws it
+            SpriteBatch tile_batch;
+            tile_batch.begin(intermediate);
+            queueTiles(temp_sprite.getTransform(), tile_batch, *tiles, tiles_w, tiles_h, sprite.getColor());
+            tile_batch.flush();
+            bounds = temp_sprite.getTransform().transformRect(sf::FloatRect(
+                0.f, 0.f, static_cast<float>(ptex->sprite_width * tiles_w),
+                static_cast<float>(ptex->sprite_height * tiles_h)));
+        } else {
+            intermediate.draw(temp_sprite);
+        }
         intermediate.display();
 
         // Create result sprite from intermediate texture
@@ -154,6 +193,13 @@ void UISprite::render(sf::Vector2f offset, sf::RenderTarget& target)
 
         // Draw with shader
         target.draw(result_sprite, shader->shader.get());
+    } else if (composite) {
+        SpriteBatch tile_batch;
+        tile_batch.begin(target);
+        sf::Transform transform;
+        transform.translate(offset);
+        queueTiles(transform * sprite.getTransform(), tile_batch, *tiles, tiles_w, tiles_h, sprite.getColor());
+        tile_batch.flush();
     } else {
         // Standard rendering path (no shader)
         sprite.move(offset);
@@ -166,6 +212,33 @@ void UISprite::render(sf::Vector2f offset, sf::RenderTarget& target)
     sprite.setColor(color);
 }
 
+bool UISprite::addToBatch(sf::Vector2f offset, SpriteBatch& batch,
+                          const std::vector<int>* tiles, int tiles_w, int tiles_h)
+{
+    if (!visible) return true;
+    if (shader && shader->shader) return false;
+
+    // Same state render() applies, folded into the vertices
+    sprite.setOrigin(origin);
+    sprite.setRotation(rotation);
+    sf::Color color = sprite.getColor();
+    color.a = static_cast<sf::Uint8>(color.a * opacity);
+    sf::Transform transform;
+    transform.translate(offset);
+    transform = transform * sprite.getTransform();
+    if (compositeTiles(tiles, tiles_w, tiles_h)) {
+        queueTiles(transform, batch, *tiles, tiles_w, tiles_h, color);
+        return true;
+    }
+
+    sf::IntRect rect = sprite.getTextureRect();
+    batch.add(sprite.getTexture(), transform,
+              sf::FloatRect(0.f, 0.f, static_cast<float>(std::abs(rect.width)),
+                            static_cast<float>(std::abs(rect.height))),
+              rect, color);
+    return true;
+}
+
 void UISprite::setPosition(sf::Vector2f pos)
 {
     position = pos;  // Update base class position
@@ -201,7 +274,7 @@ sf::Vector2f UISprite::getPosition()
     return position;  // Return base class position
 }
 
-std::shared_ptr<PyTexture> UISprite::getTexture()
+std::shared_ptr<PyTexture> UISprite::getTexture() const
 {
     return ptex;
 }
@@ -664,59 +737,8 @@ int UISprite::init(PyUISpriteObject* self, PyObject* args, PyObject* kwds)
 
 // Property system implementation for animations
 bool UISprite::setProperty(const std::string& name, float value) {
-    if (name == "x") {
-        position.x = value;
-        sprite.setPosition(position);  // Keep sprite in sync
-        markCompositeDirty();  // #144 - Position change, texture still valid
-        return true;
-    }
-    else if (name == "y") {
-        position.y = value;
-        sprite.setPosition(position);  // Keep sprite in sync
-        markCompositeDirty();  // #144 - Position change, texture still valid
-        return true;
-    }
-    else if (name == "scale") {
-        sprite.setScale(sf::Vector2f(value, value));
-        markDirty();  // #144 - Content change
-        return true;
-    }
-    else if (name == "scale_x") {
-        sprite.setScale(sf::Vector2f(value, sprite.getScale().y));
-        markDirty();  // #144 - Content change
-        return true;
-    }
-    else if (name == "scale_y") {
-        sprite.setScale(sf::Vector2f(sprite.getScale().x, value));
-        markDirty();  // #144 - Content change
-        return true;
-    }
-    else if (name == "opacity") {
-        opacity = std::clamp(value, 0.0f, 1.0f);
-        markDirty();  // #144 - Visual change
-        return true;
-    }
-    else if (name == "z_index") {
-        z_index = static_cast<int>(value);
-        markDirty();  // #144 - Z-order change affects parent
-        return true;
-    }
-    else if (name == "rotation") {
-        rotation = value;
-        sprite.setRotation(rotation);
-        markDirty();
-        return true;
-    }
-    else if (name == "origin_x") {
-        origin.x = value;
-        sprite.setOrigin(origin);
-        markDirty();
-        return true;
-    }
-    else if (name == "origin_y") {
-        origin.y = value;
-        sprite.setOrigin(origin);
-        markDirty();
+    if (auto set = floatSetter(AnimationProperty::lookup(name))) {
+        set(*this, value);
         return true;
     }
     // #106: Check for shader uniform properties
@@ -726,6 +748,68 @@ bool UISprite::setProperty(const std::string& name, float value) {
     return false;
 }
 
+AnimationProperty::FloatSetter<UIDrawable> UISprite::floatSetter(AnimationProperty::Id prop) const {
+    using namespace AnimationProperty;
+    static const SetterTable<UIDrawable> table = [] {
+        SetterTable<UIDrawable> t;
+        t[X] = [](UIDrawable& d, float value) {
+            auto& s = static_cast<UISprite&>(d);
+            s.position.x = value;
+            s.sprite.setPosition(s.position);  // Keep sprite in sync
+            s.markCompositeDirty();  // #144 - Position change, texture still valid
+        };
+        t[Y] = [](UIDrawable& d, float value) {
+            auto& s = static_cast<UISprite&>(d);
+            s.position.y = value;
+            s.sprite.setPosition(s.position);  // Keep sprite in sync
+            s.markCompositeDirty();  // #144 - Position change, texture still valid
+        };
+        t[SCALE] = [](UIDrawable& d, float value) {
+            auto& s = static_cast<UISprite&>(d);
+            s.sprite.setScale(sf::Vector2f(value, value));
+            s.markDirty();  // #144 - Content change
+        };
+        t[SCALE_X] = [](UIDrawable& d, float value) {
+            auto& s = static_cast<UISprite&>(d);
+            s.sprite.setScale(sf::Vector2f(value, s.sprite.getScale().y));
+            s.markDirty();  // #144 - Content change
+        };
+        t[SCALE_Y] = [](UIDrawable& d, float value) {
+            auto& s = static_cast<UISprite&>(d);
+            s.sprite.setScale(sf::Vector2f(s.sprite.getScale().x, value));
+            s.markDirty();  // #144 - Content change
+        };
+        t[OPACITY] = [](UIDrawable& d, float value) {
+            d.opacity = std::clamp(value, 0.0f, 1.0f);
+            d.markDirty();  // #144 - Visual change
+        };
+        t[Z_INDEX] = [](UIDrawable& d, float value) {
+            d.z_index = static_cast<int>(value);
+            d.markDirty();  // #144 - Z-order change affects parent
+        };
+        t[ROTATION] = [](UIDrawable& d, float value) {
+            auto& s = static_cast<UISprite&>(d);
+            s.rotation = value;
+            s.sprite.setRotation(s.rotation);
+            s.markDirty();
+        };
+        t[ORIGIN_X] = [](UIDrawable& d, float value) {
+            auto& s = static_cast<UISprite&>(d);
+            s.origin.x = value;
+            s.sprite.setOrigin(s.origin);
+            s.markDirty();
+        };
+        t[ORIGIN_Y] = [](UIDrawable& d, float value) {
+            auto& s = static_cast<UISprite&>(d);
+            s.origin.y = value;
+            s.sprite.setOrigin(s.origin);
+            s.markDirty();
+        };
+        return t;
+    }();
+    return table.get(prop);
+}
+
 bool UISprite::setProperty(const std::string& name, int value) {
     if (name == "sprite_index") {
         setSpriteIndex(value);
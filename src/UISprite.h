@@ -14,12 +14,19 @@
 #include "PyFont.h"
 #include "UIDrawable.h"
 #include "UIBase.h"
+#include "SpriteBatch.h"
 
 class UISprite: public UIDrawable
 {
 private:
     int sprite_index;
     sf::Sprite sprite;
+
+    // #237 composite: tiles_w x tiles_h sprite indices that fit this texture
+    bool compositeTiles(const std::vector<int>* tiles, int tiles_w, int tiles_h) const;
+    // Queue each composite tile one sprite-size apart, in sprite-local pixels
+    void queueTiles(const sf::Transform& transform, SpriteBatch& batch,
+                    const std::vector<int>& tiles, int tiles_w, int tiles_h, sf::Color color) const;
 protected:
     std::shared_ptr<PyTexture> ptex;
 public:
@@ -35,6 +42,20 @@ public:
     UISprite& operator=(UISprite&& other) noexcept;
     void update();
     void render(sf::Vector2f, sf::RenderTarget&) override final;
+    // render() drawing the `tiles` composite instead when one is given (see
+    // addToBatch), so a shaded composite entity looks like a batched one
+    void render(sf::Vector2f offset, sf::RenderTarget& target,
+                const std::vector<int>* tiles, int tiles_w, int tiles_h);
+
+    // Queue what render(offset, target) would draw into batch. With `tiles`
+    // (row-major tiles_w x tiles_h sprite indices, -1 = empty) each tile is
+    // drawn from this sprite's texture one sprite-size apart instead.
+    // Returns false, queuing nothing, when the sprite needs its own draw
+    // call (a shader is attached).
+    bool addToBatch(sf::Vector2f offset, SpriteBatch& batch,
+                    const std::vector<int>* tiles, int tiles_w, int tiles_h);
+    bool addToBatch(sf::Vector2f offset, SpriteBatch& batch) override
+    { return addToBatch(offset, batch, nullptr, 0, 0); }
     virtual UIDrawable* click_at(sf::Vector2f point) override final;
     
     //void render(sf::Vector2f, sf::RenderTexture&);
@@ -47,7 +68,7 @@ public:
     int getSpriteIndex();
 
     void setTexture(std::shared_ptr<PyTexture> _ptex, int _sprite_index=-1);
-    std::shared_ptr<PyTexture> getTexture();
+    std::shared_ptr<PyTexture> getTexture() const;
 
     PyObjectsEnum derived_type() override final;
     
@@ -59,6 +80,7 @@ public:
     
     // Property system for animations
     bool setProperty(const std::string& name, float value) override;
+    AnimationProperty::FloatSetter<UIDrawable> floatSetter(AnimationProperty::Id prop) const override;
     bool setProperty(const std::string& name, int value) override;
     bool setProperty(const std::string& name, const sf::Vector2f& value) override;
     bool getProperty(const std::string& name, float& value) const override;
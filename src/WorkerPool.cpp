@@ -0,0 +1,126 @@
+// WorkerPool.cpp - Minimal fork/join thread pool (see WorkerPool.h)
+#include "WorkerPool.h"
+#include <algorithm>
+
+WorkerPool& WorkerPool::instance()
+{
+    static WorkerPool pool;
+    pool.start();
+    return pool;
+}
+
+WorkerPool::WorkerPool()
+{
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        shutting_down = true;
+    }
+    job_cv.notify_all();
+    for (auto& t : threads) {
+        if (t.joinable()) t.join();
+    }
+}
+
+void WorkerPool::start()
+{
+    if (started) return;
+    started = true;
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+    // No threads on this target: parallelFor() always runs inline.
+#else
+    // The calling thread works too, so spawn one fewer than the core count.
+    unsigned hw = std::thread::hardware_concurrency();
+    unsigned extra = hw > 1 ? hw - 1 : 0;
+    threads.reserve(extra);
+    for (unsigned i = 0; i < extra; i++) {
+        threads.emplace_back(&WorkerPool::workerLoop, this, i + 1);
+    }
+#endif
+}
+
+void WorkerPool::workerLoop(unsigned slot)
+{
+    unsigned seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            job_cv.wait(lock, [&] { return shutting_down || job_serial != seen; });
+            if (shutting_down) return;
+            seen = job_serial;
+            job_active++;
+        }
+        drain(slot);
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            job_active--;
+        }
+        done_cv.notify_one();
+    }
+}
+
+void WorkerPool::drain(unsigned slot)
+{
+    for (;;) {
+        const RangeFn* fn;
+        size_t begin, end;
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            // A late waker may arrive after the job was retired; nothing to do.
+            if (!job_fn || job_next >= job_count) return;
+            fn = job_fn;
+            begin = job_next;
+            end = std::min(job_count, begin + job_chunk);
+            job_next = end;
+        }
+        try {
+            (*fn)(begin, end, slot);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mtx);
+            if (!job_error) job_error = std::current_exception();
+            job_next = job_count;  // abandon the remaining chunks
+        }
+    }
+}
+
+void WorkerPool::parallelFor(size_t count, size_t min_chunk, const RangeFn& fn)
+{
+    if (count == 0) return;
+    start();
+    if (min_chunk == 0) min_chunk = 1;
+
+    // Not worth waking anyone: run on the caller (slot 0).
+    if (threads.empty() || count < 2 * min_chunk) {
+        fn(0, count, 0);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        job_fn = &fn;
+        job_count = count;
+        // ~4 chunks per participant so uneven bodies still balance.
+        job_chunk = std::max(min_chunk, count / (static_cast<size_t>(workerCount()) * 4));
+        job_next = 0;
+        job_error = nullptr;
+        job_serial++;
+    }
+    job_cv.notify_all();
+
+    drain(0);
+
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        // Every worker that claimed a chunk is counted in job_active, so once
+        // it drops to zero (and the caller has drained) all chunks are done.
+        done_cv.wait(lock, [&] { return job_active == 0; });
+        job_fn = nullptr;
+        error = job_error;
+        job_error = nullptr;
+    }
+    if (error) std::rethrow_exception(error);
+}
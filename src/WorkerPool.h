@@ -0,0 +1,76 @@
+#pragma once
+// WorkerPool.h - Minimal fork/join thread pool for GIL-free batch work.
+//
+// The engine is single-threaded by design: Python owns the main thread and
+// every UI/grid mutation happens there. A few hot loops, though, are pure C++
+// over data that Python cannot touch while they run (e.g. the plan phase of
+// grid.step(parallel=True)). WorkerPool runs such a loop across a fixed set of
+// persistent threads and blocks the caller until every index is processed.
+//
+// Rules for callers:
+//   * The body must not touch any PyObject or call into the CPython API. The
+//     caller is expected to release the GIL around parallelFor() so that other
+//     Python threads are not starved while it waits.
+//   * The body may only READ shared engine state, and may only WRITE state that
+//     belongs to the index it was handed (or to its worker slot).
+//   * parallelFor() is not re-entrant: do not call it from inside a body.
+//
+// Builds without thread support (Emscripten without pthreads) run every body
+// inline on the caller's thread, so results never depend on the pool size.
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorkerPool {
+public:
+    // Body signature: process indices [begin, end) as worker slot `worker`.
+    // `worker` is in [0, workerCount()) and is stable for the duration of one
+    // chunk, so callers can keep per-worker scratch (e.g. a private TCODMap).
+    using RangeFn = std::function<void(size_t begin, size_t end, unsigned worker)>;
+
+    // Process-wide pool, started lazily on first parallelFor().
+    static WorkerPool& instance();
+
+    // Number of distinct `worker` slots a body may observe (threads + caller).
+    unsigned workerCount() const { return static_cast<unsigned>(threads.size()) + 1; }
+
+    // Run fn over [0, count) split into chunks of at least min_chunk indices.
+    // Blocks until done. Counts below 2 * min_chunk run inline on the caller.
+    // The first exception thrown by any body is rethrown here after all
+    // workers have finished.
+    void parallelFor(size_t count, size_t min_chunk, const RangeFn& fn);
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+private:
+    WorkerPool();
+    ~WorkerPool();
+
+    void start();
+    void workerLoop(unsigned slot);
+    // Pull chunks from the current job until it is exhausted.
+    void drain(unsigned slot);
+
+    std::vector<std::thread> threads;
+    bool started = false;
+
+    std::mutex mtx;
+    std::condition_variable job_cv;   // workers wait here for a new job
+    std::condition_variable done_cv;  // caller waits here for completion
+    bool shutting_down = false;
+    unsigned job_serial = 0;          // bumped per job so workers wake once
+
+    // Current job (valid while job_fn != nullptr)
+    const RangeFn* job_fn = nullptr;
+    size_t job_count = 0;
+    size_t job_chunk = 1;
+    size_t job_next = 0;              // next unclaimed index (under mtx)
+    unsigned job_active = 0;          // workers still inside the job
+    std::exception_ptr job_error;
+};
@@ -11,6 +11,7 @@
 #include <vector>
 #include <functional>
 #include <chrono>
+#include <map>
 
 namespace sf {
 
@@ -294,8 +295,9 @@ inline const BlendMode BlendMode::Add{};
 inline const BlendMode BlendMode::Multiply{};
 inline const BlendMode BlendMode::None{};
 
-// Forward declare Shader for RenderStates
+// Forward declare Shader / Texture for RenderStates
 class Shader;
+class Texture;
 
 class RenderStates {
 public:
@@ -303,6 +305,8 @@ public:
     RenderStates(const Transform& transform) {}  // Implicit conversion from Transform
     RenderStates(const BlendMode& mode) {}
     RenderStates(const Shader* shader) {}  // Implicit conversion from Shader pointer
+    RenderStates(const Texture* texture) : texture(texture) {}
+    const Texture* texture = nullptr;
     static const RenderStates Default;
 };
 
@@ -556,7 +560,14 @@ protected:
 // Text and Font (stubs)
 // =============================================================================
 
+struct Glyph {
+    float advance = 0.0f;
+    FloatRect bounds;
+    IntRect textureRect;
+};
+
 class Font {
+    mutable std::map<unsigned int, Texture> pages_;
 public:
     struct Info {
         std::string family;
@@ -567,6 +578,16 @@ public:
     bool loadFromFile(const std::string& filename) { return true; }
     bool loadFromMemory(const void* data, size_t sizeInBytes) { return true; }
     const Info& getInfo() const { static Info info; return info; }
+
+    // Glyph metrics: empty bitmaps on one page per size, half-em advance
+    Glyph getGlyph(Uint32 codePoint, unsigned int characterSize, bool bold, float outlineThickness = 0) const {
+        Glyph glyph;
+        glyph.advance = characterSize * 0.5f;
+        return glyph;
+    }
+    float getKerning(Uint32 first, Uint32 second, unsigned int characterSize) const { return 0.0f; }
+    float getLineSpacing(unsigned int characterSize) const { return static_cast<float>(characterSize); }
+    const Texture& getTexture(unsigned int characterSize) const { return pages_[characterSize]; }
 };
 
 class Text : public Drawable, public Transformable {
@@ -1110,11 +1110,13 @@ void RenderTarget::clear(const Color& color) {
 }
 
 void RenderTarget::draw(const Vertex* vertices, size_t vertexCount, PrimitiveType type, const RenderStates& states) {
-    // TODO: Implement with proper vertex buffer handling
+    VertexArray array(type);
+    for (size_t i = 0; i < vertexCount; ++i) array.append(vertices[i]);
+    draw(array, states);
 }
 
 void RenderTarget::draw(const VertexArray& vertices, const RenderStates& states) {
-    draw(&vertices[0], vertices.getVertexCount(), vertices.getPrimitiveType(), states);
+    static_cast<const Drawable&>(vertices).draw(*this, states);
 }
 
 void RenderTarget::setView(const View& view) {
@@ -1846,14 +1848,35 @@ void VertexArray::draw(RenderTarget& target, RenderStates states) const {
             break;
     }
 
-    if (!positions.empty()) {
-        // Use shape shader (no texture)
-        glUseProgram(SDL2Renderer::getInstance().getShaderProgram(SDL2Renderer::ShaderType::Shape));
+    if (positions.empty()) return;
+
+    // Textured arrays (e.g. batched tile-layer chunks): texCoords are in
+    // texture pixels like SFML's, so normalize them for GL here.
+    const Texture* texture = states.texture;
+    if (texture && texture->getNativeHandle() && texcoords.size() == positions.size()) {
+        Vector2u texSize = texture->getSize();
+        if (texSize.x == 0 || texSize.y == 0) return;
+        float su = 1.0f / static_cast<float>(texSize.x);
+        float sv = 1.0f / static_cast<float>(texSize.y);
+        for (size_t i = 0; i + 1 < texcoords.size(); i += 2) {
+            texcoords[i] *= su;
+            texcoords[i + 1] *= sv;
+            if (texture->isFlippedY()) texcoords[i + 1] = 1.0f - texcoords[i + 1];
+        }
         SDL2Renderer::getInstance().drawTriangles(
             positions.data(), positions.size() / 2,
-            colors.data(), nullptr, 0
+            colors.data(), texcoords.data(),
+            texture->getNativeHandle(), SDL2Renderer::ShaderType::Sprite
         );
+        return;
     }
+
+    // Use shape shader (no texture)
+    glUseProgram(SDL2Renderer::getInstance().getShaderProgram(SDL2Renderer::ShaderType::Shape));
+    SDL2Renderer::getInstance().drawTriangles(
+        positions.data(), positions.size() / 2,
+        colors.data(), nullptr, 0
+    );
 }
 
 void Sprite::draw(RenderTarget& target, RenderStates states) const {
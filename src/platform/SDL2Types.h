@@ -417,19 +417,22 @@ inline const BlendMode BlendMode::Add{};
 inline const BlendMode BlendMode::Multiply{};
 inline const BlendMode BlendMode::None{};
 
-// Forward declare Shader for RenderStates
+// Forward declare Shader / Texture for RenderStates
 class Shader;
+class Texture;
 
 class RenderStates {
 public:
     Transform transform;
     BlendMode blendMode;
     const Shader* shader = nullptr;
+    const Texture* texture = nullptr;
 
     RenderStates() = default;
     RenderStates(const Transform& t) : transform(t) {}
     RenderStates(const BlendMode& mode) : blendMode(mode) {}
     RenderStates(const Shader* s) : shader(s) {}
+    RenderStates(const Texture* t) : texture(t) {}
     static const RenderStates Default;
 };
 
@@ -8,6 +8,7 @@ Runs 6 benchmark scenarios to establish baseline performance metrics:
 4. Mixed UI - 100 frames, 10 animating (realistic case)
 5. Deep hierarchy - 5 levels of nesting (propagation cost)
 6. Grid stress - Large grid with entities (known bottleneck)
+7. Animation stress - 10,000 simultaneous scalar tweens (per-tween cost)
 
 Usage:
     ./mcrogueface --headless --exec tests/benchmarks/benchmark_suite.py
@@ -54,6 +55,7 @@ def collect_metrics(timer, runtime):
         'entity_render_time': m['entity_render_time'],
         'python_time': m['python_time'],
         'animation_time': m['animation_time'],
+        'animations_updated': m['animations_updated'],
         'grid_cells_rendered': m['grid_cells_rendered'],
         'entities_rendered': m['entities_rendered'],
     })
@@ -87,6 +89,7 @@ def finish_scenario():
         'avg_entity_render_time': avg('entity_render_time'),
         'avg_python_time': avg('python_time'),
         'avg_animation_time': avg('animation_time'),
+        'avg_animations': avg('animations_updated'),
         'avg_grid_cells': avg('grid_cells_rendered'),
         'avg_entities': avg('entities_rendered'),
         'max_frame_time': max(s['frame_time'] for s in metrics_samples),
@@ -120,6 +123,7 @@ def run_next_scenario():
         ('4_mixed_100', setup_mixed_100),
         ('5_deep_hierarchy', setup_deep_hierarchy),
         ('6_grid_stress', setup_grid_stress),
+        ('7_animation_stress', setup_animation_stress),
     ]
 
     # Find current index
@@ -307,6 +311,25 @@ def setup_grid_stress():
     bench_grid.activate()
 
 
+def setup_animation_stress():
+    """Scenario 7: 10,000 scalar tweens - per-tween animation cost."""
+    bench_tweens = mcrfpy.Scene("bench_tweens")
+    ui = bench_tweens.children
+
+    props = [("x", 900.0), ("y", 700.0), ("w", 20.0), ("h", 20.0), ("opacity", 0.2),
+             ("outline", 2.0), ("fill_color.r", 255.0), ("fill_color.g", 0.0),
+             ("fill_color.b", 255.0), ("rotation", 90.0)]
+    easings = [mcrfpy.Easing.LINEAR, mcrfpy.Easing.EASE_IN_OUT_QUAD, mcrfpy.Easing.EASE_OUT_CUBIC]
+    for i in range(1000):
+        frame = mcrfpy.Frame(pos=((i % 40) * 25, (i // 40) * 25), size=(10, 10))
+        ui.append(frame)
+        # Long enough to outlast warmup + measurement
+        for j, (prop, target) in enumerate(props):
+            frame.animate(prop, target, 60.0, easings[(i + j) % len(easings)])
+
+    mcrfpy.current_scene = bench_tweens
+
+
 # ============================================================================
 # Results Output
 # ============================================================================
@@ -333,6 +356,14 @@ def print_results():
         if 'pct_grid' in r:
             print(f"{name:<20} {r['pct_grid']:>7.1f}% {r['pct_entity']:>7.1f}% {r['pct_python']:>7.1f}% {r['pct_animation']:>7.1f}% {r['pct_other']:>7.1f}%")
 
+    print("\n" + "-" * 70)
+    print("ANIMATION COST")
+    print("-" * 70)
+    for name, r in results.items():
+        if r.get('avg_animations', 0) > 0:
+            per_tween_us = r['avg_animation_time'] * 1000.0 / r['avg_animations']
+            print(f"{name:<20} {r['avg_animations']:>8.0f} tweens {per_tween_us:>8.3f} us/tween")
+
     print("\n" + "=" * 70)
 
     # Performance assessment
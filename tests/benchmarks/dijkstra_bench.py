@@ -1,5 +1,9 @@
 """Benchmark: single-root, multi-root, DiscreteMap-mask Dijkstra plus invert+descent.
 
+Also times A* (find_path) corner-to-corner and the collide= occupancy overlay
+with many labeled entities, up to 1024x1024 grids, and the incremental repair
+of a held map after single-cell walkability edits against a full recompute.
+
 Usage:
   ./mcrogueface --headless --exec ../tests/benchmarks/dijkstra_bench.py
 """
@@ -14,7 +18,11 @@ sys.path.insert(0, os.path.dirname(__file__))
 import _baseline
 
 
-GRID_SIZES = [(100, 100), (500, 500)]
+GRID_SIZES = [(100, 100), (500, 500), (1024, 1024)]
+COLLIDE_ENTITIES = 2000
+REPAIR_SIZE = (512, 512)
+REPAIR_EDITS = 200
+REPAIR_WALL_DENSITY = 0.1
 ROOT_COUNTS = [1, 2, 5, 20]
 MASK_DENSITY = 0.05
 TRIALS = 5
@@ -80,6 +88,57 @@ def bench_invert_descent(g, root, trials):
     return invert_t * 1000.0, descent_t * 1e6, ok // trials
 
 
+def bench_find_path(g, trials):
+    w, h = g.grid_w, g.grid_h
+    t0 = time.perf_counter()
+    for _ in range(trials):
+        p = g.find_path((1, 1), (w - 2, h - 2))
+    return (time.perf_counter() - t0) / trials * 1000.0, len(p) if p else 0
+
+
+def bench_collide(g, rng, trials):
+    w, h = g.grid_w, g.grid_h
+    for (x, y) in random_points(w, h, COLLIDE_ENTITIES, rng):
+        e = mcrfpy.Entity((x, y), grid=g)
+        e.add_label("blocker")
+    root = (w // 2, h // 2)
+    total = 0.0
+    for _ in range(trials):
+        g.clear_dijkstra_maps()
+        t0 = time.perf_counter()
+        _ = g.get_dijkstra_map(root, collide="blocker")
+        total += time.perf_counter() - t0
+    dijkstra_ms = total / trials * 1000.0
+    t0 = time.perf_counter()
+    for _ in range(trials):
+        _ = g.find_path((1, 1), (w - 2, h - 2), collide="blocker")
+    astar_ms = (time.perf_counter() - t0) / trials * 1000.0
+    return dijkstra_ms, astar_ms
+
+
+def bench_repair(rng):
+    """Single-cell edits on a held map: repaired on the next query vs recompute."""
+    w, h = REPAIR_SIZE
+    g = make_grid(w, h)
+    for (x, y) in random_points(w, h, int(w * h * REPAIR_WALL_DENSITY), rng):
+        g.at(x, y).walkable = False
+    root = (w // 2, h // 2)
+    g.at(*root).walkable = True
+    dmap = g.get_dijkstra_map(root)
+
+    repair_total = 0.0
+    for _ in range(REPAIR_EDITS):
+        c = g.at(rng.randrange(w), rng.randrange(h))
+        c.walkable = not c.walkable
+        t0 = time.perf_counter()
+        dmap.distance(root)  # first query after the edit repairs the field
+        repair_total += time.perf_counter() - t0
+    repair_us = repair_total / REPAIR_EDITS * 1e6
+
+    recompute_ms = bench_compute(g, [root], TRIALS) * 1000.0
+    return repair_us, recompute_ms
+
+
 def main():
     rng = random.Random(SEED)
     out = {"runs": []}
@@ -114,6 +173,30 @@ def main():
         print(f"  {w}x{h} invert             mean={inv_ms:7.2f} ms")
         print(f"  {w}x{h} descent_step/call  mean={desc_us:7.2f} us  valid={valid}")
 
+        # A* corner to corner
+        astar_ms, steps = bench_find_path(g, TRIALS)
+        out["runs"].append({"grid": f"{w}x{h}", "kind": "find_path",
+                            "mean_ms": astar_ms, "steps": steps})
+        print(f"  {w}x{h} find_path          mean={astar_ms:7.2f} ms  steps={steps}")
+
+        # collide= overlay (runs last: it adds entities to the grid)
+        col_dij_ms, col_astar_ms = bench_collide(g, rng, TRIALS)
+        out["runs"].append({"grid": f"{w}x{h}", "kind": "dijkstra_collide",
+                            "entities": COLLIDE_ENTITIES, "mean_ms": col_dij_ms})
+        out["runs"].append({"grid": f"{w}x{h}", "kind": "find_path_collide",
+                            "entities": COLLIDE_ENTITIES, "mean_ms": col_astar_ms})
+        print(f"  {w}x{h} dijkstra collide   mean={col_dij_ms:7.2f} ms")
+        print(f"  {w}x{h} find_path collide  mean={col_astar_ms:7.2f} ms")
+
+    w, h = REPAIR_SIZE
+    repair_us, recompute_ms = bench_repair(rng)
+    out["runs"].append({"grid": f"{w}x{h}", "kind": "repair_single_cell",
+                        "edits": REPAIR_EDITS, "mean_us": repair_us})
+    out["runs"].append({"grid": f"{w}x{h}", "kind": "recompute",
+                        "mean_ms": recompute_ms})
+    print(f"  {w}x{h} repair 1 cell      mean={repair_us:7.2f} us")
+    print(f"  {w}x{h} full recompute     mean={recompute_ms:7.2f} ms")
+
     print(json.dumps(out, indent=2))
     _baseline.write("dijkstra_bench.json", out)
     print("DONE")
@@ -4,11 +4,15 @@ Measures the cost of `entity.update_visibility()` (which writes through the
 DiscreteMap-backed `entity.perspective_map`, the FOV optimization landed via
 #294 / commit f797120) versus a bare `grid.compute_fov(...)` call (no
 per-entity bookkeeping). The delta is the cost of the perspective writeback.
+It also times `grid.update_visibility()`, which updates every entity's
+perspective in one call with the FOVs computed in parallel, and the same
+batched update with `entity.compact_perspective` (bitplane memory).
 
 Configurations:
   - 100 entities on 1000x1000 grid
   - radii: 8, 16, 32
-  - FOV algorithms: BASIC, SHADOW, SYMMETRIC_SHADOWCAST
+  - FOV algorithms: BASIC, SHADOW, SYMMETRIC_SHADOWCAST (libtcod) and
+    NATIVE_SYMMETRIC, NATIVE_FAST (native shadowcasting)
 
 Output: JSON to stdout; baseline copy written to ./fov_opt_bench_results.json
 when run from the build/ directory.
@@ -34,6 +38,8 @@ ALGORITHMS = [
     ("BASIC",                mcrfpy.FOV.BASIC),
     ("SHADOW",               mcrfpy.FOV.SHADOW),
     ("SYMMETRIC_SHADOWCAST", mcrfpy.FOV.SYMMETRIC_SHADOWCAST),
+    ("NATIVE_SYMMETRIC",     mcrfpy.FOV.NATIVE_SYMMETRIC),
+    ("NATIVE_FAST",          mcrfpy.FOV.NATIVE_FAST),
 ]
 SEED = 0x1A2B
 WARMUP_ROUNDS = 1
@@ -70,6 +76,13 @@ def measure_update_visibility(entities, rounds):
     return (time.perf_counter() - t0) / rounds
 
 
+def measure_batched(grid, rounds):
+    t0 = time.perf_counter()
+    for _ in range(rounds):
+        grid.update_visibility()
+    return (time.perf_counter() - t0) / rounds
+
+
 def measure_grid_compute_only(grid, entities, radius, algorithm, rounds):
     # entity.x/.y are pixel coords (UIDrawable). compute_fov takes grid coords.
     coords = [(e.grid_pos.x, e.grid_pos.y) for e in entities]
@@ -100,10 +113,12 @@ def main():
 
             with_t = measure_update_visibility(entities, MEASURED_ROUNDS)
             wo_t   = measure_grid_compute_only(grid, entities, radius, algo, MEASURED_ROUNDS)
+            batch_t = measure_batched(grid, MEASURED_ROUNDS)
 
             with_per_us = with_t / N_ENTITIES * 1e6
             wo_per_us   = wo_t / N_ENTITIES * 1e6
             overhead_us = with_per_us - wo_per_us
+            batch_per_us = batch_t / N_ENTITIES * 1e6
 
             entry = {
                 "grid": f"{GRID_W}x{GRID_H}",
@@ -115,12 +130,36 @@ def main():
                 "with_perspective_per_entity_us": with_per_us,
                 "without_perspective_per_entity_us": wo_per_us,
                 "perspective_overhead_per_entity_us": overhead_us,
+                "batched_round_ms": batch_t * 1000.0,
+                "batched_per_entity_us": batch_per_us,
             }
             runs.append(entry)
             print(f"  {aname:<22} r={radius:<2}  "
                   f"compute={wo_per_us:7.2f} us/ent  "
                   f"+perspective={with_per_us:7.2f} us/ent  "
-                  f"(overhead {overhead_us:+6.2f} us)")
+                  f"(overhead {overhead_us:+6.2f} us)  "
+                  f"batched={batch_per_us:7.2f} us/ent")
+
+    # Compact (bitplane) perspectives: same batched update, a quarter of the
+    # perspective memory. Toggling converts each entity's existing map.
+    compact = []
+    grid.fov = mcrfpy.FOV.NATIVE_SYMMETRIC
+    for e in entities:
+        e.compact_perspective = True
+    for radius in RADII:
+        grid.fov_radius = radius
+        measure_batched(grid, WARMUP_ROUNDS)
+        t = measure_batched(grid, MEASURED_ROUNDS)
+        per_us = t / N_ENTITIES * 1e6
+        compact.append({
+            "algorithm": "NATIVE_SYMMETRIC",
+            "radius": radius,
+            "batched_round_ms": t * 1000.0,
+            "batched_per_entity_us": per_us,
+        })
+        print(f"  compact NATIVE_SYMMETRIC r={radius:<2}  batched={per_us:7.2f} us/ent")
+    for e in entities:
+        e.compact_perspective = False
 
     out = {
         "config": {
@@ -133,6 +172,11 @@ def main():
             "seed": SEED,
         },
         "runs": runs,
+        "compact_runs": compact,
+        "perspective_bytes_per_entity": {
+            "byte_map": GRID_W * GRID_H,
+            "compact": 2 * 8 * ((GRID_W + 63) // 64) * GRID_H,
+        },
     }
     print(json.dumps(out, indent=2))
     _baseline.write("fov_opt_bench.json", out)
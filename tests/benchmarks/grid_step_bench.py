@@ -3,6 +3,13 @@
 100 entities on a 100x100 grid, 1000 rounds. Mix of IDLE / NOISE4 / SEEK / FLEE.
 Reports total time, mean per-round, p95 per-round.
 
+A second, large scenario (20k entities on 400x400, some hunting with a
+target_label) compares serial grid.step() against grid.step(parallel=True).
+
+A third (N seekers on 200x200 sharing one collide= map, so every move
+changes the map's obstacles) times rounds with that map against the same
+seekers on a plain map: the difference is the per-move collide repair.
+
 Usage:
   ./mcrogueface --headless --exec ../tests/benchmarks/grid_step_bench.py
 """
@@ -22,6 +29,82 @@ N_ENTITIES = 100
 N_ROUNDS = 1000
 SEED = 0x37
 
+LARGE_W, LARGE_H = 400, 400
+LARGE_ENTITIES = 20000
+LARGE_ROUNDS = 10
+
+COLLIDE_W, COLLIDE_H = 200, 200
+COLLIDE_SEEKERS = 1000
+COLLIDE_ROUNDS = 20
+
+
+def build_large(name, rng):
+    scene = mcrfpy.Scene(name)
+    mcrfpy.current_scene = scene
+    grid = mcrfpy.Grid(grid_size=(LARGE_W, LARGE_H))
+    scene.children.append(grid)
+    for y in range(LARGE_H):
+        for x in range(LARGE_W):
+            c = grid.at(x, y)
+            open_cell = 0 < x < LARGE_W - 1 and 0 < y < LARGE_H - 1 and (x % 9, y % 9) != (4, 4)
+            c.walkable = open_cell
+            c.transparent = open_cell
+
+    attractor = grid.get_dijkstra_map((LARGE_W // 2, LARGE_H // 2))
+    safety = attractor.invert()
+    for i in range(LARGE_ENTITIES):
+        ex = rng.randrange(1, LARGE_W - 1)
+        ey = rng.randrange(1, LARGE_H - 1)
+        e = mcrfpy.Entity((ex, ey), grid=grid)
+        e.move_speed = 0
+        mix = i % 4
+        if mix == 0:
+            e.set_behavior(int(mcrfpy.Behavior.SEEK), pathfinder=attractor)
+        elif mix == 1:
+            e.set_behavior(int(mcrfpy.Behavior.FLEE), pathfinder=safety)
+            e.labels = {"prey"}
+        elif mix == 2:
+            e.set_behavior(int(mcrfpy.Behavior.PATROL),
+                           waypoints=[(ex, ey), (LARGE_W - 1 - ex, ey)])
+        else:
+            e.set_behavior(int(mcrfpy.Behavior.SLEEP), turns=LARGE_ROUNDS * 2)
+            e.target_label = "prey"
+            e.sight_radius = 6
+    return grid
+
+
+def time_large(parallel):
+    grid = build_large("bench_step_par" if parallel else "bench_step_ser",
+                       random.Random(SEED))
+    t0 = time.perf_counter()
+    grid.step(n=LARGE_ROUNDS, parallel=parallel)
+    return (time.perf_counter() - t0) / LARGE_ROUNDS
+
+
+def time_collide(collide, parallel):
+    rng = random.Random(SEED)
+    scene = mcrfpy.Scene(f"bench_step_collide_{int(collide)}{int(parallel)}")
+    mcrfpy.current_scene = scene
+    grid = mcrfpy.Grid(grid_size=(COLLIDE_W, COLLIDE_H))
+    scene.children.append(grid)
+    for y in range(COLLIDE_H):
+        for x in range(COLLIDE_W):
+            c = grid.at(x, y)
+            open_cell = 0 < x < COLLIDE_W - 1 and 0 < y < COLLIDE_H - 1
+            c.walkable = open_cell
+            c.transparent = open_cell
+    goal = grid.get_dijkstra_map((COLLIDE_W // 2, COLLIDE_H // 2),
+                                 collide="seeker" if collide else None)
+    for _ in range(COLLIDE_SEEKERS):
+        e = mcrfpy.Entity((rng.randrange(1, COLLIDE_W - 1), rng.randrange(1, COLLIDE_H - 1)),
+                          grid=grid)
+        e.move_speed = 0
+        e.labels = {"seeker"}
+        e.set_behavior(int(mcrfpy.Behavior.SEEK), pathfinder=goal)
+    t0 = time.perf_counter()
+    grid.step(n=COLLIDE_ROUNDS, parallel=parallel)
+    return (time.perf_counter() - t0) / COLLIDE_ROUNDS
+
 
 def main():
     rng = random.Random(SEED)
@@ -78,10 +161,42 @@ def main():
         "p95_round_ms": p95 * 1000.0,
         "per_entity_step_us": per_step_us,
     }
+
+    large_serial = time_large(False)
+    large_parallel = time_large(True)
+    out.update({
+        "large_grid": f"{LARGE_W}x{LARGE_H}",
+        "large_entities": LARGE_ENTITIES,
+        "large_rounds": LARGE_ROUNDS,
+        "large_serial_round_ms": large_serial * 1000.0,
+        "large_parallel_round_ms": large_parallel * 1000.0,
+        "large_parallel_speedup": large_serial / large_parallel if large_parallel > 0 else 0.0,
+    })
+    collide_rows = []
+    for parallel in (False, True):
+        plain = time_collide(False, parallel)
+        shared = time_collide(True, parallel)
+        collide_rows.append({
+            "mode": "parallel" if parallel else "serial",
+            "plain_round_ms": plain * 1000.0,
+            "collide_round_ms": shared * 1000.0,
+        })
+    out.update({
+        "collide_grid": f"{COLLIDE_W}x{COLLIDE_H}",
+        "collide_seekers": COLLIDE_SEEKERS,
+        "collide_rounds": COLLIDE_ROUNDS,
+        "collide_runs": collide_rows,
+    })
     print(f"  total:         {total:.2f} s")
     print(f"  mean round:    {out['mean_round_ms']:.3f} ms")
     print(f"  p95 round:     {out['p95_round_ms']:.3f} ms")
     print(f"  per-entity:    {out['per_entity_step_us']:.2f} us")
+    print(f"  large serial:   {out['large_serial_round_ms']:.3f} ms/round")
+    print(f"  large parallel: {out['large_parallel_round_ms']:.3f} ms/round "
+          f"({out['large_parallel_speedup']:.2f}x)")
+    for row in collide_rows:
+        print(f"  {COLLIDE_SEEKERS} seekers, one collide map ({row['mode']}): "
+              f"{row['collide_round_ms']:.3f} ms/round vs {row['plain_round_ms']:.3f} plain")
     print(json.dumps(out, indent=2))
     _baseline.write("grid_step_bench.json", out)
     print("DONE")
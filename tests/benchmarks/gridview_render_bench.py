@@ -8,6 +8,15 @@ screenshot is one full render of all currently-mounted children.
 We measure mean wall time per screenshot for view counts {1, 2, 4} on the same
 underlying grid, with grid cells populated to mimic a real overworld scene.
 
+A second case, "huge world, small viewport", puts HUGE_ENTITIES entities on a
+HUGE_W x HUGE_H map and pans a single small view over it, so the per-frame
+cost of culling entities to the viewport dominates. Each frame nudges the
+camera so the #351 clean-frame early-out cannot skip the render.
+
+A third case, "strategic overview", zooms a tiled OVERVIEW_W x OVERVIEW_H map
+out through OVERVIEW_ZOOMS, down to the whole map in one view; far zooms draw
+from mip-level chunk caches and the one-pixel-per-cell overview.
+
 Usage:
   ./mcrogueface --headless --exec ../tests/benchmarks/gridview_render_bench.py
 """
@@ -15,6 +24,7 @@ import mcrfpy
 from mcrfpy import automation
 import sys
 import os
+import random
 import time
 import json
 import tempfile
@@ -28,6 +38,10 @@ N_FRAMES = 60
 WARMUP_FRAMES = 5
 VIEW_COUNTS = [1, 2, 4]
 VIEW_PIXEL_SIZE = (320, 320)
+HUGE_W, HUGE_H = 1000, 1000
+HUGE_ENTITIES = 200_000
+OVERVIEW_W, OVERVIEW_H = 4096, 4096
+OVERVIEW_ZOOMS = [1.0, 0.25, 0.05, 0.005]
 
 
 def populate_grid(g):
@@ -88,6 +102,74 @@ def bench(view_count, tmpdir):
     }
 
 
+def bench_huge_world(tmpdir):
+    scene = mcrfpy.Scene("bench_huge_world")
+    grid = mcrfpy.Grid(grid_size=(HUGE_W, HUGE_H), pos=(0, 0), size=VIEW_PIXEL_SIZE)
+    scene.children.append(grid)
+    mcrfpy.current_scene = scene
+
+    rng = random.Random(12345)
+    t0 = time.perf_counter()
+    for _ in range(HUGE_ENTITIES):
+        mcrfpy.Entity((rng.randrange(HUGE_W), rng.randrange(HUGE_H)), grid=grid)
+    populate_s = time.perf_counter() - t0
+
+    times = []
+    visible = []
+    for i in range(WARMUP_FRAMES + N_FRAMES):
+        grid.center_camera((HUGE_W / 2 + (i % 8) * 0.25, HUGE_H / 2))
+        path = os.path.join(tmpdir, f"huge_{i}.png")
+        t0 = time.perf_counter()
+        automation.screenshot(path)
+        dt = time.perf_counter() - t0
+        if i >= WARMUP_FRAMES:
+            times.append(dt)
+            visible.append(mcrfpy.get_metrics()["entities_rendered"])
+
+    times.sort()
+    mean = sum(times) / len(times)
+    return {
+        "grid": f"{HUGE_W}x{HUGE_H}",
+        "entities": HUGE_ENTITIES,
+        "populate_sec": populate_s,
+        "frames": N_FRAMES,
+        "mean_frame_ms": mean * 1000.0,
+        "p95_frame_ms": times[int(0.95 * len(times))] * 1000.0,
+        "mean_entities_rendered": sum(visible) / len(visible),
+    }
+
+
+def bench_overview(tmpdir):
+    scene = mcrfpy.Scene("bench_overview")
+    tiles = mcrfpy.TileLayer(name="terrain", z_index=-1, texture=mcrfpy.default_texture)
+    grid = mcrfpy.Grid(grid_size=(OVERVIEW_W, OVERVIEW_H), pos=(0, 0),
+                       size=VIEW_PIXEL_SIZE, layers=[tiles])
+    scene.children.append(grid)
+    mcrfpy.current_scene = scene
+    for i in range(64):
+        tiles.fill_rect((0, i * 64), (OVERVIEW_W, 64), i % 40)
+
+    results = []
+    for zoom in OVERVIEW_ZOOMS:
+        grid.zoom = zoom
+        times = []
+        for i in range(WARMUP_FRAMES + N_FRAMES):
+            grid.center_camera((OVERVIEW_W / 2 + (i % 8) * 0.25, OVERVIEW_H / 2))
+            path = os.path.join(tmpdir, f"overview_{i}.png")
+            t0 = time.perf_counter()
+            automation.screenshot(path)
+            dt = time.perf_counter() - t0
+            if i >= WARMUP_FRAMES:
+                times.append(dt)
+        times.sort()
+        results.append({
+            "zoom": zoom,
+            "mean_frame_ms": sum(times) / len(times) * 1000.0,
+            "p95_frame_ms": times[int(0.95 * len(times))] * 1000.0,
+        })
+    return {"grid": f"{OVERVIEW_W}x{OVERVIEW_H}", "frames": N_FRAMES, "zooms": results}
+
+
 def main():
     runs = []
     with tempfile.TemporaryDirectory(prefix="mcrf_bench_") as tmpdir:
@@ -100,13 +182,23 @@ def main():
                   f"fps~{r['implied_fps']:6.1f}  "
                   f"per-view={r['per_view_frame_ms']:6.2f} ms")
 
+        huge = bench_huge_world(tmpdir)
+        print(f"  huge world: {huge['entities']} entities on {huge['grid']}, "
+              f"~{huge['mean_entities_rendered']:.0f} on screen  "
+              f"mean={huge['mean_frame_ms']:7.2f} ms  p95={huge['p95_frame_ms']:7.2f} ms")
+
+        overview = bench_overview(tmpdir)
+        for z in overview["zooms"]:
+            print(f"  overview {overview['grid']} zoom={z['zoom']:<6} "
+                  f"mean={z['mean_frame_ms']:7.2f} ms  p95={z['p95_frame_ms']:7.2f} ms")
+
     base = runs[0]["mean_frame_ms"]
     print()
     for r in runs[1:]:
         ratio = r["mean_frame_ms"] / base if base > 0 else 0
         print(f"  views={r['views']}: total frame time vs 1-view = {ratio:.2f}x")
 
-    out = {"runs": runs, "config": {
+    out = {"runs": runs, "huge_world": huge, "overview": overview, "config": {
         "grid": f"{GRID_W}x{GRID_H}",
         "frames": N_FRAMES,
         "warmup_frames": WARMUP_FRAMES,
@@ -5,6 +5,10 @@ Kanban #37 coverage: pathfinding throughput at varying obstacle densities (10/30
 plus an explicit with-vs-without collision-label comparison (10 / 100 entities tagged
 'blocker' on a 100x100 grid).
 
+The hierarchical section compares Heuristic.HIERARCHICAL against plain A* on a large
+walled map: graph build time, rebuild time after one walkability edit, per-query time
+and path length relative to A*.
+
 Usage:
   ./mcrogueface --headless --exec ../tests/benchmarks/pathfinding_bench.py
 """
@@ -36,6 +40,11 @@ COLLIDE_DENSITY = 0.10
 COLLIDE_BLOCKER_COUNTS = [0, 10, 100]
 COLLIDE_TRIALS = 20
 
+HPA_GRID = (1024, 1024)
+HPA_WALL_SPACING = (40, 60)  # vertical / horizontal wall pitch
+HPA_GAP_CHANCE = 0.04        # chance a wall cell is left open
+HPA_QUERIES = 40
+
 SEED = 0x315
 
 
@@ -135,6 +144,74 @@ def collide_block_section(rng):
     return runs
 
 
+def make_walled_grid(w, h, rng):
+    """Open floor cut into rooms by long walls with scattered gaps: the layout
+    where flat A* floods the most and the cluster graph helps the most."""
+    g = mcrfpy.Grid(grid_size=(w, h))
+    xs, ys = HPA_WALL_SPACING
+    for y in range(h):
+        for x in range(w):
+            wall = (x % xs == xs // 2 or y % ys == ys // 2) and rng.random() > HPA_GAP_CHANCE
+            c = g.at(x, y)
+            c.walkable = not wall
+            c.transparent = not wall
+    return g
+
+
+def hierarchical_section(rng):
+    w, h = HPA_GRID
+    g = make_walled_grid(w, h, rng)
+    pairs = []
+    while len(pairs) < HPA_QUERIES:
+        a = (rng.randrange(w), rng.randrange(h))
+        b = (rng.randrange(w), rng.randrange(h))
+        if g.at(*a).walkable and g.at(*b).walkable:
+            pairs.append((a, b))
+
+    t0 = time.perf_counter()
+    g.find_path(pairs[0][0], pairs[0][1], heuristic=mcrfpy.Heuristic.HIERARCHICAL)
+    build_ms = (time.perf_counter() - t0) * 1000.0
+
+    t_astar = t_hpa = 0.0
+    ratio_sum = 0.0
+    found = 0
+    for a, b in pairs:
+        t0 = time.perf_counter()
+        pa = g.find_path(a, b, heuristic=mcrfpy.Heuristic.DIAGONAL)
+        t1 = time.perf_counter()
+        ph = g.find_path(a, b, heuristic=mcrfpy.Heuristic.HIERARCHICAL)
+        t2 = time.perf_counter()
+        t_astar += t1 - t0
+        t_hpa += t2 - t1
+        if pa is not None and ph is not None and len(pa) > 0:
+            found += 1
+            ratio_sum += len(ph) / len(pa)
+
+    x, y = w // 2, h // 2
+    g.at(x, y).walkable = not g.at(x, y).walkable
+    before = g.hpa_stats["cluster_rebuilds"]
+    t0 = time.perf_counter()
+    g.find_path(pairs[0][0], pairs[0][1], heuristic=mcrfpy.Heuristic.HIERARCHICAL)
+    edit_ms = (time.perf_counter() - t0) * 1000.0
+    stats = g.hpa_stats
+
+    result = {
+        "grid": f"{w}x{h}",
+        "build_ms": build_ms,
+        "edit_rebuild_ms": edit_ms,
+        "edit_clusters_rebuilt": stats["cluster_rebuilds"] - before,
+        "astar_mean_ms": t_astar / len(pairs) * 1000.0,
+        "hierarchical_mean_ms": t_hpa / len(pairs) * 1000.0,
+        "mean_length_ratio": ratio_sum / max(found, 1),
+        "stats": stats,
+    }
+    print(f"  {w}x{h} build={build_ms:.1f} ms  edit={edit_ms:.2f} ms "
+          f"({result['edit_clusters_rebuilt']} clusters)  "
+          f"A*={result['astar_mean_ms']:.2f} ms  HPA*={result['hierarchical_mean_ms']:.2f} ms  "
+          f"len ratio={result['mean_length_ratio']:.3f}")
+    return result
+
+
 def main():
     rng = random.Random(SEED)
     out = {"config": {
@@ -168,6 +245,10 @@ def main():
           f"{COLLIDE_TRIALS} trials/config) ===")
     out["collide_runs"] = collide_block_section(rng)
 
+    print()
+    print(f"=== Hierarchical vs flat A* ({HPA_GRID[0]}x{HPA_GRID[1]}, {HPA_QUERIES} queries) ===")
+    out["hierarchical"] = hierarchical_section(rng)
+
     print(json.dumps(out, indent=2))
     _baseline.write("pathfinding_bench.json", out)
     print("DONE")
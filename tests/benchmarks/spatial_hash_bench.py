@@ -9,6 +9,11 @@ For each (count, radius) pair we measure:
   - speedup factor
   - mean hit count
 
+Per entity count we also time moves (`entity.cell_pos = ...`, one re-bucket
+each). If a previous baseline JSON exists, each query time is printed next to
+it ("before -> after") and kept as `previous_spatial_per_query_us`, so the
+numbers from before a SpatialHash change survive the rewrite.
+
 Headless mode. Output: JSON to stdout.
 
 Usage:
@@ -29,6 +34,7 @@ GRID_W, GRID_H = 200, 200
 ENTITY_COUNTS = [100, 1000, 10000]
 RADII = [1, 5, 10, 50]
 QUERIES_PER_CONFIG = 200
+MOVE_ROUNDS = 5
 SAMPLE_QUERY_LOCATIONS = 50  # how many distinct (x,y) sample positions
 SEED = 0xCAFE
 
@@ -99,9 +105,35 @@ def bench_naive(g, points, radius, queries):
     return elapsed / queries, hits_total / queries
 
 
+def bench_moves(ents, rng, rounds):
+    """Mean time per cell move; each move re-buckets the entity."""
+    moves = 0
+    t0 = time.perf_counter()
+    for _ in range(rounds):
+        for e in ents:
+            x = min(GRID_W - 1, max(0, int(e.cell_pos.x) + rng.choice((-1, 1))))
+            e.cell_pos = (x, int(e.cell_pos.y))
+            moves += 1
+    return (time.perf_counter() - t0) / moves
+
+
+def load_previous():
+    path = os.path.join(os.path.dirname(__file__), "baseline", "phase5_2",
+                        "spatial_hash_bench.json")
+    try:
+        with open(path) as f:
+            prev = json.load(f)
+    except (OSError, ValueError):
+        return {}
+    return {(r["entities"], r["radius"]): r["spatial_per_query_us"]
+            for r in prev.get("runs", []) if "radius" in r}
+
+
 def main():
     rng = random.Random(SEED)
+    previous = load_previous()
     runs = []
+    moves = []
     for n_ent in ENTITY_COUNTS:
         scene = mcrfpy.Scene(f"spatial_{n_ent}")
         mcrfpy.current_scene = scene
@@ -129,12 +161,21 @@ def main():
                 "spatial_mean_hits": sp_hits,
                 "naive_mean_hits": nv_hits,
             }
+            before = previous.get((n_ent, radius))
+            if before is not None:
+                entry["previous_spatial_per_query_us"] = before
             runs.append(entry)
             print(f"  n={n_ent:>5}  r={radius:<3}  "
                   f"spatial={sp_t * 1e6:9.2f} us  "
                   f"naive={nv_t * 1e6:10.2f} us  "
                   f"speedup={speedup:7.2f}x  "
-                  f"hits={sp_hits:6.1f} (naive={nv_hits:6.1f})")
+                  f"hits={sp_hits:6.1f} (naive={nv_hits:6.1f})"
+                  + (f"  before={before:9.2f} us -> after={sp_t * 1e6:9.2f} us"
+                     if before is not None else ""))
+
+        move_t = bench_moves(ents, rng, MOVE_ROUNDS)
+        moves.append({"entities": n_ent, "per_move_us": move_t * 1e6})
+        print(f"  n={n_ent:>5}  move      {move_t * 1e6:9.2f} us / move")
 
         # Tear down entities so they don't leak into the next iteration's grid.
         for e in ents:
@@ -150,8 +191,10 @@ def main():
             "queries_per_config": QUERIES_PER_CONFIG,
             "sample_query_locations": SAMPLE_QUERY_LOCATIONS,
             "seed": SEED,
+            "move_rounds": MOVE_ROUNDS,
         },
         "runs": runs,
+        "moves": moves,
     }
     print(json.dumps(out, indent=2))
     _baseline.write("spatial_hash_bench.json", out)
@@ -85,6 +85,25 @@ def run_test(timer, runtime):
         times.append(elapsed)
     print(f"  Average: {sum(times)/len(times):.2f}ms for ~961 grid.at() calls")
 
+    # Test 4: libtcod algorithms vs native shadowcasting. The origin alternates
+    # so compute_fov()'s same-origin dedup never skips a run.
+    print("\n--- Test 4: FOV algorithm comparison (compute_fov only) ---")
+    algorithms = [
+        ("BASIC", mcrfpy.FOV.BASIC),
+        ("SHADOW", mcrfpy.FOV.SHADOW),
+        ("SYMMETRIC_SHADOWCAST", mcrfpy.FOV.SYMMETRIC_SHADOWCAST),
+        ("NATIVE_SYMMETRIC", mcrfpy.FOV.NATIVE_SYMMETRIC),
+        ("NATIVE_FAST", mcrfpy.FOV.NATIVE_FAST),
+    ]
+    for radius, reps in ((15, 200), (0, 5)):
+        for name, algo in algorithms:
+            t0 = time.perf_counter()
+            for i in range(reps):
+                grid.compute_fov((500 + (i & 1), 500), radius=radius, algorithm=algo)
+            elapsed = (time.perf_counter() - t0) * 1000 / reps
+            label = f"r={radius}" if radius else "r=unlimited"
+            print(f"  {name:<22} {label:<12} {elapsed:8.3f}ms per call")
+
     print("\n" + "=" * 60)
     print("CONCLUSION:")
     print("After #146 fix, compute_fov() returns None instead of building")
@@ -21,6 +21,8 @@ DYNAMIC = [
     "animations",
     "default_transition",
     "default_transition_duration",
+    "chunk_cache_budget",
+    "occlusion_culling",
     "save_dir",
 ]
 READONLY = ["scenes", "timers", "animations", "save_dir"]
@@ -0,0 +1,117 @@
+"""Batched animations: scalar float tweens with a built-in easing are kept in
+per-easing structure-of-arrays tracks and advanced together, reported by
+get_metrics()["animations_batched"] / ["animations_updated"].
+
+Batched tweens must land the same values as the per-object path, fire their
+callbacks once, and honour stop(), complete(), elapsed and mcrfpy.animations;
+compound values and loops keep the per-object path.
+"""
+import mcrfpy
+import sys
+
+
+def close(a, b):
+    return abs(a - b) < 1e-3
+
+
+def make(name):
+    scene = mcrfpy.Scene(name)
+    mcrfpy.current_scene = scene
+    return scene
+
+
+def test_batched_values():
+    scene = make("anim_batch_values")
+    frames = []
+    for i in range(200):
+        f = mcrfpy.Frame(pos=(0, 0), size=(10, 10))
+        scene.children.append(f)
+        frames.append(f)
+        f.animate("x", 100.0, 1.0, mcrfpy.Easing.EASE_IN_QUAD)
+        f.animate("y", 50.0, 1.0, mcrfpy.Easing.LINEAR, delta=True)
+    mcrfpy.step(0.5)
+    m = mcrfpy.get_metrics()
+    assert m["animations_batched"] == 400, m["animations_batched"]
+    assert m["animations_updated"] == 400, m["animations_updated"]
+    assert close(frames[0].x, 25.0), frames[0].x        # 100 * 0.5^2
+    assert close(frames[0].y, 25.0), frames[0].y
+    assert len(mcrfpy.animations) == 400
+    mcrfpy.step(0.6)
+    assert close(frames[199].x, 100.0) and close(frames[199].y, 50.0)
+    assert len(mcrfpy.animations) == 0, "finished tweens are removed"
+    print("PASS: scalar tweens are batched and land the per-object values")
+
+
+def test_unbatched_kinds():
+    scene = make("anim_batch_kinds")
+    f = mcrfpy.Frame(pos=(0, 0), size=(10, 10))
+    scene.children.append(f)
+    f.animate("position", (10.0, 10.0), 1.0)
+    f.animate("opacity", 0.0, 1.0, loop=True)
+    f.animate("fill_color.r", 10, 1.0)  # int target: per-object
+    mcrfpy.step(0.1)
+    m = mcrfpy.get_metrics()
+    assert m["animations_batched"] == 0 and m["animations_updated"] == 3, m
+    print("PASS: compound values, loops and int targets stay per-object")
+
+
+def test_control():
+    scene = make("anim_batch_control")
+    a = mcrfpy.Frame(pos=(0, 0), size=(10, 10))
+    b = mcrfpy.Frame(pos=(0, 0), size=(10, 10))
+    scene.children.append(a)
+    scene.children.append(b)
+    done = []
+    anim_a = a.animate("x", 100.0, 1.0, callback=lambda t, p, v: done.append("a"))
+    anim_b = b.animate("x", 100.0, 1.0, callback=lambda t, p, v: done.append("b"))
+    mcrfpy.step(0.25)
+    assert close(anim_a.elapsed, 0.25), anim_a.elapsed
+    assert not anim_a.is_complete
+
+    anim_a.stop()
+    mcrfpy.step(0.25)
+    assert close(a.x, 25.0), "a stopped tween must not move its target"
+
+    anim_b.complete()
+    assert close(b.x, 100.0), "complete() jumps to the final value"
+    mcrfpy.step(0.01)
+    mcrfpy.step(2.0)
+    assert done == ["b"], done
+    print("PASS: stop, complete, elapsed and callbacks behave as before")
+
+
+def test_callback_once():
+    scene = make("anim_batch_callback")
+    hits = []
+    for i in range(50):
+        f = mcrfpy.Frame(pos=(0, 0), size=(10, 10))
+        scene.children.append(f)
+        f.animate("opacity", 0.5, 0.2, mcrfpy.Easing.EASE_OUT_CUBIC,
+                  callback=lambda t, p, v: hits.append(v))
+    for _ in range(5):
+        mcrfpy.step(0.1)
+    assert len(hits) == 50, len(hits)
+    print("PASS: each batched tween fires its callback once")
+
+
+def test_target_removed():
+    scene = make("anim_batch_removed")
+    f = mcrfpy.Frame(pos=(0, 0), size=(10, 10))
+    scene.children.append(f)
+    f.animate("x", 100.0, 1.0)
+    scene.children.remove(f)
+    del f
+    mcrfpy.step(0.1)
+    mcrfpy.step(0.1)
+    assert len(mcrfpy.animations) == 0, "tweens on destroyed targets are dropped"
+    print("PASS: tweens on destroyed targets are dropped")
+
+
+if __name__ == "__main__":
+    test_batched_values()
+    test_unbatched_kinds()
+    test_control()
+    test_callback_once()
+    test_target_removed()
+    print("All animation batch tests passed")
+    sys.exit(0)
@@ -0,0 +1,95 @@
+"""Animation property ids: animated property names are interned once and
+applied through each drawable's typed setter table instead of a chain of
+string compares, and property locks are keyed by (target, id).
+
+Every table entry must land the same value the name-based setProperty()
+did, aliases must share a setter, and properties outside the tables
+(vectors, colors, shader uniforms) must keep working by name.
+"""
+import mcrfpy
+import sys
+
+
+def finish():
+    for _ in range(3):
+        mcrfpy.step(0.5)
+
+
+def close(a, b):
+    return abs(a - b) < 1e-3
+
+
+def test_frame_table():
+    scene = mcrfpy.Scene("anim_ids_frame")
+    mcrfpy.current_scene = scene
+    f = mcrfpy.Frame(pos=(0, 0), size=(10, 10))
+    scene.children.append(f)
+    targets = {"x": 40.0, "y": 30.0, "w": 80.0, "h": 60.0, "outline": 3.0,
+               "opacity": 0.25, "rotation": 45.0}
+    for prop, value in targets.items():
+        f.animate(prop, value, 1.0)
+    f.animate("origin_x", 5.0, 1.0)
+    f.animate("fill_color.r", 200, 1.0)
+    f.animate("outline_color.a", 100.0, 1.0)
+    f.animate("fill_color", (1, 2, 3, 4), 1.0)  # not in the table: by name
+    finish()
+    for prop, value in targets.items():
+        assert close(getattr(f, prop), value), (prop, getattr(f, prop))
+    assert close(f.origin.x, 5.0), f.origin
+    assert f.fill_color.r == 1 and f.fill_color.a == 4, f.fill_color
+    assert f.outline_color.a == 100, f.outline_color
+    print("PASS: frame float properties land through the setter table")
+
+
+def test_caption_sprite_entity():
+    scene = mcrfpy.Scene("anim_ids_misc")
+    mcrfpy.current_scene = scene
+    c = mcrfpy.Caption(text="hi", pos=(0, 0))
+    s = mcrfpy.Sprite(pos=(0, 0))
+    grid = mcrfpy.Grid(grid_size=(10, 10), pos=(0, 100), size=(160, 160))
+    e = mcrfpy.Entity(grid_pos=(1, 1), grid=grid)
+    for d in (c, s, grid):
+        scene.children.append(d)
+    c.animate("size", 30.0, 1.0)  # alias of font_size
+    c.animate("fill_color.g", 10.0, 1.0)
+    s.animate("scale_x", 2.0, 1.0)
+    s.animate("z_index", 7.0, 1.0)
+    e.animate("x", 4.0, 1.0)      # alias of draw_x
+    e.animate("sprite_offset_y", 3.0, 1.0)
+    finish()
+    assert c.font_size == 30, c.font_size
+    assert c.fill_color.g == 10, c.fill_color
+    assert close(s.scale_x, 2.0) and s.z_index == 7, (s.scale_x, s.z_index)
+    assert close(e.draw_pos.x, 4.0), e.draw_pos
+    assert close(e.sprite_offset.y, 3.0), e.sprite_offset
+    print("PASS: caption, sprite and entity aliases share their setters")
+
+
+def test_locks_by_id():
+    scene = mcrfpy.Scene("anim_ids_locks")
+    mcrfpy.current_scene = scene
+    a = mcrfpy.Frame(pos=(0, 0), size=(10, 10))
+    b = mcrfpy.Frame(pos=(0, 0), size=(10, 10))
+    scene.children.append(a)
+    scene.children.append(b)
+    a.animate("x", 100.0, 1.0)
+    b.animate("x", 50.0, 1.0, conflict_mode="error")  # other target: no conflict
+    a.animate("y", 50.0, 1.0, conflict_mode="error")  # other property: no conflict
+    try:
+        a.animate("x", 10.0, 1.0, conflict_mode="error")
+    except RuntimeError:
+        pass
+    else:
+        raise AssertionError("same (target, property) must conflict")
+    a.animate("x", 10.0, 1.0)  # replace
+    finish()
+    assert close(a.x, 10.0) and close(b.x, 50.0) and close(a.y, 50.0), (a.x, b.x, a.y)
+    print("PASS: property locks are per (target, property id)")
+
+
+if __name__ == "__main__":
+    test_frame_table()
+    test_caption_sprite_entity()
+    test_locks_by_id()
+    print("All animation property id tests passed")
+    sys.exit(0)
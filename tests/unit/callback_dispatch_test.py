@@ -0,0 +1,92 @@
+"""Callback dispatch: click, hover, timer and step callbacks are called through
+vectorcall with cached enum members and reused argument objects.
+
+Enum arguments must be the canonical members, a position a callback keeps
+must not be rewritten by later events, and timer/step callbacks must still
+receive their usual arguments.
+"""
+import mcrfpy
+from mcrfpy import automation
+import sys
+
+
+def test_click_enums():
+    scene = mcrfpy.Scene("dispatch_click")
+    mcrfpy.current_scene = scene
+    frame = mcrfpy.Frame(pos=(100, 100), size=(200, 200))
+    scene.children.append(frame)
+    events = []
+    frame.on_click = lambda pos, button, action: events.append((pos, button, action))
+    automation.click((150, 160))
+    mcrfpy.step(0.05)
+    automation.click((170, 180))
+    mcrfpy.step(0.05)
+    assert len(events) >= 2, events
+    pos, button, action = events[0]
+    assert button is mcrfpy.MouseButton.LEFT, repr(button)
+    assert action is mcrfpy.InputState.PRESSED or action is mcrfpy.InputState.RELEASED
+    assert (pos.x, pos.y) == (150, 160), "a kept position must not be rewritten"
+    last = events[-1][0]
+    assert (last.x, last.y) == (170, 180), last
+    print("PASS: click callbacks get cached enum members and stable positions")
+
+
+def test_move_positions():
+    scene = mcrfpy.Scene("dispatch_move")
+    mcrfpy.current_scene = scene
+    frame = mcrfpy.Frame(pos=(100, 100), size=(200, 200))
+    scene.children.append(frame)
+    kept = []
+    seen = []
+
+    def on_move(pos):
+        seen.append((pos.x, pos.y))
+        if len(seen) == 2:
+            kept.append(pos)
+
+    frame.on_move = on_move
+    for xy in ((150, 150), (160, 150), (170, 150), (180, 150)):
+        automation.moveTo(xy)
+        mcrfpy.step(0.05)
+    assert len(seen) >= 3, seen
+    assert kept and (kept[0].x, kept[0].y) == seen[1], (kept, seen)
+    print("PASS: hover positions are reused only when the callback kept none")
+
+
+def test_timer_args():
+    mcrfpy.current_scene = mcrfpy.Scene("dispatch_timer")
+    calls = []
+    timers = [mcrfpy.Timer(f"dispatch_{i}", lambda t, rt: calls.append((t, rt)), 100)
+              for i in range(3)]
+    mcrfpy.step(0.1)
+    assert [c[0] for c in calls] == timers, calls
+    assert len({c[1] for c in calls}) == 1 and calls[0][1] >= 100, calls
+    for t in timers:
+        t.stop()
+    print("PASS: timers due together get (timer, runtime)")
+
+
+def test_step_trigger():
+    scene = mcrfpy.Scene("dispatch_step")
+    mcrfpy.current_scene = scene
+    grid = mcrfpy.Grid(grid_size=(5, 5))
+    scene.children.append(grid)
+    for y in range(5):
+        for x in range(5):
+            grid.at(x, y).walkable = (x, y) == (2, 2)
+    e = mcrfpy.Entity((2, 2), grid=grid)
+    e.set_behavior(int(mcrfpy.Behavior.WAYPOINT), waypoints=[(0, 0)])
+    triggers = []
+    e.step = lambda trigger, data: triggers.append(trigger)
+    grid.step(n=3)
+    assert triggers and all(t is mcrfpy.Trigger.BLOCKED for t in triggers), triggers
+    print("PASS: step callbacks get the cached Trigger member")
+
+
+if __name__ == "__main__":
+    test_click_enums()
+    test_move_positions()
+    test_timer_args()
+    test_step_trigger()
+    print("All callback dispatch tests passed")
+    sys.exit(0)
@@ -0,0 +1,97 @@
+"""Batched captions: each caption keeps its glyph layout between frames, and
+consecutive captions on the same font page draw as one call, reported by
+get_metrics()["ui_batch_draw_calls"] and ["glyph_runs_built"].
+
+Color and opacity changes reuse the layout; text, size and outline changes
+rebuild it. Anything that is not a caption or sprite splits the run so the
+on-screen order is unchanged.
+"""
+import mcrfpy
+from mcrfpy import automation
+import sys
+import os
+import tempfile
+
+SHOT = os.path.join(tempfile.gettempdir(), "caption_batch.png")
+
+
+def render():
+    automation.screenshot(SHOT)
+    return mcrfpy.get_metrics()
+
+
+def make(name):
+    scene = mcrfpy.Scene(name)
+    mcrfpy.current_scene = scene
+    return scene
+
+
+def test_one_draw_per_page():
+    scene = make("captions_one")
+    for i in range(500):
+        scene.children.append(mcrfpy.Caption(text=f"{i * 7}", pos=(i % 25 * 40, i // 25 * 20)))
+    m = render()
+    assert m["ui_batch_draw_calls"] == 1, f"expected 1 batched draw, got {m['ui_batch_draw_calls']}"
+    assert m["draw_calls"] == 1, m["draw_calls"]
+    assert m["glyph_runs_built"] == 500, m["glyph_runs_built"]
+    print("PASS: 500 captions on one font page draw in one call")
+
+
+def test_layout_cache():
+    scene = make("captions_cache")
+    caps = [mcrfpy.Caption(text=f"HP {i}", pos=(10, i * 16)) for i in range(20)]
+    for c in caps:
+        scene.children.append(c)
+    render()
+    assert render()["glyph_runs_built"] == 0, "unchanged captions must not be laid out again"
+
+    for c in caps:
+        c.fill_color = mcrfpy.Color(255, 0, 0)
+        c.opacity = 0.5
+        c.x += 3
+    assert render()["glyph_runs_built"] == 0, "color, opacity and moves reuse the layout"
+
+    caps[0].text = "HP 99"
+    caps[1].font_size = 20
+    caps[2].outline = 2
+    m = render()
+    assert m["glyph_runs_built"] == 3, m["glyph_runs_built"]
+    print("PASS: glyph runs rebuild only on text, size and outline changes")
+
+
+def test_runs_keep_order():
+    scene = make("captions_runs")
+    for i in range(5):
+        scene.children.append(mcrfpy.Caption(text="a", pos=(0, i * 10)))
+    scene.children.append(mcrfpy.Frame(pos=(0, 0), size=(10, 10)))
+    for i in range(5):
+        scene.children.append(mcrfpy.Caption(text="b", pos=(20, i * 10)))
+    scene.children.append(mcrfpy.Caption(text="c", pos=(40, 0), font_size=30))
+    m = render()
+    # two runs split by the frame, then a new page for the larger size
+    assert m["ui_batch_draw_calls"] == 3, m["ui_batch_draw_calls"]
+    print("PASS: frames and font pages split runs in list order")
+
+
+def test_frame_children():
+    scene = make("captions_frame")
+    hud = mcrfpy.Frame(pos=(0, 0), size=(300, 300))
+    scene.children.append(hud)
+    for i in range(50):
+        hud.children.append(mcrfpy.Caption(text=f"{i}", pos=(i % 5 * 50, i // 5 * 20)))
+    hidden = mcrfpy.Caption(text="hidden", pos=(0, 280))
+    hidden.visible = False
+    hud.children.append(hidden)
+    m = render()
+    assert m["ui_batch_draw_calls"] == 1, m["ui_batch_draw_calls"]
+    assert m["glyph_runs_built"] == 50, "hidden captions are not laid out"
+    print("PASS: a frame's captions batch into one call")
+
+
+if __name__ == "__main__":
+    test_one_draw_per_page()
+    test_layout_cache()
+    test_runs_keep_order()
+    test_frame_children()
+    print("All caption batch render tests passed")
+    sys.exit(0)
@@ -0,0 +1,89 @@
+"""Chunk texture budget: grid layers share one LRU cache of chunk render
+textures, sized by mcrfpy.chunk_cache_budget.
+
+Panning over a map larger than the budget must evict old chunks and keep
+residency within the budget; evicted chunks re-render identically when they
+come back into view. get_metrics() reports hits, misses, evictions and
+residency.
+"""
+import mcrfpy
+from mcrfpy import automation
+import sys
+import os
+import tempfile
+
+SHOT = os.path.join(tempfile.gettempdir(), "chunk_cache_budget.png")
+
+
+def frame():
+    automation.screenshot(SHOT)
+    with open(SHOT, "rb") as f:
+        return f.read(), mcrfpy.get_metrics()
+
+
+def build():
+    scene = mcrfpy.Scene("chunk_budget")
+    tiles = mcrfpy.TileLayer(name="tiles", z_index=-1, texture=mcrfpy.default_texture)
+    g = mcrfpy.Grid(grid_size=(1024, 256), pos=(0, 0), size=(320, 320), layers=[tiles])
+    scene.children.append(g)
+    mcrfpy.current_scene = scene
+    for x in range(0, 1024, 8):
+        tiles.fill_rect((x, 0), (8, 256), x // 8 % 40)
+    return g, tiles
+
+
+def test_budget_and_eviction():
+    default = mcrfpy.chunk_cache_budget
+    assert default > 0
+    g, tiles = build()
+    g.center_camera((32, 32))  # one chunk in view
+    first, m = frame()
+    assert m["chunk_cache_misses"] >= 1 and m["chunk_cache_chunks"] >= 1
+    chunk_bytes = m["chunk_cache_bytes"] // m["chunk_cache_chunks"]
+
+    budget = 3 * chunk_bytes
+    mcrfpy.chunk_cache_budget = budget
+    assert mcrfpy.chunk_cache_budget == budget
+    evicted = 0
+    for cx in range(32, 1024, 64):  # pan across 16 chunks
+        g.center_camera((cx, 32))
+        _, m = frame()
+        evicted += m["chunk_cache_evictions"]
+        assert m["chunk_cache_bytes"] <= budget, (m["chunk_cache_bytes"], budget)
+    assert evicted > 0, "panning past the budget must evict chunks"
+
+    g.center_camera((32, 32))
+    again, m = frame()
+    assert m["chunk_cache_misses"] >= 1, "the first chunk was evicted and must re-render"
+    assert again == first, "re-rendered chunk differs from the original"
+
+    g.center_camera((32.25, 32))  # nudge: re-raster the same chunk
+    _, m = frame()
+    assert m["chunk_cache_misses"] == 0 and m["chunk_cache_hits"] >= 1
+
+    tiles.set((32, 32), 7)  # resident but edited: rasterized again
+    _, m = frame()
+    assert m["chunk_cache_misses"] >= 1 and m["chunk_cache_hits"] == 0, m
+
+    mcrfpy.chunk_cache_budget = 0
+    assert mcrfpy.get_metrics()["chunk_cache_chunks"] == 0, "lowering the budget evicts at once"
+    mcrfpy.chunk_cache_budget = default
+    print("PASS: chunk textures stay within the budget and re-render after eviction")
+
+
+def test_budget_validation():
+    for bad, exc in ((-1, ValueError), (1.5, TypeError), ("big", TypeError)):
+        try:
+            mcrfpy.chunk_cache_budget = bad
+        except exc:
+            pass
+        else:
+            raise AssertionError(f"chunk_cache_budget = {bad!r} should raise {exc.__name__}")
+    print("PASS: chunk_cache_budget rejects negative and non-int values")
+
+
+if __name__ == "__main__":
+    test_budget_and_eviction()
+    test_budget_validation()
+    print("All chunk cache budget tests passed")
+    sys.exit(0)
@@ -0,0 +1,145 @@
+"""Compact (bitplane) perspective memory: Entity.compact_perspective.
+
+A compact entity must report exactly the same Perspective values as a byte-map
+entity through every path (update_visibility, grid.update_visibility, at(),
+perspective_map), and convert losslessly in both directions.
+"""
+import mcrfpy
+import random
+import sys
+
+VISIBLE = mcrfpy.Perspective.VISIBLE
+DISCOVERED = mcrfpy.Perspective.DISCOVERED
+UNKNOWN = mcrfpy.Perspective.UNKNOWN
+
+# Wider than one 64-bit word so rows span several words.
+W, H = 150, 40
+
+
+def make_grid(seed=3):
+    g = mcrfpy.Grid(grid_size=(W, H))
+    rng = random.Random(seed)
+    for y in range(H):
+        for x in range(W):
+            c = g.at(x, y)
+            c.walkable = True
+            c.transparent = rng.randrange(6) != 0
+    return g
+
+
+def snapshot(entity):
+    return entity.perspective_map.to_bytes()
+
+
+PATH = [(10, 10), (70, 12), (75, 30), (140, 5), (63, 20), (64, 21), (0, 39)]
+
+
+def run(compact, batched, radius):
+    g = make_grid()
+    g.fov_radius = radius
+    e = mcrfpy.Entity(PATH[0], grid=g)
+    other = mcrfpy.Entity((120, 30), grid=g)
+    e.compact_perspective = compact
+    states = []
+    for pos in PATH:
+        e.cell_pos = pos
+        if batched:
+            g.update_visibility()
+        else:
+            e.update_visibility()
+        states.append(snapshot(e))
+    return states
+
+
+def test_default_off():
+    g = make_grid()
+    e = mcrfpy.Entity((1, 1), grid=g)
+    assert e.compact_perspective is False
+    print("PASS: compact_perspective defaults to False")
+
+
+def test_matches_byte_map():
+    for radius in (0, 3, 8, 40):
+        for batched in (False, True):
+            a = run(True, batched, radius)
+            b = run(False, batched, radius)
+            assert a == b, f"compact differs (radius {radius}, batched {batched})"
+    print("PASS: compact perspective matches the byte map over moves")
+
+
+def test_at_and_values():
+    g = make_grid()
+    g.fov_radius = 6
+    e = mcrfpy.Entity((30, 20), grid=g)
+    e.compact_perspective = True
+    e.update_visibility()
+    assert e.perspective_map.get((30, 20)) == VISIBLE
+    assert e.at((30, 20)) is not None
+    e.cell_pos = (100, 20)
+    e.update_visibility()
+    assert e.perspective_map.get((30, 20)) == DISCOVERED
+    assert e.at((30, 20)) is None
+    assert e.perspective_map.get((5, 5)) == UNKNOWN
+    print("PASS: Perspective values and at() on a compact entity")
+
+
+def test_toggle_round_trip():
+    g = make_grid()
+    g.fov_radius = 7
+    e = mcrfpy.Entity((40, 10), grid=g)
+    e.update_visibility()
+    e.cell_pos = (90, 25)
+    e.update_visibility()
+    before = snapshot(e)
+    e.compact_perspective = True
+    assert snapshot(e) == before
+    e.compact_perspective = False
+    assert snapshot(e) == before
+    # The windowed demote still works after switching forms.
+    e.compact_perspective = True
+    e.cell_pos = (10, 30)
+    e.update_visibility()
+    assert e.perspective_map.get((90, 25)) == DISCOVERED
+    print("PASS: toggling converts losslessly and keeps demote state")
+
+
+def test_snapshot_and_assignment():
+    g = make_grid()
+    g.fov_radius = 5
+    e = mcrfpy.Entity((20, 20), grid=g)
+    e.compact_perspective = True
+    e.update_visibility()
+    snap = e.perspective_map
+    snap.set(0, 0, int(DISCOVERED))
+    assert e.perspective_map.get((0, 0)) == UNKNOWN, "getter must return a copy"
+
+    saved = e.perspective_map.to_bytes()
+    loaded = mcrfpy.DiscreteMap.from_bytes(saved, (W, H))
+    e2 = mcrfpy.Entity((100, 5), grid=g)
+    e2.compact_perspective = True
+    e2.perspective_map = loaded
+    assert e2.perspective_map.to_bytes() == saved
+    e2.update_visibility()
+    assert e2.perspective_map.get((20, 20)) == DISCOVERED, "loaded VISIBLE must demote"
+
+    bad = mcrfpy.DiscreteMap((W, H), fill=7)
+    try:
+        e2.perspective_map = bad
+    except ValueError:
+        pass
+    else:
+        raise AssertionError("values above 2 should raise ValueError")
+
+    e2.perspective_map = None
+    assert e2.perspective_map.get((20, 20)) == UNKNOWN
+    print("PASS: snapshot getter, from_bytes load, and None reset")
+
+
+if __name__ == "__main__":
+    test_default_off()
+    test_matches_byte_map()
+    test_at_and_values()
+    test_toggle_round_trip()
+    test_snapshot_and_assignment()
+    print("All compact perspective tests passed")
+    sys.exit(0)
@@ -0,0 +1,170 @@
+"""Dijkstra map cache: LRU byte budget, staleness handling, counters.
+
+get_dijkstra_map() caches single-root maps per (root, collide label). The
+cache is bounded by grid.dijkstra_cache_budget bytes and never serves a map
+that predates a walkability change (or, for collide maps, a labelled entity
+move); both are repaired in place when few cells changed.
+"""
+import mcrfpy
+import random
+import sys
+
+
+def make_grid(w=20, h=20):
+    g = mcrfpy.Grid(grid_size=(w, h))
+    for y in range(h):
+        for x in range(w):
+            c = g.at(x, y)
+            c.walkable = True
+            c.transparent = True
+    return g
+
+
+def test_hits_and_misses():
+    g = make_grid()
+    s0 = g.dijkstra_cache_stats
+    a = g.get_dijkstra_map((1, 1))
+    b = g.get_dijkstra_map((1, 1))
+    s1 = g.dijkstra_cache_stats
+    assert a.distance((5, 1)) == b.distance((5, 1))
+    assert s1["misses"] - s0["misses"] == 1, s1
+    assert s1["hits"] - s0["hits"] == 1, s1
+    assert s1["entries"] == 1 and s1["bytes"] > 0, s1
+    print("PASS: cache hit/miss counters")
+
+
+def test_walkability_invalidates():
+    """A wall placed after caching is honored without clear_dijkstra_maps()."""
+    g = make_grid(10, 3)
+    before = g.get_dijkstra_map((0, 1))
+    assert abs(before.distance((9, 1)) - 9.0) < 0.01
+    for y in range(3):
+        g.at(5, y).walkable = False
+    after = g.get_dijkstra_map((0, 1))
+    assert after.distance((9, 1)) is None, "stale map served after walkability change"
+    s = g.dijkstra_cache_stats
+    assert s["invalidations"] + s["repairs"] >= 1, s
+    # Maps already handed out follow the grid too.
+    assert before.distance((9, 1)) is None
+    print("PASS: walkability change invalidates cached maps")
+
+
+def test_transparency_does_not_invalidate():
+    g = make_grid()
+    g.get_dijkstra_map((2, 2))
+    s0 = g.dijkstra_cache_stats
+    g.at(7, 7).transparent = False
+    g.get_dijkstra_map((2, 2))
+    s = g.dijkstra_cache_stats
+    assert s["invalidations"] == s0["invalidations"], "transparency edit should not drop pathfinding maps"
+    assert s["repairs"] == s0["repairs"], "transparency edit should not touch pathfinding maps"
+    print("PASS: transparency edits keep the cache")
+
+
+def test_collide_map_tracks_entity_moves():
+    g = make_grid(10, 1)
+    scene = mcrfpy.Scene("dijkstra_cache_collide")
+    scene.children.append(g)
+    blocker = mcrfpy.Entity((5, 0), grid=g)
+    blocker.add_label("wall")
+    m1 = g.get_dijkstra_map((0, 0), collide="wall")
+    assert m1.distance((9, 0)) is None
+    blocker.cell_pos = (9, 0)
+    m2 = g.get_dijkstra_map((0, 0), collide="wall")
+    assert abs(m2.distance((8, 0)) - 8.0) < 0.01, "collide map not refreshed after move"
+    print("PASS: collide maps refresh when entities move")
+
+
+def test_collide_moves_are_repaired():
+    """Labelled entities entering or leaving cells are repaired, not recomputed."""
+    rng = random.Random(0x5EED)
+    g = make_grid(24, 24)
+    scene = mcrfpy.Scene("dijkstra_cache_collide_repair")
+    scene.children.append(g)
+    for _ in range(60):
+        g.at(rng.randrange(24), rng.randrange(24)).walkable = False
+    g.at(12, 12).walkable = True
+    movers = []
+    for _ in range(30):
+        e = mcrfpy.Entity((rng.randrange(24), rng.randrange(24)), grid=g)
+        e.add_label("crowd")
+        movers.append(e)
+    bystander = mcrfpy.Entity((0, 0), grid=g)
+    held = g.get_dijkstra_map((12, 12), collide="crowd")
+    for _ in range(5):
+        for e in rng.sample(movers, 4):
+            e.cell_pos = (rng.randrange(24), rng.randrange(24))
+        bystander.cell_pos = (rng.randrange(24), rng.randrange(24))
+        s0 = g.dijkstra_cache_stats
+        assert g.get_dijkstra_map((12, 12), collide="crowd") is held
+        s1 = g.dijkstra_cache_stats
+        assert s1["repairs"] == s0["repairs"] + 1, s1
+        assert s1["invalidations"] == s0["invalidations"], s1
+    g.clear_dijkstra_maps()
+    fresh = g.get_dijkstra_map((12, 12), collide="crowd")
+    for y in range(24):
+        for x in range(24):
+            assert held.distance((x, y)) == fresh.distance((x, y)), (x, y)
+    print("PASS: collide maps repair the cells labelled entities entered or left")
+
+
+def test_budget_evicts_lru():
+    g = make_grid(64, 64)
+    g.get_dijkstra_map((0, 0))
+    one = g.dijkstra_cache_stats["bytes"]
+    g.dijkstra_cache_budget = one * 3
+    assert g.dijkstra_cache_budget == one * 3
+    for i in range(1, 6):
+        g.get_dijkstra_map((i, 0))
+    s = g.dijkstra_cache_stats
+    assert s["entries"] == 3, s
+    assert s["bytes"] <= s["budget"], s
+    assert s["evictions"] >= 3, s
+    # (5,0) is most recent and must still hit; (0,0) was evicted.
+    hits = s["hits"]
+    g.get_dijkstra_map((5, 0))
+    assert g.dijkstra_cache_stats["hits"] == hits + 1
+    misses = g.dijkstra_cache_stats["misses"]
+    g.get_dijkstra_map((0, 0))
+    assert g.dijkstra_cache_stats["misses"] == misses + 1
+    print("PASS: byte budget evicts least-recently-used maps")
+
+
+def test_budget_zero_disables():
+    g = make_grid()
+    g.get_dijkstra_map((3, 3))
+    g.dijkstra_cache_budget = 0
+    s = g.dijkstra_cache_stats
+    assert s["entries"] == 0 and s["bytes"] == 0, s
+    g.get_dijkstra_map((3, 3))
+    assert g.dijkstra_cache_stats["entries"] == 0
+    try:
+        g.dijkstra_cache_budget = -1
+    except ValueError:
+        pass
+    else:
+        raise AssertionError("negative budget should raise ValueError")
+    print("PASS: budget 0 disables caching")
+
+
+def test_clear():
+    g = make_grid()
+    g.get_dijkstra_map((1, 1))
+    g.get_dijkstra_map((2, 2))
+    g.clear_dijkstra_maps()
+    s = g.dijkstra_cache_stats
+    assert s["entries"] == 0 and s["bytes"] == 0, s
+    print("PASS: clear_dijkstra_maps empties the cache")
+
+
+if __name__ == "__main__":
+    test_hits_and_misses()
+    test_walkability_invalidates()
+    test_transparency_does_not_invalidate()
+    test_collide_map_tracks_entity_moves()
+    test_collide_moves_are_repaired()
+    test_budget_evicts_lru()
+    test_budget_zero_disables()
+    test_clear()
+    print("All Dijkstra cache tests passed")
+    sys.exit(0)
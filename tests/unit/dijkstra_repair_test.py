@@ -0,0 +1,141 @@
+"""Incremental Dijkstra repair after localized walkability edits.
+
+Maps from get_dijkstra_map() stay attached to their grid. After a few cell
+edits the next query patches only the affected region; the result must match
+a map computed from scratch on the edited grid.
+"""
+import mcrfpy
+import random
+import sys
+
+
+def make_grid(w, h, wall_chance=0.0, seed=1):
+    rng = random.Random(seed)
+    g = mcrfpy.Grid(grid_size=(w, h))
+    for y in range(h):
+        for x in range(w):
+            c = g.at(x, y)
+            c.walkable = rng.random() >= wall_chance
+            c.transparent = True
+    return g
+
+
+def fresh(g, root, **kw):
+    """A map computed from scratch (bypasses the cache)."""
+    g.clear_dijkstra_maps()
+    return g.get_dijkstra_map(root, **kw)
+
+
+def assert_same(a, b, w, h, what):
+    for y in range(h):
+        for x in range(w):
+            da, db = a.distance((x, y)), b.distance((x, y))
+            if da is None or db is None:
+                assert da is None and db is None, f"{what}: ({x},{y}) {da} vs {db}"
+            else:
+                assert abs(da - db) < 0.001, f"{what}: ({x},{y}) {da} vs {db}"
+
+
+def test_repair_matches_recompute():
+    w, h = 24, 18
+    rng = random.Random(7)
+    for diagonal in (1.41, 0.0):
+        g = make_grid(w, h, wall_chance=0.25, seed=3)
+        root = (w // 2, h // 2)
+        g.at(*root).walkable = True
+        live = g.get_dijkstra_map(root, diagonal_cost=diagonal)
+        for round_ in range(40):
+            for _ in range(rng.randint(1, 3)):
+                c = g.at(rng.randrange(w), rng.randrange(h))
+                c.walkable = not c.walkable
+            live.distance(root)  # triggers the repair
+            assert_same(live, fresh(g, root, diagonal_cost=diagonal), w, h,
+                        f"diag={diagonal} round {round_}")
+    print("PASS: repaired maps match a fresh recompute")
+
+
+def test_cache_counts_repairs():
+    g = make_grid(40, 40)
+    g.get_dijkstra_map((0, 0))
+    s0 = g.dijkstra_cache_stats
+    g.at(5, 5).walkable = False
+    m = g.get_dijkstra_map((0, 0))
+    s1 = g.dijkstra_cache_stats
+    assert s1["repairs"] == s0["repairs"] + 1, s1
+    assert s1["invalidations"] == s0["invalidations"], s1
+    assert s1["hits"] == s0["hits"] + 1, "a repaired map is still a cache hit"
+    assert m.distance((5, 5)) is None
+    print("PASS: single-cell edit is repaired, not recomputed")
+
+
+def test_bulk_edit_recomputes():
+    """Editing a large share of the grid falls back to a full recompute."""
+    g = make_grid(16, 16)
+    m = g.get_dijkstra_map((0, 0))
+    inv = g.dijkstra_cache_stats["invalidations"]
+    for y in range(8, 16):
+        for x in range(16):
+            g.at(x, y).walkable = False
+    g.get_dijkstra_map((0, 0))
+    assert g.dijkstra_cache_stats["invalidations"] == inv + 1
+    assert m.distance((0, 15)) is None
+    assert abs(m.distance((0, 7)) - 7.0) < 0.01
+    print("PASS: bulk edits recompute in full")
+
+
+def test_inverted_view_follows_edits():
+    g = make_grid(10, 1)
+    m = g.get_dijkstra_map((0, 0))
+    inv = m.invert()
+    assert abs(inv.distance((9, 0)) - 0.0) < 0.01
+    g.at(5, 0).walkable = False
+    # The inverted view shares the field: farthest reachable is now (4,0).
+    assert inv.distance((9, 0)) is None
+    assert abs(inv.distance((4, 0)) - 0.0) < 0.01
+    assert abs(inv.distance((0, 0)) - 4.0) < 0.01
+    step = inv.descent_step((2, 0))
+    assert (int(step.x), int(step.y)) == (3, 0), step
+    print("PASS: inverted views follow walkability edits")
+
+
+def test_seek_follows_new_wall():
+    """A SEEK entity holding a map routes around a wall placed afterwards."""
+    w, h = 9, 5
+    g = make_grid(w, h)
+    scene = mcrfpy.Scene("dijkstra_repair_seek")
+    scene.children.append(g)
+    goal = (8, 2)
+    dmap = g.get_dijkstra_map(goal)
+    e = mcrfpy.Entity((0, 2), grid=g)
+    e.move_speed = 0
+    e.set_behavior(int(mcrfpy.Behavior.SEEK), pathfinder=dmap)
+    # Wall across x=4 with a gap at the top only.
+    for y in range(1, h):
+        g.at(4, y).walkable = False
+    for _ in range(30):
+        g.step()
+        assert g.at(e.cell_x, e.cell_y).walkable, f"entity walked into a wall at {e.cell_x},{e.cell_y}"
+        if (e.cell_x, e.cell_y) == goal:
+            break
+    assert (e.cell_x, e.cell_y) == goal, f"SEEK stuck at {(e.cell_x, e.cell_y)}"
+    print("PASS: SEEK provider sees walls placed after set_behavior")
+
+
+def test_weighted_map_is_snapshot():
+    g = make_grid(6, 1)
+    weights = mcrfpy.DiscreteMap((6, 1), fill=1)
+    m = g.get_dijkstra_map((0, 0), weights=weights)
+    g.at(3, 0).walkable = False
+    assert abs(m.distance((5, 0)) - 5.0) < 0.01, "weighted maps do not follow edits"
+    print("PASS: weighted maps stay fixed snapshots")
+
+
+if __name__ == "__main__":
+    test_repair_matches_recompute()
+    test_cache_counts_repairs()
+    test_bulk_edit_recomputes()
+    test_inverted_view_follows_edits()
+    test_seek_follows_new_wall()
+    test_weighted_map_is_snapshot()
+    print("All Dijkstra repair tests passed")
+    sys.exit(0)
@@ -0,0 +1,106 @@
+"""Batched entity sprites: visible grid entities are drawn as one vertex stream
+per texture run, reported by get_metrics()["entity_draw_calls"].
+
+Opacity and tint ride in vertex colors, so they do not split a batch; a
+texture change does (list order is preserved across atlases).
+"""
+import mcrfpy
+from mcrfpy import automation
+import sys
+import os
+import tempfile
+
+SHOT = os.path.join(tempfile.gettempdir(), "entity_batch.png")
+
+
+def render():
+    automation.screenshot(SHOT)
+    return mcrfpy.get_metrics()
+
+
+def make(name):
+    scene = mcrfpy.Scene(name)
+    g = mcrfpy.Grid(grid_size=(30, 30), pos=(0, 0), size=(480, 480))
+    scene.children.append(g)
+    mcrfpy.current_scene = scene
+    return g
+
+
+def test_one_draw_per_atlas():
+    g = make("batch_one")
+    for i in range(300):
+        e = mcrfpy.Entity((i % 30, i // 30), grid=g, sprite_index=i % 50)
+        e.opacity = (i % 4 + 1) / 4
+    m = render()
+    assert m["entities_rendered"] == 300, m["entities_rendered"]
+    assert m["entity_draw_calls"] == 1, f"expected 1 batched draw, got {m['entity_draw_calls']}"
+    assert m["draw_calls"] >= m["entity_draw_calls"]
+    print("PASS: 300 entities sharing a texture draw in one call")
+
+
+def test_texture_runs():
+    g = make("batch_runs")
+    other = mcrfpy.Texture("assets/kenney_tinydungeon.png", 16, 16)
+    for i in range(10):
+        mcrfpy.Entity((i, 0), grid=g)
+    for i in range(10):
+        mcrfpy.Entity((i, 1), grid=g, texture=other)
+    mcrfpy.Entity((0, 2), grid=g)
+    m = render()
+    assert m["entity_draw_calls"] == 3, f"expected 3 texture runs, got {m['entity_draw_calls']}"
+    print("PASS: texture changes split the batch in list order")
+
+
+def test_hidden_and_composite():
+    g = make("batch_composite")
+    e = mcrfpy.Entity((5, 5), grid=g, sprite_index=0)
+    render()
+    with open(SHOT, "rb") as f:
+        single = f.read()
+    e.tile_width, e.tile_height = 2, 2
+    e.sprite_grid = [[1, 2], [3, -1]]
+    m = render()
+    with open(SHOT, "rb") as f:
+        composite = f.read()
+    assert single != composite, "sprite_grid tiles must be drawn"
+    assert m["entity_draw_calls"] == 1
+    e.visible = False
+    g.center_camera((10, 10))  # camera move forces a re-raster
+    m = render()
+    assert m["entities_rendered"] == 1
+    assert m["entity_draw_calls"] == 0, "a hidden entity queues nothing"
+    print("PASS: composite sprite_grid tiles batch with the rest; hidden entities skip")
+
+
+PASS_THROUGH = """
+    uniform sampler2D texture;
+    void main() {
+        gl_FragColor = texture2D(texture, gl_TexCoord[0].xy);
+    }
+"""
+
+
+def test_shaded_composite():
+    g = make("batch_shaded")
+    e = mcrfpy.Entity((5, 5), grid=g, sprite_index=0)
+    e.shader = mcrfpy.Shader(PASS_THROUGH)
+    m = render()
+    assert m["entity_draw_calls"] == 1, "a shaded entity draws alone"
+    with open(SHOT, "rb") as f:
+        single = f.read()
+    e.tile_width, e.tile_height = 2, 2
+    e.sprite_grid = [[1, 2], [3, -1]]
+    render()
+    with open(SHOT, "rb") as f:
+        composite = f.read()
+    assert single != composite, "a shaded composite must draw its sprite_grid tiles too"
+    print("PASS: shaded composite entities draw their tiles like batched ones")
+
+
+if __name__ == "__main__":
+    test_one_draw_per_atlas()
+    test_texture_runs()
+    test_hidden_and_composite()
+    test_shaded_composite()
+    print("All entity batch render tests passed")
+    sys.exit(0)
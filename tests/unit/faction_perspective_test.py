@@ -0,0 +1,148 @@
+"""Shared faction perspectives: grid.update_faction() / grid.faction_perspective().
+
+A faction's memory must equal the per-cell maximum of its members' own
+perspective maps (visible if any member sees the cell, discovered if any ever
+did), recompute only when something changed, and drive ColorLayers bound with
+apply_perspective(faction=...).
+"""
+import mcrfpy
+import random
+import sys
+
+W, H = 90, 30
+VISIBLE_COLOR = (255, 255, 200, 64)
+DISCOVERED_COLOR = (100, 100, 100, 128)
+UNKNOWN_COLOR = (0, 0, 0, 255)
+
+
+def make_grid(seed=5):
+    g = mcrfpy.Grid(grid_size=(W, H))
+    rng = random.Random(seed)
+    for y in range(H):
+        for x in range(W):
+            c = g.at(x, y)
+            c.walkable = True
+            c.transparent = rng.randrange(6) != 0
+    g.fov_radius = 6
+    return g
+
+
+def spawn(g, pos, label):
+    e = mcrfpy.Entity(pos, grid=g)
+    e.add_label(label)
+    return e
+
+
+def expected_union(members):
+    maps = [m.perspective_map.to_bytes() for m in members]
+    return bytes(max(col) for col in zip(*maps))
+
+
+def test_union_matches_members():
+    g = make_grid()
+    team = [spawn(g, p, "player") for p in [(5, 5), (40, 15), (70, 25)]]
+    spawn(g, (20, 20), "enemy")
+    moves = [(1, 0), (3, 1), (0, -2), (10, 0), (-4, 3)]
+    for dx, dy in moves:
+        g.update_faction("player")
+        for e in team:
+            e.update_visibility()
+        assert g.faction_perspective("player").to_bytes() == expected_union(team)
+        # Only some members move each turn.
+        x, y = team[0].cell_pos
+        team[0].cell_pos = (min(W - 1, max(0, x + dx)), min(H - 1, max(0, y + dy)))
+    print("PASS: faction memory is the union of its members' perspectives")
+
+
+def test_incremental():
+    g = make_grid()
+    a = spawn(g, (10, 10), "player")
+    assert g.update_faction("player") is True
+    assert g.update_faction("player") is False, "nothing moved"
+    a.cell_pos = (30, 10)
+    assert g.update_faction("player") is True
+    g.fov_radius = 3
+    assert g.update_faction("player") is True, "fov_radius change is a change"
+    g.at(31, 10).transparent = False
+    assert g.update_faction("player") is True, "transparency edit is a change"
+    assert g.update_faction("nobody") is True  # first update allocates memory
+    assert g.update_faction("nobody") is False
+    print("PASS: update_faction recomputes only when something changed")
+
+
+def test_membership_changes():
+    g = make_grid()
+    a = spawn(g, (10, 10), "player")
+    b = spawn(g, (60, 10), "player")
+    g.update_faction("player")
+    pm = g.faction_perspective("player")
+    assert pm.get((60, 10)) == mcrfpy.Perspective.VISIBLE
+    b.remove_label("player")
+    assert g.update_faction("player") is True
+    pm = g.faction_perspective("player")
+    assert pm.get((60, 10)) == mcrfpy.Perspective.DISCOVERED, "departed member's view demotes"
+    assert pm.get((10, 10)) == mcrfpy.Perspective.VISIBLE
+    c = spawn(g, (60, 12), "player")
+    g.update_faction("player")
+    assert g.faction_perspective("player").get((60, 12)) == mcrfpy.Perspective.VISIBLE
+    print("PASS: members joining and leaving update the union")
+
+
+def test_unknown_faction():
+    g = make_grid()
+    pm = g.faction_perspective("ghosts")
+    assert pm.get((0, 0)) == mcrfpy.Perspective.UNKNOWN
+    try:
+        g.update_faction("")
+    except ValueError:
+        pass
+    else:
+        raise AssertionError("empty label should raise ValueError")
+    print("PASS: unknown factions read as unknown")
+
+
+def color(layer, x, y):
+    c = layer.at(x, y)
+    return (c.r, c.g, c.b, c.a)
+
+
+def test_layer_binding():
+    g = make_grid()
+    a = spawn(g, (10, 10), "player")
+    b = spawn(g, (50, 20), "player")
+    layer = mcrfpy.ColorLayer(z_index=-1, grid_size=(W, H))
+    g.add_layer(layer)
+    layer.apply_perspective(faction="player", visible=VISIBLE_COLOR,
+                            discovered=DISCOVERED_COLOR, unknown=UNKNOWN_COLOR)
+    assert color(layer, 10, 10) == UNKNOWN_COLOR, "not updated yet"
+    g.update_faction("player")
+    assert color(layer, 10, 10) == VISIBLE_COLOR
+    assert color(layer, 50, 20) == VISIBLE_COLOR
+    a.cell_pos = (80, 2)
+    layer.update_perspective()  # same as g.update_faction("player")
+    assert color(layer, 10, 10) == DISCOVERED_COLOR
+    assert color(layer, 80, 2) == VISIBLE_COLOR
+    pm = g.faction_perspective("player").to_bytes()
+    expect = {0: UNKNOWN_COLOR, 1: DISCOVERED_COLOR, 2: VISIBLE_COLOR}
+    for y in range(H):
+        for x in range(W):
+            assert color(layer, x, y) == expect[pm[y * W + x]], (x, y)
+
+    for bad in ({}, {"entity": a, "faction": "player"}):
+        try:
+            layer.apply_perspective(**bad)
+        except TypeError:
+            pass
+        else:
+            raise AssertionError(f"apply_perspective({bad}) should raise TypeError")
+    print("PASS: ColorLayer bound to a faction follows update_faction")
+
+
+if __name__ == "__main__":
+    test_union_matches_members()
+    test_incremental()
+    test_membership_changes()
+    test_unknown_faction()
+    test_layer_binding()
+    print("All faction perspective tests passed")
+    sys.exit(0)
@@ -0,0 +1,128 @@
+"""Batched field of view: grid.update_visibility() and windowed FOV results.
+
+grid.update_visibility(entities=None) computes every observer's FOV in
+parallel (FOVEngine) and must leave each perspective map exactly as calling
+entity.update_visibility() one by one would.
+"""
+import mcrfpy
+import random
+import sys
+
+VISIBLE = mcrfpy.Perspective.VISIBLE
+DISCOVERED = mcrfpy.Perspective.DISCOVERED
+
+
+def make_grid(w=30, h=24, seed=7):
+    g = mcrfpy.Grid(grid_size=(w, h))
+    rng = random.Random(seed)
+    for y in range(h):
+        for x in range(w):
+            c = g.at(x, y)
+            c.walkable = True
+            c.transparent = rng.randrange(5) != 0
+    return g
+
+
+ORIGINS = [(0, 0), (29, 23), (15, 12), (3, 20), (27, 1), (10, 10), (1, 12), (22, 22)]
+
+
+def perspective(entity, w, h):
+    pmap = entity.perspective_map
+    return [[pmap.get((x, y)) for x in range(w)] for y in range(h)]
+
+
+def run(batched, algorithm, radius):
+    g = make_grid()
+    g.fov = algorithm
+    g.fov_radius = radius
+    ents = [mcrfpy.Entity(pos, grid=g) for pos in ORIGINS]
+    maps = []
+    for move in range(2):
+        if batched:
+            g.update_visibility()
+        else:
+            for e in ents:
+                e.update_visibility()
+        maps.append([perspective(e, 30, 24) for e in ents])
+        for e in ents:
+            x, y = e.cell_pos
+            e.cell_pos = (min(29, x + 3), y)
+    return maps
+
+
+def test_batch_matches_serial():
+    for algorithm in (mcrfpy.FOV.BASIC, mcrfpy.FOV.SHADOW, mcrfpy.FOV.DIAMOND,
+                      mcrfpy.FOV.PERMISSIVE_2, mcrfpy.FOV.RESTRICTIVE,
+                      mcrfpy.FOV.SYMMETRIC_SHADOWCAST):
+        for radius in (0, 1, 4, 9):
+            a = run(True, algorithm, radius)
+            b = run(False, algorithm, radius)
+            assert a == b, f"batch differs from serial for {algorithm} radius {radius}"
+    print("PASS: batched update_visibility matches per-entity updates")
+
+
+def test_demote_after_move():
+    g = make_grid()
+    g.fov_radius = 4
+    e = mcrfpy.Entity((5, 5), grid=g)
+    g.update_visibility([e])
+    assert e.perspective_map.get((5, 5)) == VISIBLE
+    e.cell_pos = (20, 5)
+    g.update_visibility([e])
+    assert e.perspective_map.get((5, 5)) == DISCOVERED, "old cells must be demoted"
+    assert e.perspective_map.get((20, 5)) == VISIBLE
+    print("PASS: batched updates demote the previous window")
+
+
+def test_window_matches_whole_grid():
+    """A radius covering the whole grid gives the unlimited (radius 0) result."""
+    g = make_grid()
+    for algorithm in (mcrfpy.FOV.BASIC, mcrfpy.FOV.SHADOW, mcrfpy.FOV.PERMISSIVE_8):
+        for pos in ORIGINS:
+            g.compute_fov(pos, radius=0, algorithm=algorithm)
+            full = [g.is_in_fov((x, y)) for y in range(24) for x in range(30)]
+            g.compute_fov(pos, radius=100, algorithm=algorithm)
+            wide = [g.is_in_fov((x, y)) for y in range(24) for x in range(30)]
+            assert full == wide, f"windowed FOV differs at {pos} ({algorithm})"
+    print("PASS: windowed FOV equals whole-grid FOV")
+
+
+def test_batch_leaves_grid_fov_alone():
+    g = make_grid()
+    g.compute_fov((0, 0), radius=3)
+    before = [g.is_in_fov((x, y)) for y in range(24) for x in range(30)]
+    mcrfpy.Entity((15, 12), grid=g)
+    g.update_visibility()
+    after = [g.is_in_fov((x, y)) for y in range(24) for x in range(30)]
+    assert before == after, "grid.update_visibility() changed is_in_fov() state"
+    print("PASS: grid.update_visibility() leaves is_in_fov() state alone")
+
+
+def test_argument_errors():
+    g = make_grid()
+    other = make_grid()
+    stranger = mcrfpy.Entity((1, 1), grid=other)
+    try:
+        g.update_visibility([stranger])
+    except ValueError:
+        pass
+    else:
+        raise AssertionError("entity from another grid should raise ValueError")
+    try:
+        g.update_visibility([1, 2])
+    except TypeError:
+        pass
+    else:
+        raise AssertionError("non-Entity should raise TypeError")
+    g.update_visibility([])
+    print("PASS: update_visibility validates its arguments")
+
+
+if __name__ == "__main__":
+    test_batch_matches_serial()
+    test_demote_after_move()
+    test_window_matches_whole_grid()
+    test_batch_leaves_grid_fov_alone()
+    test_argument_errors()
+    print("All batched FOV tests passed")
+    sys.exit(0)
@@ -0,0 +1,111 @@
+"""Native shadowcasting FOV (FOV.NATIVE_SYMMETRIC / FOV.NATIVE_FAST).
+
+Both read the grid's transparency directly instead of going through libtcod.
+NATIVE_SYMMETRIC must be symmetric (A sees B exactly when B sees A), and both
+must be usable anywhere an FOV algorithm is accepted.
+"""
+import mcrfpy
+import random
+import sys
+
+W, H = 24, 18
+
+
+def make_grid(seed=11, density=6):
+    g = mcrfpy.Grid(grid_size=(W, H))
+    rng = random.Random(seed)
+    for y in range(H):
+        for x in range(W):
+            c = g.at(x, y)
+            c.walkable = True
+            c.transparent = density == 0 or rng.randrange(density) != 0
+    return g
+
+
+def visible_set(g, pos, radius, algorithm, light_walls=True):
+    g.compute_fov(pos, radius=radius, light_walls=light_walls, algorithm=algorithm)
+    return {(x, y) for y in range(H) for x in range(W) if g.is_in_fov((x, y))}
+
+
+def test_enum_members():
+    assert mcrfpy.FOV.NATIVE_SYMMETRIC != mcrfpy.FOV.NATIVE_FAST
+    g = make_grid()
+    g.fov = mcrfpy.FOV.NATIVE_SYMMETRIC
+    assert g.fov == mcrfpy.FOV.NATIVE_SYMMETRIC
+    g.compute_fov((1, 1), algorithm=int(mcrfpy.FOV.NATIVE_FAST))
+    try:
+        g.compute_fov((1, 1), algorithm=int(mcrfpy.FOV.NATIVE_FAST) + 1)
+    except ValueError:
+        pass
+    else:
+        raise AssertionError("out-of-range algorithm int should raise ValueError")
+    print("PASS: native algorithms are FOV enum members")
+
+
+def test_open_room():
+    g = make_grid(density=0)  # everything transparent
+    seen = visible_set(g, (12, 9), 0, mcrfpy.FOV.NATIVE_SYMMETRIC)
+    assert len(seen) == W * H, len(seen)
+    seen = visible_set(g, (12, 9), 5, mcrfpy.FOV.NATIVE_SYMMETRIC)
+    assert all((x - 12) ** 2 + (y - 9) ** 2 <= 25 for x, y in seen)
+    assert (17, 9) in seen and (12, 4) in seen and (18, 9) not in seen
+    print("PASS: open room and radius limit")
+
+
+def test_walls_block():
+    g = make_grid(density=0)
+    for y in range(H):
+        g.at(10, y).transparent = False
+    for algorithm in (mcrfpy.FOV.NATIVE_SYMMETRIC, mcrfpy.FOV.NATIVE_FAST):
+        seen = visible_set(g, (5, 9), 0, algorithm)
+        assert (10, 9) in seen, "walls are lit"
+        assert not any(x > 10 for x, _ in seen), "saw through a wall"
+        dark = visible_set(g, (5, 9), 0, algorithm, light_walls=False)
+        assert (10, 9) not in dark and (9, 9) in dark
+    print("PASS: walls block sight; light_walls controls wall lighting")
+
+
+def test_symmetry():
+    g = make_grid()
+    floors = [(x, y) for y in range(H) for x in range(W) if g.at(x, y).transparent]
+    sees = {}
+    for p in floors:
+        sees[p] = visible_set(g, p, 0, mcrfpy.FOV.NATIVE_SYMMETRIC)
+    for a in floors:
+        for b in sees[a]:
+            if b in sees:
+                assert a in sees[b], f"{a} sees {b} but not the reverse"
+    print("PASS: NATIVE_SYMMETRIC is symmetric between floor cells")
+
+
+def test_fast_is_superset():
+    g = make_grid()
+    for p in [(0, 0), (12, 9), (23, 17), (5, 14)]:
+        sym = visible_set(g, p, 8, mcrfpy.FOV.NATIVE_SYMMETRIC)
+        fast = visible_set(g, p, 8, mcrfpy.FOV.NATIVE_FAST)
+        assert sym <= fast, f"NATIVE_FAST missed cells at {p}"
+    print("PASS: NATIVE_FAST lights at least what NATIVE_SYMMETRIC does")
+
+
+def test_entity_perspective():
+    g = make_grid()
+    g.fov = mcrfpy.FOV.NATIVE_SYMMETRIC
+    g.fov_radius = 6
+    e = mcrfpy.Entity((12, 9), grid=g)
+    e.update_visibility()
+    expected = visible_set(g, (12, 9), 6, mcrfpy.FOV.NATIVE_SYMMETRIC)
+    got = {(x, y) for y in range(H) for x in range(W)
+           if e.perspective_map.get((x, y)) == mcrfpy.Perspective.VISIBLE}
+    assert got == expected
+    print("PASS: entity perspective uses the grid's native algorithm")
+
+
+if __name__ == "__main__":
+    test_enum_members()
+    test_open_room()
+    test_walls_block()
+    test_symmetry()
+    test_fast_is_superset()
+    test_entity_perspective()
+    print("All native FOV tests passed")
+    sys.exit(0)
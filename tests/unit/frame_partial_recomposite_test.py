@@ -0,0 +1,164 @@
+"""Frame(cache_subtree=True) partial recomposition: when only some children
+change, the cached raster is repainted just where those children were and now
+are, instead of redrawing every child.
+
+A cached frame edited between renders must screenshot identically to one built
+with the final state and rendered once -- including moved children (their old
+area must be cleared through a translucent fill), text changes, and children
+overlapping the changed area. get_metrics() counts which path each cached frame
+took, so the damaged-child cases also check that the partial path ran.
+"""
+import mcrfpy
+from mcrfpy import automation
+import sys
+import os
+import tempfile
+
+TMP = tempfile.gettempdir()
+
+
+def build(name):
+    scene = mcrfpy.Scene(name)
+    hud = mcrfpy.Frame(pos=(10, 10), size=(400, 300), cache_subtree=True,
+                       fill_color=mcrfpy.Color(30, 30, 60, 180))
+    scene.children.append(hud)
+    labels = []
+    for i in range(80):
+        c = mcrfpy.Caption(text=f"{i:03d}", pos=(8 + (i % 10) * 38, 8 + (i // 10) * 30))
+        hud.children.append(c)
+        labels.append(c)
+    icon = mcrfpy.Sprite(pos=(20, 250), texture=mcrfpy.default_texture, sprite_index=84)
+    panel = mcrfpy.Frame(pos=(200, 240), size=(60, 40), outline=3,
+                         fill_color=mcrfpy.Color(200, 60, 60, 128),
+                         outline_color=mcrfpy.Color(255, 255, 255))
+    hud.children.append(icon)
+    hud.children.append(panel)
+    mcrfpy.current_scene = scene
+    return scene, (labels, icon, panel)
+
+
+def tick(labels, icon, panel, n):
+    labels[7].text = f"{n * 111}"              # the ticking number
+    icon.x += 40                               # moves: old spot must clear
+    panel.fill_color = mcrfpy.Color(60, 200, 60, 128)
+    panel.y -= 25 * n                          # slides under the captions
+
+
+def shot(name):
+    path = os.path.join(TMP, name)
+    automation.screenshot(path)
+    with open(path, "rb") as f:
+        return f.read()
+
+
+def paths():
+    m = mcrfpy.get_metrics()
+    return m["frame_partial_recomposites"], m["frame_full_rebuilds"]
+
+
+def test_partial_matches_full():
+    scene, parts = build("partial_incremental")
+    before = shot("partial_0.png")
+    for n in (1, 2):
+        mcrfpy.current_scene = scene
+        tick(*parts, n)
+        incremental = shot(f"partial_{n}.png")
+        assert paths() == (1, 0), f"tick {n}: expected a partial recomposite, got {paths()}"
+        assert incremental != before, f"tick {n} not visible through the cache"
+        before = incremental
+
+        _, fresh_parts = build(f"partial_fresh_{n}")
+        for k in range(1, n + 1):
+            tick(*fresh_parts, k)
+        fresh = shot(f"partial_fresh_{n}.png")
+        assert incremental == fresh, f"tick {n}: partial recomposite differs from a full rebuild"
+    print("PASS: partial recomposition matches a full rebuild")
+
+
+def build_spill(name):
+    scene = mcrfpy.Scene(name)
+    hud = mcrfpy.Frame(pos=(10, 10), size=(400, 300), cache_subtree=True,
+                       fill_color=mcrfpy.Color(30, 30, 60, 180))
+    scene.children.append(hud)
+    # Neither clips nor caches: its child draws well outside its 40x40 box
+    group = mcrfpy.Frame(pos=(40, 40), size=(40, 40),
+                         fill_color=mcrfpy.Color(80, 80, 160, 255))
+    group.children.append(mcrfpy.Frame(pos=(60, 60), size=(50, 50),
+                                       fill_color=mcrfpy.Color(220, 180, 40, 255)))
+    hud.children.append(group)
+    # Sibling whose repaint rect covers the spilled pixels
+    sibling = mcrfpy.Caption(text="over", pos=(110, 110))
+    hud.children.append(sibling)
+    mcrfpy.current_scene = scene
+    return group, sibling
+
+
+def test_unclipped_child():
+    group, sibling = build_spill("partial_spill")
+    shot("partial_spill_0.png")
+    sibling.text = "over the spill"
+    group.x += 90
+    incremental = shot("partial_spill_1.png")
+    assert paths() == (0, 1), paths()
+
+    group, sibling = build_spill("partial_spill_fresh")
+    sibling.text = "over the spill"
+    group.x += 90
+    fresh = shot("partial_spill_fresh.png")
+    assert incremental == fresh, "a non-clipping child's spilled pixels were not repainted"
+    print("PASS: children drawing outside their box force a full rebuild")
+
+
+def build_lines(name):
+    scene = mcrfpy.Scene(name)
+    hud = mcrfpy.Frame(pos=(10, 10), size=(400, 300), cache_subtree=True,
+                       fill_color=mcrfpy.Color(30, 30, 60, 180))
+    scene.children.append(hud)
+    # Horizontal: its endpoint box is zero pixels tall, the stroke is 12
+    rule = mcrfpy.Line(start=(20, 100), end=(300, 100), thickness=12,
+                       color=mcrfpy.Color(240, 240, 240))
+    # Caption just below the rule: its repaint rect overlaps only the stroke
+    label = mcrfpy.Caption(text="status", pos=(150, 103))
+    slash = mcrfpy.Line(start=(40, 180), end=(200, 260), thickness=10,
+                        color=mcrfpy.Color(220, 80, 80))
+    for d in (rule, label, slash):
+        hud.children.append(d)
+    mcrfpy.current_scene = scene
+    return label, slash
+
+
+def edit_lines(label, slash):
+    label.text = "status: changed"
+    slash.start = (40, 165)
+    slash.end = (200, 245)
+
+
+def test_thick_lines():
+    label, slash = build_lines("partial_lines")
+    shot("partial_lines_0.png")
+    edit_lines(label, slash)
+    incremental = shot("partial_lines_1.png")
+    assert paths() == (1, 0), paths()
+
+    label, slash = build_lines("partial_lines_fresh")
+    edit_lines(label, slash)
+    fresh = shot("partial_lines_fresh.png")
+    assert incremental == fresh, "thick line strokes outside the endpoint box were not repainted"
+    print("PASS: thick lines are repainted over their whole stroke")
+
+
+def test_clean_frame_is_stable():
+    build("partial_clean")
+    a = shot("partial_clean_a.png")
+    b = shot("partial_clean_b.png")
+    assert a == b
+    print("PASS: a clean cached frame re-blits unchanged")
+
+
+if __name__ == "__main__":
+    test_partial_matches_full()
+    test_unclipped_child()
+    test_thick_lines()
+    test_clean_frame_is_stable()
+    print("All frame partial recomposite tests passed")
+    sys.exit(0)
@@ -0,0 +1,102 @@
+"""grid.step(batch_callbacks=handler): a round's DONE/BLOCKED/TARGET triggers
+are delivered to one handler as an (n, 3) int32 buffer of
+(entity, trigger, partner) rows instead of one step callback per entity.
+"""
+import mcrfpy
+import sys
+
+
+def make_grid(name, size=12):
+    scene = mcrfpy.Scene(name)
+    mcrfpy.current_scene = scene
+    grid = mcrfpy.Grid(grid_size=(size, size))
+    scene.children.append(grid)
+    for y in range(size):
+        for x in range(size):
+            open_cell = 0 < x < size - 1 and 0 < y < size - 1
+            grid.at(x, y).walkable = open_cell
+            grid.at(x, y).transparent = open_cell
+    return grid
+
+
+def test_rows_and_partners():
+    grid = make_grid("step_batch_rows")
+    # 0: sleeps one turn -> DONE
+    sleeper = mcrfpy.Entity((1, 1), grid=grid)
+    sleeper.set_behavior(int(mcrfpy.Behavior.SLEEP), turns=1)
+    # 1: blocker sitting on 2's path; 2: walks into it -> BLOCKED
+    blocker = mcrfpy.Entity((5, 3), grid=grid)
+    walker = mcrfpy.Entity((5, 2), grid=grid)
+    walker.set_behavior(int(mcrfpy.Behavior.PATH), path=[(5, 3)])
+    grid.at(5, 3).walkable = False
+    # 3: hunter spotting 4 -> TARGET
+    hunter = mcrfpy.Entity((8, 8), grid=grid)
+    hunter.set_behavior(int(mcrfpy.Behavior.SLEEP), turns=5)
+    hunter.target_label = "prey"
+    hunter.sight_radius = 5
+    prey = mcrfpy.Entity((9, 9), grid=grid)
+    prey.labels = {"prey"}
+
+    per_entity = []
+    for e in (sleeper, walker, hunter):
+        e.step = lambda t, d: per_entity.append(t)
+    rounds = []
+
+    def handler(events):
+        view = memoryview(events)
+        assert view.readonly and view.format == "i" and view.shape == (len(events), 3)
+        rounds.append((events.round, [tuple(r) for r in view.tolist()]))
+
+    grid.step(batch_callbacks=handler)
+    assert per_entity == [], "batched rounds skip per-entity callbacks"
+    assert len(rounds) == 1, rounds
+    rnd, rows = rounds[0]
+    assert rnd == 0
+    rows = sorted(rows)
+    assert (0, int(mcrfpy.Trigger.DONE), -1) in rows, rows
+    assert (2, int(mcrfpy.Trigger.BLOCKED), 1) in rows, rows
+    assert (3, int(mcrfpy.Trigger.TARGET), 4) in rows, rows
+    print("PASS: rows carry entity index, trigger and partner index")
+
+
+def test_rounds_and_empty():
+    grid = make_grid("step_batch_rounds")
+    for i in range(4):
+        e = mcrfpy.Entity((1 + i, 1), grid=grid)
+        e.set_behavior(int(mcrfpy.Behavior.SLEEP), turns=1 + i)
+    seen = []
+    grid.step(n=6, batch_callbacks=lambda ev: seen.append((ev.round, len(ev))))
+    assert seen == [(0, 1), (1, 1), (2, 1), (3, 1)], seen
+    print("PASS: one handler call per round with events; empty rounds are skipped")
+
+
+def test_kept_buffer_and_errors():
+    grid = make_grid("step_batch_keep")
+    e = mcrfpy.Entity((2, 2), grid=grid)
+    e.set_behavior(int(mcrfpy.Behavior.SLEEP), turns=1)
+    kept = []
+    grid.step(batch_callbacks=kept.append)
+    view = memoryview(kept[0])
+    assert view.tolist() == [[0, 0, -1]], view.tolist()
+    try:
+        view[0, 0] = 5
+    except TypeError:
+        pass
+    else:
+        raise AssertionError("the events buffer must be read-only")
+    try:
+        grid.step(batch_callbacks=True)
+    except TypeError:
+        pass
+    else:
+        raise AssertionError("batch_callbacks must be callable")
+    grid.step(batch_callbacks=None)  # ordinary step
+    print("PASS: kept buffers stay valid, are read-only, and handlers must be callable")
+
+
+if __name__ == "__main__":
+    test_rows_and_partners()
+    test_rounds_and_empty()
+    test_kept_buffer_and_errors()
+    print("All grid step batch tests passed")
+    sys.exit(0)
@@ -0,0 +1,190 @@
+"""Unit test: grid.step(parallel=True) matches serial grid.step().
+
+The parallel mode plans every entity's behavior on worker threads and then
+commits in turn order. Moves and step() callbacks must be identical to a
+serial step for every deterministic behavior, including when callbacks
+mutate the grid or other entities mid-round.
+"""
+import mcrfpy
+import sys
+
+W, H = 40, 30
+
+
+def build(name, log):
+    """Build an identical world; log receives (entity_id, trigger, data) tuples."""
+    scene = mcrfpy.Scene(name)
+    mcrfpy.current_scene = scene
+    grid = mcrfpy.Grid(grid_size=(W, H))
+    scene.children.append(grid)
+    for y in range(H):
+        for x in range(W):
+            c = grid.at(x, y)
+            edge = x in (0, W - 1) or y in (0, H - 1)
+            pillar = (x % 7 == 3 and y % 5 == 2)
+            c.walkable = not (edge or pillar)
+            c.transparent = not (edge or pillar)
+
+    attractor = grid.get_dijkstra_map((W // 2, H // 2))
+    safety = attractor.invert()
+
+    entities = []
+
+    def add(pos, **kw):
+        e = mcrfpy.Entity(pos, grid=grid)
+        e.move_speed = 0
+        idx = len(entities)
+        e.step = lambda t, d, idx=idx: log.append(
+            (idx, int(t), None if d is None else tuple(int(v) for v in d.cell_pos)))
+        entities.append(e)
+        return e
+
+    # Deterministic behaviors only (NOISE draws from an RNG)
+    for i in range(150):
+        x = 1 + (i * 7) % (W - 2)
+        y = 1 + (i * 11) % (H - 2)
+        if not grid.at(x, y).walkable:
+            x += 1
+        mix = i % 7
+        if mix == 0:
+            add((x, y)).set_behavior(int(mcrfpy.Behavior.SEEK), pathfinder=attractor)
+        elif mix == 1:
+            add((x, y)).set_behavior(int(mcrfpy.Behavior.FLEE), pathfinder=safety)
+        elif mix == 2:
+            add((x, y)).set_behavior(int(mcrfpy.Behavior.PATROL),
+                                     waypoints=[(x, y), (W - 2 - x % 5, y)])
+        elif mix == 3:
+            add((x, y)).set_behavior(int(mcrfpy.Behavior.LOOP),
+                                     waypoints=[(x, y), (x, H - 2 - y % 3), (W // 2, H // 2)])
+        elif mix == 4:
+            add((x, y)).set_behavior(int(mcrfpy.Behavior.WAYPOINT),
+                                     waypoints=[(W - 2, H - 2), (1, 1)])
+        elif mix == 5:
+            e = add((x, y))
+            e.set_behavior(int(mcrfpy.Behavior.SLEEP), turns=3 + i % 4)
+            e.target_label = "prey"
+            e.sight_radius = 6
+        else:
+            e = add((x, y))
+            e.set_behavior(int(mcrfpy.Behavior.PATH),
+                           path=[(x + 1, y), (x + 2, y), (x + 2, y + 1)])
+            e.labels = {"prey"}
+        e = entities[-1]
+        e.turn_order = 1 + i % 3
+    return grid, entities
+
+
+def positions(entities):
+    return [tuple(int(v) for v in e.cell_pos) for e in entities]
+
+
+def run(parallel, rounds, mutate=None):
+    log = []
+    grid, entities = build("par" if parallel else "ser", log)
+    if mutate:
+        mutate(grid, entities, log)
+    for _ in range(rounds):
+        grid.step(parallel=parallel)
+    return positions(entities), log
+
+
+def test_matches_serial():
+    """Same positions and callback sequence as a serial step."""
+    ser = run(False, 25)
+    par = run(True, 25)
+    assert ser[0] == par[0], "parallel step moved entities differently"
+    assert ser[1] == par[1], "parallel step fired different callbacks"
+    assert len(ser[1]) > 0, "scenario should fire callbacks"
+    print("PASS: parallel step matches serial step")
+
+
+def test_callback_mutation_matches_serial():
+    """Callbacks that wall off cells and retarget entities invalidate plans."""
+    def mutate(grid, entities, log):
+        for idx, e in enumerate(entities):
+            if idx % 5 != 0:
+                continue
+            def cb(t, d, idx=idx, e=e):
+                log.append((idx, int(t)))
+                x, y = (int(v) for v in e.cell_pos)
+                # Wall off the cell to the right and send the entity home
+                if x + 1 < W - 1:
+                    grid.at(x + 1, y).walkable = False
+                e.set_behavior(int(mcrfpy.Behavior.WAYPOINT), waypoints=[(1, 1)])
+            e.step = cb
+    ser = run(False, 20, mutate)
+    par = run(True, 20, mutate)
+    assert ser[0] == par[0], "parallel step diverged after callback mutation"
+    assert ser[1] == par[1], "parallel callbacks diverged after callback mutation"
+    print("PASS: parallel step re-plans after callback mutation")
+
+
+def run_collide(parallel, rounds):
+    """Seekers queued in a corridor share one map they also block: each move
+    reshapes the field for the movers after it."""
+    scene = mcrfpy.Scene("col_par" if parallel else "col_ser")
+    mcrfpy.current_scene = scene
+    grid = mcrfpy.Grid(grid_size=(W, H))
+    scene.children.append(grid)
+    for y in range(H):
+        for x in range(W):
+            c = grid.at(x, y)
+            corridor = y == 5 and 0 < x < W - 1
+            room = 0 < x < 12 and 0 < y < H - 1
+            c.walkable = corridor or room
+            c.transparent = c.walkable
+    goal = grid.get_dijkstra_map((W - 2, 5), collide="crowd")
+    movers = []
+    for i in range(12):
+        e = mcrfpy.Entity((2 + i % 6, 3 + 2 * (i // 6)), grid=grid)
+        e.move_speed = 0
+        e.labels = {"crowd"}
+        e.set_behavior(int(mcrfpy.Behavior.SEEK), pathfinder=goal)
+        movers.append(e)
+    trace = []
+    for _ in range(rounds):
+        grid.step(parallel=parallel)
+        trace.append(positions(movers))
+    return trace
+
+
+def test_collide_map_matches_serial():
+    """Plans against a collide-label map go stale once another entity moves."""
+    ser = run_collide(False, 30)
+    par = run_collide(True, 30)
+    assert ser[0] != ser[-1], "seekers should make progress"
+    assert ser == par, "parallel step diverged on a shared collide map"
+    print("PASS: parallel step matches serial on a shared collide map")
+
+
+def test_turn_order_filter():
+    """turn_order filter applies the same way in parallel mode."""
+    log_a, log_b = [], []
+    grid_a, ents_a = build("filt_a", log_a)
+    grid_b, ents_b = build("filt_b", log_b)
+    for _ in range(5):
+        grid_a.step(turn_order=2)
+        grid_b.step(turn_order=2, parallel=True)
+    assert positions(ents_a) == positions(ents_b)
+    assert log_a == log_b
+    print("PASS: parallel step honors turn_order filter")
+
+
+def test_parallel_keyword():
+    """parallel accepts truthy values and defaults to False."""
+    grid = mcrfpy.Grid(grid_size=(5, 5))
+    grid.step()
+    grid.step(parallel=False)
+    grid.step(parallel=1)
+    grid.step(n=2, parallel=True)
+    print("PASS: parallel keyword accepted")
+
+
+if __name__ == "__main__":
+    test_matches_serial()
+    test_callback_mutation_matches_serial()
+    test_collide_map_matches_serial()
+    test_turn_order_filter()
+    test_parallel_keyword()
+    print("All grid.step(parallel=True) tests passed")
+    sys.exit(0)
@@ -0,0 +1,101 @@
+"""GridView damage tracking: after entity moves and per-cell layer edits, a view
+redraws only the damaged rectangles over its cached raster.
+
+The result must screenshot identically to a view that rendered the final
+state from scratch, and the damage-only frame must draw far fewer cells.
+"""
+import mcrfpy
+from mcrfpy import automation
+import sys
+import os
+import tempfile
+
+W, H = 40, 30
+TMP = tempfile.gettempdir()
+
+
+def build(name):
+    scene = mcrfpy.Scene(name)
+    tiles = mcrfpy.TileLayer(name="tiles", z_index=-1, texture=mcrfpy.default_texture)
+    tint = mcrfpy.ColorLayer(name="tint", z_index=1)
+    g = mcrfpy.Grid(grid_size=(W, H), pos=(0, 0), size=(480, 320), layers=[tiles, tint])
+    scene.children.append(g)
+    tiles.fill(5)
+    tint.fill(mcrfpy.Color(0, 0, 0, 0))
+    ents = [mcrfpy.Entity((3 + 3 * i, 4 + i % 5), grid=g, sprite_index=84 + i) for i in range(8)]
+    mcrfpy.current_scene = scene
+    return g, tiles, tint, ents
+
+
+def edit(tiles, tint, ents):
+    # One "turn": a few entities step, a few cells change
+    for i, e in enumerate(ents[:4]):
+        e.draw_pos = (e.draw_pos.x + 1, e.draw_pos.y + (i % 2))
+    tiles.set((10, 10), 20)
+    tint.set((12, 3), mcrfpy.Color(200, 40, 40, 128))
+
+
+def shot(name):
+    path = os.path.join(TMP, name)
+    automation.screenshot(path)
+    with open(path, "rb") as f:
+        return f.read(), mcrfpy.get_metrics()
+
+
+def test_damage_matches_full_redraw():
+    g, tiles, tint, ents = build("damage_incremental")
+    _, full = shot("damage_a0.png")
+    edit(tiles, tint, ents)
+    incremental, partial = shot("damage_a1.png")
+
+    g2, tiles2, tint2, ents2 = build("damage_fresh")
+    edit(tiles2, tint2, ents2)
+    fresh, _ = shot("damage_b.png")
+
+    assert incremental == fresh, "damage-only redraw differs from a full redraw"
+    assert 0 < partial["grid_cells_rendered"] < full["grid_cells_rendered"] // 2, \
+        (partial["grid_cells_rendered"], full["grid_cells_rendered"])
+    print("PASS: damage-only redraw matches a full redraw and draws fewer cells")
+
+
+def test_unlogged_change_redraws_fully():
+    g, tiles, tint, ents = build("damage_full")
+    _, full = shot("damage_c0.png")
+    tiles.fill(7)  # whole-layer edit: no precise area
+    _, after = shot("damage_c1.png")
+    assert after["grid_cells_rendered"] == full["grid_cells_rendered"]
+    print("PASS: changes without a logged area fall back to a full redraw")
+
+
+def build_composite(name):
+    g, tiles, tint, ents = build(name)
+    big = mcrfpy.Entity((20, 20), grid=g, sprite_index=84)
+    big.tile_width, big.tile_height = 4, 4
+    big.sprite_grid = [[84 + (x + y) % 4 for x in range(4)] for y in range(4)]
+    return g, tiles
+
+
+def test_composite_entity_reach():
+    # The edited cell lies under the 4x4 composite but more than two tiles
+    # from its anchor cell
+    g, tiles = build_composite("damage_composite")
+    shot("damage_d0.png")
+    tiles.set((23, 23), 20)
+    incremental, partial = shot("damage_d1.png")
+
+    g2, tiles2 = build_composite("damage_composite_fresh")
+    tiles2.set((23, 23), 20)
+    fresh, full = shot("damage_e.png")
+
+    assert incremental == fresh, "damage rect lost the composite entity drawn over it"
+    assert partial["grid_cells_rendered"] < full["grid_cells_rendered"], \
+        (partial["grid_cells_rendered"], full["grid_cells_rendered"])
+    print("PASS: damage redraw includes entities reaching in from outside the rect")
+
+
+if __name__ == "__main__":
+    test_damage_matches_full_redraw()
+    test_unlogged_change_redraws_fully()
+    test_composite_entity_reach()
+    print("All GridView damage render tests passed")
+    sys.exit(0)
@@ -0,0 +1,98 @@
+"""GridView entity culling: render() pulls on-screen entities from the spatial
+hash's draw-position buckets instead of walking grid.entities.
+
+entities_rendered must match a brute-force count of the viewport window after
+entities move (draw_pos animation-style writes, grid_pos moves, grid.step),
+join, leave, and are reordered in the list.
+"""
+import mcrfpy
+from mcrfpy import automation
+import sys
+import os
+import tempfile
+import random
+
+W, H = 400, 300
+VIEW = (320, 320)  # 20x20 cells at the default 16px cell size
+SHOT = os.path.join(tempfile.gettempdir(), "gridview_culling.png")
+
+
+def expected(g, center):
+    # Same window UIGridView::render uses: viewport plus a 2-cell margin.
+    cx, cy = center
+    left = cx - VIEW[0] / 16 / 2
+    top = cy - VIEW[1] / 16 / 2
+    n = 0
+    for e in g.entities:
+        x, y = e.draw_pos.x, e.draw_pos.y
+        if left - 2 <= x < left + VIEW[0] / 16 + 2 and top - 2 <= y < top + VIEW[1] / 16 + 2:
+            n += 1
+    return n
+
+
+def rendered(g, center):
+    g.center_camera(center)
+    automation.screenshot(SHOT)
+    return mcrfpy.get_metrics()["entities_rendered"]
+
+
+def check(g, center, what):
+    got, want = rendered(g, center), expected(g, center)
+    assert got == want, f"{what}: rendered {got}, expected {want}"
+
+
+def test_culling_tracks_moves():
+    rng = random.Random(7)
+    scene = mcrfpy.Scene("culling")
+    g = mcrfpy.Grid(grid_size=(W, H), pos=(0, 0), size=VIEW)
+    scene.children.append(g)
+    mcrfpy.current_scene = scene
+    ents = [mcrfpy.Entity((rng.randrange(W), rng.randrange(H)), grid=g) for _ in range(4000)]
+
+    for center in [(50, 50), (200.5, 150.5), (0, 0), (W, H)]:
+        check(g, center, f"static at {center}")
+
+    # Smooth draw_pos writes (what animations do) cross bucket edges
+    for e in ents[:500]:
+        e.draw_pos = (e.draw_pos.x + rng.uniform(-9, 9), e.draw_pos.y + rng.uniform(-9, 9))
+    check(g, (60, 60), "after draw_pos moves")
+
+    # Off-grid draw positions clamp into edge buckets and are still found
+    ents[0].draw_pos = (-1.5, -1.5)
+    check(g, (0, 0), "off-grid entity")
+
+    # List membership and order changes
+    for e in ents[1000:1500]:
+        g.entities.remove(e)
+    g.entities.insert(0, mcrfpy.Entity((60, 60)))
+    check(g, (60, 60), "after remove/insert")
+    print("PASS: culled entity count matches the viewport after moves and list edits")
+
+
+def test_draw_order_is_list_order():
+    # Two entities on the same tile: the later one in the list draws on top.
+    scene = mcrfpy.Scene("culling_order")
+    g = mcrfpy.Grid(grid_size=(40, 40), pos=(0, 0), size=VIEW)
+    scene.children.append(g)
+    mcrfpy.current_scene = scene
+    under = mcrfpy.Entity((10, 10), grid=g, sprite_index=1)
+    over = mcrfpy.Entity((10, 10), grid=g, sprite_index=2)
+    g.center_camera((10, 10))
+    automation.screenshot(SHOT)
+    with open(SHOT, "rb") as f:
+        first = f.read()
+    # Swap list order: the raster must change, so order follows the list.
+    g.entities.remove(under)
+    g.entities.append(under)
+    automation.screenshot(SHOT)
+    with open(SHOT, "rb") as f:
+        second = f.read()
+    assert first != second, "reordering the entity list must change which sprite is on top"
+    print("PASS: culled entities keep list draw order")
+
+
+if __name__ == "__main__":
+    test_culling_tracks_moves()
+    test_draw_order_is_list_order()
+    print("All GridView culling tests passed")
+    sys.exit(0)
@@ -0,0 +1,155 @@
+"""Hierarchical pathfinding: find_path(heuristic=Heuristic.HIERARCHICAL), grid.hpa_stats,
+and set_behavior(SEEK, pathfinder=(x, y), hierarchical=True).
+
+HPA* paths must be valid step sequences, close to A* length, rebuild only nearby
+clusters after a walkability edit, and agree with A* on reachability.
+"""
+import mcrfpy
+import random
+import sys
+
+HIER = mcrfpy.Heuristic.HIERARCHICAL
+W, H = 200, 150
+
+
+def make_grid(seed=11):
+    """Rooms separated by walls with a few doorways, plus scattered pillars."""
+    g = mcrfpy.Grid(grid_size=(W, H))
+    rng = random.Random(seed)
+    for y in range(H):
+        for x in range(W):
+            r = rng.randrange(100)
+            wall = (x % 45 == 22 or y % 35 == 17) and r >= 8
+            c = g.at(x, y)
+            c.walkable = not wall and r >= 5
+            c.transparent = c.walkable
+    return g
+
+
+def pairs(g, n, seed=3):
+    out = []
+    rng = random.Random(seed)
+    while len(out) < n:
+        a = (rng.randrange(W), rng.randrange(H))
+        b = (rng.randrange(W), rng.randrange(H))
+        if g.at(*a).walkable and g.at(*b).walkable:
+            out.append((a, b))
+    return out
+
+
+def check_valid(g, start, end, steps):
+    cur = start
+    for s in steps:
+        s = (int(s.x), int(s.y))
+        assert max(abs(s[0] - cur[0]), abs(s[1] - cur[1])) == 1, f"jump {cur} -> {s}"
+        assert g.at(*s).walkable, f"step into wall at {s}"
+        cur = s
+    assert cur == end, f"path ends at {cur}, expected {end}"
+
+
+def cost(start, steps):
+    total, cur = 0.0, start
+    for s in steps:
+        s = (int(s.x), int(s.y))
+        total += 1.41 if s[0] != cur[0] and s[1] != cur[1] else 1.0
+        cur = s
+    return total
+
+
+def test_paths_valid_and_short():
+    g = make_grid()
+    worst = 1.0
+    for a, b in pairs(g, 40):
+        pa = g.find_path(a, b, heuristic=mcrfpy.Heuristic.DIAGONAL)
+        ph = g.find_path(a, b, heuristic=HIER)
+        assert (pa is None) == (ph is None), f"reachability differs for {a} -> {b}"
+        if pa is None:
+            continue
+        steps = list(ph)
+        check_valid(g, a, b, steps)
+        if len(pa):
+            worst = max(worst, cost(a, steps) / cost(a, list(pa)))
+    assert worst < 1.25, f"hierarchical path {worst:.2f}x the optimal cost"
+    stats = g.hpa_stats
+    assert stats["built"] and stats["full_builds"] == 1
+    assert stats["queries"] >= 40
+    print(f"PASS: hierarchical paths valid, worst cost ratio {worst:.3f}")
+
+
+def test_incremental_rebuild():
+    g = make_grid()
+    a, b = (2, 2), (W - 3, H - 3)
+    g.at(*a).walkable = True
+    g.at(*b).walkable = True
+    assert g.find_path(a, b, heuristic=HIER) is not None
+    stats = g.hpa_stats
+    before = stats["cluster_rebuilds"]
+    assert before == stats["clusters"], "first query builds every cluster"
+    g.at(100, 70).walkable = not g.at(100, 70).walkable
+    g.find_path(a, b, heuristic=HIER)
+    stats = g.hpa_stats
+    assert stats["full_builds"] == 1, "one edit must not rebuild the whole graph"
+    assert 0 < stats["cluster_rebuilds"] - before <= 5, stats
+    print("PASS: a walkability edit rebuilds only nearby clusters")
+
+
+def test_unreachable():
+    g = mcrfpy.Grid(grid_size=(120, 40))
+    for y in range(40):
+        for x in range(120):
+            c = g.at(x, y)
+            c.walkable = x != 60
+    assert g.find_path((5, 5), (110, 30), heuristic=HIER) is None
+    assert g.find_path((5, 5), (60, 30), heuristic=HIER) is None, "goal in a wall"
+    g.at(60, 20).walkable = True
+    path = g.find_path((5, 5), (110, 30), heuristic=HIER)
+    assert path is not None, "opening a door must be seen by the next query"
+    check_valid(g, (5, 5), (110, 30), list(path))
+    print("PASS: unreachable goals return None, edits are picked up")
+
+
+def test_collide_respected():
+    g = mcrfpy.Grid(grid_size=(120, 20))
+    for y in range(20):
+        for x in range(120):
+            g.at(x, y).walkable = True
+    blockers = []
+    for y in range(20):
+        if y != 10:
+            e = mcrfpy.Entity((70, y), grid=g)
+            e.add_label("wall")
+            blockers.append(e)
+    path = g.find_path((0, 0), (119, 0), heuristic=HIER, collide="wall")
+    assert path is not None
+    steps = [(int(s.x), int(s.y)) for s in path]
+    crossing = [s for s in steps if s[0] == 70]
+    assert crossing == [(70, 10)], f"path must use the one free cell, got {crossing}"
+    print("PASS: collide labels are honoured")
+
+
+def test_seek_hierarchical():
+    g = make_grid()
+    scene = mcrfpy.Scene("hpa_seek")
+    scene.children.append(g)
+    start, goal = pairs(g, 1, seed=9)[0]
+    assert g.find_path(start, goal) is not None
+    e = mcrfpy.Entity(start, grid=g)
+    e.move_speed = 0
+    e.set_behavior(int(mcrfpy.Behavior.SEEK), pathfinder=goal, hierarchical=True)
+    for _ in range(2000):
+        g.step()
+        assert g.at(e.cell_x, e.cell_y).walkable, f"entity walked into a wall at {e.cell_x},{e.cell_y}"
+        if (e.cell_x, e.cell_y) == goal:
+            break
+    assert (e.cell_x, e.cell_y) == goal, f"SEEK stuck at {(e.cell_x, e.cell_y)}"
+    print("PASS: hierarchical SEEK reaches a distant target")
+
+
+if __name__ == "__main__":
+    test_paths_valid_and_short()
+    test_incremental_rebuild()
+    test_unreachable()
+    test_collide_respected()
+    test_seek_hierarchical()
+    print("All hierarchical pathfinding tests passed")
+    sys.exit(0)
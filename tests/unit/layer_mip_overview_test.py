@@ -0,0 +1,84 @@
+"""Zoomed-out layer caches: below zoom 0.5 chunks blit from downsampled mip
+levels, and once a cell is a pixel or smaller the layer draws a one-pixel-per-
+cell overview built from its data.
+
+Edits must show up at every zoom, and undoing an edit must restore the exact
+frame (stale mips or overview pixels would leave a trace).
+"""
+import mcrfpy
+from mcrfpy import automation
+import sys
+import os
+import tempfile
+
+W, H = 1024, 1024
+SHOT = os.path.join(tempfile.gettempdir(), "layer_mip_overview.png")
+
+
+def frame():
+    automation.screenshot(SHOT)
+    with open(SHOT, "rb") as f:
+        return f.read()
+
+
+def build(name):
+    scene = mcrfpy.Scene(name)
+    tiles = mcrfpy.TileLayer(name="tiles", z_index=-1, texture=mcrfpy.default_texture)
+    fog = mcrfpy.ColorLayer(name="fog", z_index=1)
+    g = mcrfpy.Grid(grid_size=(W, H), pos=(0, 0), size=(400, 300), layers=[tiles, fog])
+    scene.children.append(g)
+    mcrfpy.current_scene = scene
+    for i in range(16):
+        tiles.fill_rect((i * 64, 0), (64, H), i + 1)
+    fog.fill(mcrfpy.Color(0, 0, 0, 0))
+    g.center_camera((W / 2, H / 2))
+    return g, tiles, fog
+
+
+def check_zoom(zoom):
+    g, tiles, fog = build(f"mip_{zoom}")
+    g.zoom = zoom
+    base = frame()
+
+    tiles.fill_rect((500, 500), (24, 24), 40)
+    edited = frame()
+    assert edited != base, f"zoom {zoom}: tile edit not visible"
+    tiles.fill_rect((500, 500), (24, 24), 8)  # the column's original tile
+    assert frame() == base, f"zoom {zoom}: undoing a tile edit left stale pixels"
+
+    fog.fill_rect((520, 480), (16, 16), mcrfpy.Color(255, 0, 0, 255))
+    assert frame() != base, f"zoom {zoom}: color edit not visible"
+    fog.fill_rect((520, 480), (16, 16), mcrfpy.Color(0, 0, 0, 0))
+    assert frame() == base, f"zoom {zoom}: undoing a color edit left stale pixels"
+
+
+def test_mip_levels():
+    for zoom in (0.5, 0.3, 0.2, 0.1):
+        check_zoom(zoom)
+    print("PASS: mip-level blits follow layer edits")
+
+
+def test_overview():
+    for zoom in (0.0625, 0.05, 0.02):
+        check_zoom(zoom)
+    print("PASS: one-pixel-per-cell overview follows layer edits")
+
+
+def test_zoom_round_trip():
+    # Switching caches must not disturb the full-size path
+    g, tiles, fog = build("mip_round_trip")
+    g.zoom = 1.0
+    full = frame()
+    for zoom in (0.3, 0.05, 1.0):
+        g.zoom = zoom
+        frame()
+    assert frame() == full, "full-size frame changed after zooming out and back"
+    print("PASS: zooming out and back restores the full-size frame")
+
+
+if __name__ == "__main__":
+    test_mip_levels()
+    test_overview()
+    test_zoom_round_trip()
+    print("All layer mip/overview tests passed")
+    sys.exit(0)
@@ -0,0 +1,114 @@
+"""Native pathfinding: per-cell weights and walkable-plane reads.
+
+find_path() and get_dijkstra_map() search GridData's walkable plane directly
+and accept an optional `weights` DiscreteMap (entry-cost multiplier, 0 blocks).
+"""
+import mcrfpy
+import sys
+
+
+def make_grid(w, h):
+    g = mcrfpy.Grid(grid_size=(w, h))
+    for y in range(h):
+        for x in range(w):
+            c = g.at(x, y)
+            c.walkable = True
+            c.transparent = True
+    return g
+
+
+def coords(path):
+    return [(int(s.x), int(s.y)) for s in path]
+
+
+def test_weights_steer_find_path():
+    """An expensive band is walked around when a cheap detour exists."""
+    g = make_grid(11, 7)
+    weights = mcrfpy.DiscreteMap((11, 7), fill=1)
+    for y in range(0, 6):
+        weights.set(5, y, 50)  # costly column, open only at y=6
+
+    plain = coords(g.find_path((0, 0), (10, 0)))
+    assert (5, 0) in plain, "unweighted path should go straight through"
+
+    weighted = coords(g.find_path((0, 0), (10, 0), weights=weights))
+    assert weighted[-1] == (10, 0)
+    assert all(x != 5 or y == 6 for (x, y) in weighted), \
+        f"weighted path crossed the costly column: {weighted}"
+    print("PASS: weights steer find_path")
+
+
+def test_zero_weight_blocks():
+    """Weight 0 makes a cell impassable for both searches."""
+    g = make_grid(5, 1)
+    weights = mcrfpy.DiscreteMap((5, 1), fill=1)
+    weights.set(2, 0, 0)
+    assert g.find_path((0, 0), (4, 0), weights=weights) is None
+    dmap = g.get_dijkstra_map((0, 0), weights=weights)
+    assert dmap.distance((4, 0)) is None, "cell behind a 0-weight wall is unreachable"
+    assert abs(dmap.distance((1, 0)) - 1.0) < 0.01
+    print("PASS: zero weight blocks")
+
+
+def test_weighted_dijkstra_distance():
+    """Distances scale with the entry cost of each cell."""
+    g = make_grid(4, 1)
+    weights = mcrfpy.DiscreteMap((4, 1), fill=3)
+    dmap = g.get_dijkstra_map((0, 0), weights=weights)
+    assert abs(dmap.distance((3, 0)) - 9.0) < 0.01, dmap.distance((3, 0))
+    # Weighted maps bypass the cache, so an unweighted request is unaffected.
+    plain = g.get_dijkstra_map((0, 0))
+    assert abs(plain.distance((3, 0)) - 3.0) < 0.01
+    print("PASS: weighted Dijkstra distances")
+
+
+def test_weights_size_mismatch():
+    g = make_grid(5, 5)
+    try:
+        g.find_path((0, 0), (4, 4), weights=mcrfpy.DiscreteMap((4, 4)))
+    except ValueError:
+        pass
+    else:
+        raise AssertionError("expected ValueError for mismatched weights")
+    try:
+        g.get_dijkstra_map((0, 0), weights=42)
+    except TypeError:
+        pass
+    else:
+        raise AssertionError("expected TypeError for non-DiscreteMap weights")
+    print("PASS: weights validation")
+
+
+def test_walkability_edit_seen_by_find_path():
+    """find_path reads the live walkable plane -- no sync step required."""
+    g = make_grid(5, 3)
+    assert len(g.find_path((0, 1), (4, 1))) == 4
+    for y in range(3):
+        g.at(2, y).walkable = False
+    assert g.find_path((0, 1), (4, 1)) is None
+    print("PASS: find_path sees walkability edits")
+
+
+def test_four_connected():
+    """diagonal_cost=0 restricts both searches to cardinal moves."""
+    g = make_grid(6, 6)
+    steps = coords(g.find_path((0, 0), (3, 3), diagonal_cost=0))
+    assert len(steps) == 6, steps
+    prev = (0, 0)
+    for s in steps:
+        assert abs(s[0] - prev[0]) + abs(s[1] - prev[1]) == 1, f"diagonal step {prev}->{s}"
+        prev = s
+    dmap = g.get_dijkstra_map(roots=[(0, 0)], diagonal_cost=0)
+    assert abs(dmap.distance((3, 3)) - 6.0) < 0.01
+    print("PASS: 4-connected search")
+
+
+if __name__ == "__main__":
+    test_weights_steer_find_path()
+    test_zero_weight_blocks()
+    test_weighted_dijkstra_distance()
+    test_weights_size_mismatch()
+    test_walkability_edit_seen_by_find_path()
+    test_four_connected()
+    print("All native pathfinding tests passed")
+    sys.exit(0)
@@ -0,0 +1,115 @@
+"""Scene.retained: runs of children are compiled into cached layers and
+re-blitted while nothing in them is marked dirty, reported by
+get_metrics()["retained_blits"] / ["retained_rebuilds"].
+
+An unchanged frame must not walk the cached subtrees, a change must rebuild
+only the layer holding it, grids stay live, and the picture must match
+immediate mode.
+"""
+import mcrfpy
+from mcrfpy import automation
+import sys
+import os
+import tempfile
+
+SHOT = os.path.join(tempfile.gettempdir(), "scene_retained.png")
+
+
+def render():
+    automation.screenshot(SHOT)
+    with open(SHOT, "rb") as f:
+        return f.read(), mcrfpy.get_metrics()
+
+
+def build(name):
+    scene = mcrfpy.Scene(name)
+    labels = []
+    for i in range(100):
+        scene.children.append(mcrfpy.Frame(pos=(i % 10 * 60, i // 10 * 40), size=(50, 30),
+                                           fill_color=mcrfpy.Color(40, 40, 90, 160)))
+        c = mcrfpy.Caption(text=f"{i}", pos=(i % 10 * 60 + 4, i // 10 * 40 + 4))
+        scene.children.append(c)
+        labels.append(c)
+    mcrfpy.current_scene = scene
+    return scene, labels
+
+
+def test_static_replay():
+    scene, labels = build("retained_static")
+    immediate, _ = render()
+    scene.retained = True
+    first, m = render()
+    assert first == immediate, "retained frame differs from immediate mode"
+    assert m["retained_rebuilds"] == 1 and m["retained_blits"] == 1, m
+
+    _, m = render()
+    assert m["retained_rebuilds"] == 0 and m["retained_blits"] == 1
+    assert m["visible_elements"] == 0, "an unchanged frame must not walk the cached layer"
+    assert m["draw_calls"] == 1, m["draw_calls"]
+
+    labels[5].text = "changed"
+    changed, m = render()
+    assert m["retained_rebuilds"] == 1, m["retained_rebuilds"]
+    scene.retained = False
+    expected, m = render()
+    assert m["retained_blits"] == 0
+    assert changed == expected, "an edited layer differs from immediate mode"
+    print("PASS: an unchanged retained scene is one blit; edits rebuild it")
+
+
+def test_live_commands():
+    scene, labels = build("retained_live")
+    scene.retained = True
+    render()
+    grid = mcrfpy.Grid(grid_size=(10, 10), pos=(0, 400), size=(160, 160))
+    scene.children.append(grid)
+    _, m = render()
+    assert m["retained_rebuilds"] == 0, "the untouched layer is carried over"
+    assert m["grid_cells_rendered"] > 0, "grids are drawn live"
+
+    scene.children.append(mcrfpy.Caption(text="after the grid", pos=(200, 420)))
+    _, m = render()
+    assert m["retained_rebuilds"] == 1 and m["retained_blits"] == 2, m
+
+    scene.opacity = 0.5
+    _, m = render()
+    assert m["retained_rebuilds"] == 2, "a scene fade re-rasterizes every layer"
+    print("PASS: grids stay live and only new or changed layers are rasterized")
+
+
+def test_visible_and_opacity():
+    scene, labels = build("retained_hud")
+    frame = scene.children[0]
+    scene.retained = True
+    render()
+
+    frame.visible = False
+    hidden, m = render()
+    assert m["retained_rebuilds"] == 1, "hiding a child must rebuild its layer"
+    scene.retained = False
+    expected, _ = render()
+    assert hidden == expected, "a hidden child is still blitted from the cache"
+
+    scene.retained = True
+    render()
+    labels[3].opacity = 0.3
+    faded, m = render()
+    assert m["retained_rebuilds"] == 1, "fading a child must rebuild its layer"
+    scene.retained = False
+    expected, _ = render()
+    assert faded == expected, "a faded child is still blitted at full opacity"
+
+    scene.retained = True
+    render()
+    labels[3].opacity = 0.3  # unchanged value: nothing to rebuild
+    _, m = render()
+    assert m["retained_rebuilds"] == 0, m["retained_rebuilds"]
+    print("PASS: visible and opacity changes rebuild the retained layer")
+
+
+if __name__ == "__main__":
+    test_static_replay()
+    test_live_commands()
+    test_visible_and_opacity()
+    print("All retained scene tests passed")
+    sys.exit(0)
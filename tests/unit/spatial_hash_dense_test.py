@@ -0,0 +1,78 @@
+"""Dense SpatialHash: bucket array sized from the grid, O(1) swap-remove.
+
+Queries must match a brute-force scan through inserts, moves and removals,
+including entities placed outside the grid (clamped into edge buckets).
+"""
+import mcrfpy
+import random
+import sys
+
+
+def cells(entities):
+    return sorted((int(e.grid_pos.x), int(e.grid_pos.y)) for e in entities)
+
+
+def brute_force(entities, center, radius):
+    cx, cy = center
+    found = []
+    for e in entities:
+        dx = e.grid_pos.x - cx
+        dy = e.grid_pos.y - cy
+        if dx * dx + dy * dy <= radius * radius:
+            found.append(e)
+    return cells(found)
+
+
+def test_matches_brute_force_under_churn():
+    rng = random.Random(11)
+    w, h = 100, 70
+    g = mcrfpy.Grid(grid_size=(w, h))
+    live = []
+    for step in range(1500):
+        op = rng.random()
+        if op < 0.35 or not live:
+            live.append(mcrfpy.Entity((rng.randrange(w), rng.randrange(h)), grid=g))
+        elif op < 0.5:
+            live.pop(rng.randrange(len(live))).die()
+        elif op < 0.8:
+            e = rng.choice(live)
+            e.cell_pos = (rng.randrange(w), rng.randrange(h))
+        else:
+            center = (rng.randrange(w), rng.randrange(h))
+            radius = rng.randrange(1, 40)
+            got = cells(g.entities_in_radius(center, radius))
+            assert got == brute_force(live, center, radius), f"step {step}: query mismatch"
+    print("PASS: radius queries match brute force through churn")
+
+
+def test_off_grid_entities_found():
+    g = mcrfpy.Grid(grid_size=(40, 40))
+    e = mcrfpy.Entity((-6, 50), grid=g)
+    assert len(g.entities_in_radius((-6, 50), 0.5)) == 1, "off-grid entity lost"
+    assert len(g.entities_in_radius((0, 39), 1.0)) == 0
+    e.cell_pos = (20, 20)
+    assert len(g.entities_in_radius((-6, 50), 0.5)) == 0
+    assert len(g.entities_in_radius((20, 20), 0.5)) == 1
+    print("PASS: off-grid entities clamp into edge buckets")
+
+
+def test_cell_query_after_moves():
+    g = mcrfpy.Grid(grid_size=(64, 64))
+    a = mcrfpy.Entity((3, 3), grid=g)
+    b = mcrfpy.Entity((3, 3), grid=g)
+    assert len(g.at(3, 3).entities) == 2
+    a.cell_pos = (60, 60)  # crosses buckets; b takes a's old slot
+    assert len(g.at(3, 3).entities) == 1
+    assert len(g.at(60, 60).entities) == 1
+    b.die()
+    assert len(g.at(3, 3).entities) == 0
+    assert len(g.at(60, 60).entities) == 1
+    print("PASS: cell queries follow swap-removes")
+
+
+if __name__ == "__main__":
+    test_matches_brute_force_under_churn()
+    test_off_grid_entities_found()
+    test_cell_query_after_moves()
+    print("All dense SpatialHash tests passed")
+    sys.exit(0)
@@ -0,0 +1,110 @@
+"""Timer scheduling: the engine keeps timers in a next-fire heap beside the
+by-name index, so each frame visits only due timers.
+
+Timers due on the same frame still fire in name order, step(None) still
+advances to the next fire time, and pause, resume, interval changes and
+stop() move or drop a timer's scheduled fire.
+"""
+import mcrfpy
+import sys
+
+fired = []
+
+
+def record(timer, runtime):
+    fired.append((timer.name, runtime))
+
+
+def test_name_order():
+    fired.clear()
+    names = ["order_c", "order_a", "order_b"]
+    timers = [mcrfpy.Timer(n, record, 100) for n in names]
+    mcrfpy.step(0.1)
+    assert [n for n, _ in fired] == ["order_a", "order_b", "order_c"], fired
+    for t in timers:
+        t.stop()
+    print("PASS: timers due together fire in name order")
+
+
+def test_step_to_next_event():
+    fired.clear()
+    slow = mcrfpy.Timer("next_slow", record, 700)
+    fast = mcrfpy.Timer("next_fast", record, 250)
+    dt = mcrfpy.step(None)
+    assert abs(dt - 0.25) < 1e-6, dt
+    assert [n for n, _ in fired] == ["next_fast"], fired
+    mcrfpy.step(None)
+    assert abs(mcrfpy.step(None) - 0.2) < 1e-6, "third event is the 700ms timer"
+    assert [n for n, _ in fired] == ["next_fast", "next_fast", "next_slow"], fired
+    slow.stop()
+    fast.stop()
+    print("PASS: step(None) advances to the earliest scheduled fire")
+
+
+def test_reschedule():
+    fired.clear()
+    t = mcrfpy.Timer("resched", record, 100)
+    t.pause()
+    mcrfpy.step(0.3)
+    assert fired == [], "a paused timer must not fire"
+    t.resume()
+    assert t.remaining == 100, t.remaining
+    t.interval = 20
+    mcrfpy.step(0.02)
+    assert len(fired) == 1, "a shortened interval fires at the new time"
+    t.interval = 1000
+    mcrfpy.step(0.5)
+    assert len(fired) == 1, "a lengthened interval waits for the new time"
+    t.stop()
+    mcrfpy.step(1.0)
+    assert len(fired) == 1, "a stopped timer must not fire"
+    assert "resched" not in [x.name for x in mcrfpy.timers]
+    t.restart()
+    mcrfpy.step(1.0)
+    assert len(fired) == 2, "a restarted timer is scheduled again"
+    t.stop()
+    print("PASS: pause, resume, interval and stop move the scheduled fire")
+
+
+def test_callback_ordering():
+    fired.clear()
+    late = mcrfpy.Timer("cb_z", record, 1000)
+    early = mcrfpy.Timer("cb_0", record, 1000)
+
+    def shorten(timer, runtime):
+        record(timer, runtime)
+        late.interval = 50    # sorts after cb_m: fires this pass
+        early.interval = 50   # sorts before cb_m: waits for the next pass
+
+    trigger = mcrfpy.Timer("cb_m", shorten, 100, once=True)
+    mcrfpy.step(0.1)
+    assert [n for n, _ in fired] == ["cb_m", "cb_z"], fired
+    mcrfpy.step(0.01)
+    assert [n for n, _ in fired][2:] == ["cb_0"], fired
+    assert "cb_m" not in [x.name for x in mcrfpy.timers], "fired one-shots leave the list"
+    late.stop()
+    early.stop()
+    print("PASS: timers made due by a callback keep the name-order scan's semantics")
+
+
+def test_many_timers():
+    fired.clear()
+    timers = [mcrfpy.Timer(f"many_{i:04d}", record, 1000 + i) for i in range(2000)]
+    mcrfpy.step(1.0)
+    assert [n for n, _ in fired] == ["many_0000"], fired
+    mcrfpy.step(0.01)
+    assert len(fired) == 11, len(fired)
+    for t in timers:
+        t.stop()
+    print("PASS: only due timers fire among thousands")
+
+
+if __name__ == "__main__":
+    mcrfpy.current_scene = mcrfpy.Scene("timer_scheduler")
+    test_name_order()
+    test_step_to_next_event()
+    test_reschedule()
+    test_callback_ordering()
+    test_many_timers()
+    print("All timer scheduler tests passed")
+    sys.exit(0)
@@ -0,0 +1,106 @@
+"""Scene-graph culling: drawables entirely off-screen, outside a clipping
+parent, or under an opaque Frame drawn after them are skipped, and counted in
+get_metrics()["culled_elements"] / ["occluded_elements"]; visible_elements
+counts what was actually drawn.
+
+Frames that let children overflow are never culled as a whole, and turning
+mcrfpy.occlusion_culling off must not change the picture.
+"""
+import mcrfpy
+from mcrfpy import automation
+import sys
+import os
+import tempfile
+
+SHOT = os.path.join(tempfile.gettempdir(), "ui_culling.png")
+
+
+def render():
+    automation.screenshot(SHOT)
+    return mcrfpy.get_metrics()
+
+
+def make(name):
+    scene = mcrfpy.Scene(name)
+    mcrfpy.current_scene = scene
+    return scene
+
+
+def box(x, y, w=20, h=20, alpha=255, **kw):
+    return mcrfpy.Frame(pos=(x, y), size=(w, h), fill_color=mcrfpy.Color(80, 120, 200, alpha), **kw)
+
+
+def test_offscreen():
+    scene = make("cull_offscreen")
+    for i in range(50):
+        scene.children.append(box(i * 20, 100))
+        scene.children.append(box(3000 + i * 20, 100))
+    m = render()
+    assert m["ui_elements"] == 100, m["ui_elements"]
+    assert m["culled_elements"] == 50, m["culled_elements"]
+    assert m["visible_elements"] == 50, m["visible_elements"]
+    print("PASS: off-screen drawables are skipped and counted")
+
+
+def test_parent_clip():
+    scene = make("cull_clip")
+    clip = box(10, 10, 100, 100, clip_children=True)
+    scene.children.append(clip)
+    clip.children.append(box(10, 10))
+    clip.children.append(box(300, 300))  # outside the clip rect
+    loose = box(-500, 0, 100, 100)       # off-screen, but its child is not
+    scene.children.append(loose)
+    loose.children.append(box(600, 10))
+    m = render()
+    assert m["culled_elements"] == 1, m["culled_elements"]
+    assert m["visible_elements"] == 4, m["visible_elements"]
+    print("PASS: clipped children are culled; overflowing frames are not")
+
+
+def test_occlusion():
+    scene = make("cull_occlusion")
+    for i in range(20):
+        scene.children.append(box(20 + i * 10, 20))
+    cover = box(0, 0, 400, 200)
+    scene.children.append(cover)
+    scene.children.append(box(50, 50))  # drawn after the cover: stays
+    m = render()
+    assert m["occluded_elements"] == 20, m["occluded_elements"]
+    assert m["visible_elements"] == 2, m["visible_elements"]
+    with open(SHOT, "rb") as f:
+        culled = f.read()
+
+    mcrfpy.occlusion_culling = False
+    m = render()
+    with open(SHOT, "rb") as f:
+        full = f.read()
+    mcrfpy.occlusion_culling = True
+    assert m["occluded_elements"] == 0 and m["visible_elements"] == 22
+    assert culled == full, "occlusion culling changed the rendered frame"
+
+    cover.fill_color = mcrfpy.Color(0, 0, 0, 128)
+    assert render()["occluded_elements"] == 0, "a translucent frame hides nothing"
+    cover.fill_color = mcrfpy.Color(0, 0, 0, 255)
+    cover.opacity = 0.5
+    assert render()["occluded_elements"] == 0, "a faded frame hides nothing"
+    print("PASS: drawables under an opaque frame are skipped without changing the frame")
+
+
+def test_thick_line_edge():
+    scene = make("cull_line")
+    # Endpoints just above the window; the 20px stroke still reaches into it
+    scene.children.append(mcrfpy.Line(start=(100, -40), end=(300, -5), thickness=20))
+    scene.children.append(mcrfpy.Line(start=(100, -90), end=(300, -40), thickness=20))
+    m = render()
+    assert m["culled_elements"] == 1, m["culled_elements"]
+    assert m["visible_elements"] == 1, m["visible_elements"]
+    print("PASS: a thick line is culled by its stroke, not its endpoints")
+
+
+if __name__ == "__main__":
+    test_offscreen()
+    test_parent_clip()
+    test_occlusion()
+    test_thick_line_edge()
+    print("All UI culling tests passed")
+    sys.exit(0)